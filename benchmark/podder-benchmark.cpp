@@ -21,14 +21,24 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <deque>
 #include <fstream>
+#include <iostream>
 #include <iterator>
-#include <list>
-#include <map>
-#include <random>
-#include <sax/iostream.hpp>
+#include <mutex>
+#include <optional>
+#include <ratio>
+#include <set>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -36,109 +46,1343 @@
 
 #ifdef _WIN32
 #    pragma comment( lib, "Shlwapi.lib" )
-#ifndef NDEBUG
-#    pragma comment( lib, "benchmark_maind.lib" )
-#    pragma comment( lib, "benchmarkd.lib" )
-#else
-#    pragma comment( lib, "benchmark_main.lib" )
-#    pragma comment( lib, "benchmark.lib" )
+#    ifndef NDEBUG
+#        pragma comment( lib, "benchmarkd.lib" )
+#    else
+#        pragma comment( lib, "benchmark.lib" )
+#    endif
 #endif
+
+// podder and std::vector both allocate through the system allocator, which
+// keeps the timings and the allocation counts comparable.
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+#include "podder/bit_podder.hpp"
+#include "podder/cow_podder.hpp"
+#include "podder/expr.hpp"
+#include "podder/gap_podder.hpp"
+#include "podder/interner.hpp"
+#include "podder/profile_report.hpp"
+#include "podder/pstring.hpp"
+#include "podder/reduce.hpp"
+#include "podder/rope_podder.hpp"
+#include "podder/segmented_podder.hpp"
+#include "podder/soa_podder.hpp"
+#include "podder/ring.hpp"
+#include "podder/ws_deque.hpp"
+
+// allocation counting.
+
+// On linux/glibc the allocation functions are interposed, which catches both
+// pdr::malloc and friends and the operator new of std::vector. Elsewhere the
+// counters simply report zero.
+
+namespace bm {
+inline std::size_t allocations = 0, reallocations = 0;
+}
+
+#if defined( __linux__ ) and defined( __GLIBC__ )
+extern "C" {
+void * __libc_malloc ( std::size_t );
+void * __libc_calloc ( std::size_t, std::size_t );
+void * __libc_realloc ( void *, std::size_t );
+
+void * malloc ( std::size_t size ) {
+    ++bm::allocations;
+    return __libc_malloc ( size );
+}
+void * calloc ( std::size_t num, std::size_t size ) {
+    ++bm::allocations;
+    return __libc_calloc ( num, size );
+}
+void * realloc ( void * ptr, std::size_t new_size ) {
+    ++( ptr ? bm::reallocations : bm::allocations );
+    return __libc_realloc ( ptr, new_size );
+}
+}
 #endif
 
-#include <sax/splitmix.hpp>
-#include <sax/uniform_int_distribution.hpp>
+namespace bm {
 
-#define MI_SECURE true
+// value types.
 
-#include "podder.hpp"
+template<std::size_t Size>
+struct pod {
+    std::array<std::uint8_t, Size> bytes;
 
-// integer logN.
+    [[nodiscard]] bool operator== ( pod const & rhs ) const noexcept { return bytes == rhs.bytes; }
+    [[nodiscard]] bool operator< ( pod const & rhs ) const noexcept { return bytes < rhs.bytes; }
+};
 
-template<int Base, typename T, typename sfinae = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
-constexpr T iLog ( const T n_, const T p_ = T ( 0 ) ) noexcept {
-    return n_ < Base ? p_ : iLog<Base, T, sfinae> ( n_ / Base, p_ + 1 );
+template<typename T>
+[[nodiscard]] T make_value ( std::size_t i ) noexcept {
+    if constexpr ( std::is_arithmetic<T>::value ) {
+        return static_cast<T> ( i );
+    }
+    else {
+        T t{};
+        std::memcpy ( ( void * ) t.bytes.data ( ), ( void * ) &i, std::min ( sizeof ( i ), sizeof ( t.bytes ) ) );
+        return t;
+    }
 }
 
-// integer log2.
+template<typename T>
+[[nodiscard]] std::uint64_t to_u64 ( T const & v ) noexcept {
+    if constexpr ( std::is_arithmetic<T>::value )
+        return static_cast<std::uint64_t> ( v );
+    else
+        return v.bytes[ 0 ];
+}
 
-template<typename T, typename = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
-constexpr T ilog2 ( const T n_ ) noexcept {
-    return iLog<2, T> ( n_ );
+template<typename Container>
+[[nodiscard]] Container make_container ( std::size_t n ) noexcept {
+    using value_type = typename Container::value_type;
+    Container c;
+    for ( std::size_t i = 0; i < n; ++i )
+        c.emplace_back ( make_value<value_type> ( i ) );
+    return c;
 }
 
-template<typename T, typename = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
-constexpr T next_power_2 ( const T n_ ) noexcept {
-    return n_ > 2 ? T ( 1 ) << ( ilog2<T> ( n_ - 1 ) + 1 ) : n_;
+template<typename>
+struct is_podder : std::false_type {};
+template<typename T, typename S, typename G, std::size_t A, std::size_t P>
+struct is_podder<podder<T, S, G, A, P>> : std::true_type {};
+
+template<typename Container>
+void unordered_erase ( Container & c, typename Container::iterator it ) noexcept {
+    if constexpr ( is_podder<Container>::value ) {
+        c.unchecked_unordered_erase ( it );
+    }
+    else {
+        *it = c.back ( );
+        c.pop_back ( );
+    }
 }
 
-template<typename T, typename = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
-constexpr bool is_power_2 ( const T n_ ) noexcept {
-    return n_ and not( n_ & ( n_ - 1 ) );
+// reporting.
+
+struct allocation_scope {
+    std::size_t & a;
+    std::size_t & r;
+    std::size_t const a0 = allocations, r0 = reallocations;
+
+    allocation_scope ( std::size_t & a_, std::size_t & r_ ) noexcept : a ( a_ ), r ( r_ ) {}
+    ~allocation_scope ( ) noexcept {
+        a += allocations - a0;
+        r += reallocations - r0;
+    }
+};
+
+void report ( benchmark::State & state, std::size_t const a, std::size_t const r, std::size_t const items ) noexcept {
+    state.counters[ "allocs" ]   = benchmark::Counter ( static_cast<double> ( a ), benchmark::Counter::kAvgIterations );
+    state.counters[ "reallocs" ] = benchmark::Counter ( static_cast<double> ( r ), benchmark::Counter::kAvgIterations );
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * items ) );
 }
 
-template<typename ValueType>
-static void custom_arguments ( benchmark::internal::Benchmark * b ) {
-    const std::size_t bs = podder<ValueType>::buff_size ( );
-    b->Args ( { ( long long ) bs, 8192 / sizeof ( ValueType ) } );
-    for ( std::size_t i = next_power_2 ( bs + is_power_2 ( bs ) ); i <= 8192u / sizeof ( ValueType ); i <<= 1 )
-        b->Args ( { ( long long ) i, 8192 / sizeof ( ValueType ) } );
+// benchmarks, state.range ( 0 ) is the (final) size of the container.
+
+template<typename Container>
+void bm_construct ( benchmark::State & state ) noexcept {
+    using size_type     = typename Container::size_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c ( static_cast<size_type> ( n ) );
+        benchmark::DoNotOptimize ( c.data ( ) );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_copy ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container const src = make_container<Container> ( n );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c ( src );
+        benchmark::DoNotOptimize ( c.data ( ) );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_move ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container c         = make_container<Container> ( n );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container t ( std::move ( c ) ); // move construction and move assignment.
+        c = std::move ( t );
+        benchmark::DoNotOptimize ( c.data ( ) );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_assign ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container const src = make_container<Container> ( n );
+    Container dst;
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        dst = src;
+        benchmark::DoNotOptimize ( dst.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_emplace_back ( benchmark::State & state ) noexcept {
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c;
+        for ( std::size_t i = 0; i < n; ++i )
+            c.emplace_back ( make_value<value_type> ( i ) );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_insert ( benchmark::State & state ) noexcept { // inserts in the middle, starting out empty.
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c;
+        for ( std::size_t i = 0; i < n; ++i )
+            c.insert ( c.begin ( ) + c.size ( ) / 2, make_value<value_type> ( i ) );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+enum class at { front, middle, back };
+
+template<typename Container, at Where>
+void bm_insert_range ( benchmark::State & state ) noexcept { // inserts 3 values at a time, starting out empty.
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::array<value_type, 3> values;
+    for ( std::size_t i = 0; i < values.size ( ); ++i )
+        values[ i ] = make_value<value_type> ( i );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c;
+        while ( c.size ( ) < n ) {
+            std::size_t const i = Where == at::front ? 0u : Where == at::middle ? c.size ( ) / 2 : c.size ( );
+            c.insert ( c.begin ( ) + i, values.begin ( ), values.begin ( ) + std::min ( values.size ( ), n - c.size ( ) ) );
+        }
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_erase ( benchmark::State & state ) noexcept { // erases in the middle, until empty.
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container const src = make_container<Container> ( n );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        state.PauseTiming ( );
+        Container c ( src );
+        state.ResumeTiming ( );
+        allocation_scope const as ( a, r );
+        while ( c.size ( ) )
+            c.erase ( c.begin ( ) + c.size ( ) / 2 );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_unordered_erase ( benchmark::State & state ) noexcept { // erases in the middle, until empty.
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container const src = make_container<Container> ( n );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        state.PauseTiming ( );
+        Container c ( src );
+        state.ResumeTiming ( );
+        allocation_scope const as ( a, r );
+        while ( c.size ( ) )
+            unordered_erase ( c, c.begin ( ) + c.size ( ) / 2 );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_resize ( benchmark::State & state ) noexcept {
+    using size_type     = typename Container::size_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c;
+        c.resize ( static_cast<size_type> ( n ) );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
 }
 
-template<class Container>
-void bm_emplace_back_random ( benchmark::State & state ) noexcept {
+template<typename Container>
+void bm_reserve ( benchmark::State & state ) noexcept {
+    using size_type     = typename Container::size_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c;
+        c.reserve ( static_cast<size_type> ( n ) );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, 1 );
+}
+
+template<typename Container>
+void bm_equal ( benchmark::State & state ) noexcept { // equal contents, so the whole range is compared.
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container l = make_container<Container> ( n ), r = make_container<Container> ( n );
+    std::size_t aa = 0, ar = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( aa, ar );
+        bool const eq = l == r;
+        benchmark::DoNotOptimize ( eq );
+    }
+    report ( state, aa, ar, n );
+}
+
+template<typename Container>
+void bm_less ( benchmark::State & state ) noexcept { // equal contents, so the whole range is compared.
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container l = make_container<Container> ( n ), r = make_container<Container> ( n );
+    std::size_t aa = 0, ar = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( aa, ar );
+        bool const lt = l < r;
+        benchmark::DoNotOptimize ( lt );
+    }
+    report ( state, aa, ar, n );
+}
+
+// state.range ( 0 ) bytes of equal prefix, the last element differs.
+template<typename Container>
+void bm_less_prefix ( benchmark::State & state ) noexcept {
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) ) / sizeof ( value_type );
+    Container l = make_container<Container> ( n ), r = make_container<Container> ( n );
+    r.back ( )  = make_value<value_type> ( n );
+    for ( auto _ : state ) {
+        bool const lt = l < r;
+        benchmark::DoNotOptimize ( lt );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n * sizeof ( value_type ) ) );
+}
+
+struct first_byte { // a key projection.
+    [[nodiscard]] std::uint8_t operator( ) ( pod<16> const & p ) const noexcept { return p.bytes[ 0 ]; }
+};
+
+template<typename Container>
+void bm_less_prefix_by_key ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) ) / sizeof ( pod<16> );
+    Container l = make_container<Container> ( n ), r = make_container<Container> ( n );
+    r.back ( )  = make_value<pod<16>> ( n );
+    for ( auto _ : state ) {
+        bool lt;
+        if constexpr ( is_podder<Container>::value )
+            lt = l.compare ( r, first_byte{ } ) < 0;
+        else
+            lt = std::lexicographical_compare ( l.begin ( ), l.end ( ), r.begin ( ), r.end ( ),
+                                                [] ( pod<16> const & a, pod<16> const & b ) { return first_byte{ }( a ) < first_byte{ }( b ); } );
+        benchmark::DoNotOptimize ( lt );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n * sizeof ( pod<16> ) ) );
+}
+
+// hashing the contents, against std::hash<std::string_view> (the standard library's hash of the same bytes).
+template<typename Container>
+void bm_hash ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container const c   = make_container<Container> ( n );
+    for ( auto _ : state ) {
+        std::size_t h;
+        if constexpr ( is_podder<Container>::value )
+            h = std::hash<Container>{ }( c );
+        else
+            h = std::hash<std::string_view>{ }( std::string_view ( reinterpret_cast<char const *> ( c.data ( ) ), c.size ( ) ) );
+        benchmark::DoNotOptimize ( h );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n ) );
+}
+
+template<typename Container>
+void bm_iterate ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container c         = make_container<Container> ( n );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        std::uint64_t sum = 0;
+        for ( auto const & v : c )
+            sum += to_u64 ( v );
+        benchmark::DoNotOptimize ( sum );
+    }
+    report ( state, a, r, n );
+}
+
+template<typename Container>
+void bm_replay ( benchmark::State & state, std::vector<std::size_t> const & sizes ) noexcept { // final sizes from a profile.
     using value_type = typename Container::value_type;
-    using size_type = typename Container::size_type;
-    sax::splitmix64 gen;
+    std::size_t items = 0;
+    for ( std::size_t const n : sizes )
+        items += n;
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        for ( std::size_t const n : sizes ) {
+            Container c;
+            for ( std::size_t i = 0; i < n; ++i )
+                c.emplace_back ( make_value<value_type> ( i ) );
+            benchmark::DoNotOptimize ( c.data ( ) );
+        }
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, items );
+}
+
+// a fifo queue of (about) n values, each iteration enqueues and dequeues n values.
+
+template<typename Container>
+void bm_fifo ( benchmark::State & state ) noexcept {
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container c;
+    for ( std::size_t i = 0; i < n; ++i )
+        c.push_back ( make_value<value_type> ( i ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        for ( std::size_t i = 0; i < n; ++i ) {
+            c.push_back ( make_value<value_type> ( i ) );
+            benchmark::DoNotOptimize ( c.front ( ) );
+            c.pop_front ( );
+        }
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+// message passing, state.range ( 0 ) producers and one consumer (the benchmark thread), 2^16 messages per iteration.
+
+template<typename Ring>
+struct ring_queue {
+    Ring r{ 4'096u };
+
+    bool try_push ( std::uint64_t const v ) noexcept { return r.try_push ( v ); }
+    std::optional<std::uint64_t> try_pop ( ) noexcept { return r.try_pop ( ); }
+};
+
+struct locked_podder_queue { // what a mutex around a podder gives.
+    std::mutex m;
+    podder<std::uint64_t> p;
+
+    bool try_push ( std::uint64_t const v ) noexcept {
+        std::lock_guard<std::mutex> const lock ( m );
+        p.push_back ( v );
+        return true;
+    }
+    std::optional<std::uint64_t> try_pop ( ) noexcept {
+        std::lock_guard<std::mutex> const lock ( m );
+        return p.pop_front_get ( );
+    }
+};
+
+template<typename Queue>
+void bm_messages ( benchmark::State & state ) {
+    std::size_t const producers = static_cast<std::size_t> ( state.range ( 0 ) ), n = std::size_t{ 1 } << 16;
+    Queue q;
+    for ( auto _ : state ) {
+        std::vector<std::thread> threads;
+        for ( std::size_t p = 0; p < producers; ++p )
+            threads.emplace_back ( [ &q, p, n, producers ] {
+                for ( std::size_t i = p; i < n; i += producers )
+                    while ( not q.try_push ( i ) )
+                        std::this_thread::yield ( );
+            } );
+        std::uint64_t sum = 0;
+        for ( std::size_t i = 0; i < n; ) {
+            if ( auto const v = q.try_pop ( ); v ) {
+                sum += *v;
+                ++i;
+            }
+            else {
+                std::this_thread::yield ( );
+            }
+        }
+        for ( std::thread & t : threads )
+            t.join ( );
+        benchmark::DoNotOptimize ( sum );
+    }
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n ) );
+}
+
+// latency, a round trip through two spsc rings (the spinning sides yield, which matters on machines with few cores).
+void bm_ring_round_trip ( benchmark::State & state ) {
+    pdr::spsc_ring<std::uint64_t> ping ( 64u ), pong ( 64u );
+    std::atomic<bool> done{ false };
+    std::thread echo ( [ & ] {
+        while ( not done.load ( std::memory_order_relaxed ) ) {
+            if ( auto const v = ping.try_pop ( ); v )
+                static_cast<void> ( pong.try_push ( *v ) ); // never full.
+            else
+                std::this_thread::yield ( );
+        }
+    } );
+    std::uint64_t i = 0;
+    for ( auto _ : state ) {
+        static_cast<void> ( ping.try_push ( i ) ); // never full.
+        std::optional<std::uint64_t> v;
+        while ( not( v = pong.try_pop ( ) ) )
+            std::this_thread::yield ( );
+        benchmark::DoNotOptimize ( *v );
+        ++i;
+    }
+    done.store ( true, std::memory_order_relaxed );
+    echo.join ( );
+}
+
+// a parallel graph traversal (bfs-like, in no particular order), per-thread work lists with stealing, each iteration
+// visits all 2^16 nodes of a random graph (out-degree 8) from node 0, with state.range ( 0 ) threads.
+
+struct graph {
+    static constexpr std::uint32_t nodes = 1u << 16, degree = 8u;
+
+    std::vector<std::uint32_t> edges;
+
+    graph ( ) : edges ( std::size_t{ nodes } * degree ) {
+        std::uint64_t x = 0x9E37'79B9'7F4A'7C15ull;
+        for ( std::uint32_t & e : edges ) { // xorshift64.
+            x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+            e = static_cast<std::uint32_t> ( x % nodes );
+        }
+        for ( std::uint32_t n = 0; n < nodes - 1u; ++n ) // keep all nodes reachable.
+            edges[ std::size_t{ n } * degree ] = n + 1u;
+    }
+
+    static graph const & instance ( ) {
+        static graph const g;
+        return g;
+    }
+};
+
+struct ws_deque_list {
+    pdr::ws_deque<std::uint32_t> q;
+
+    void push ( std::uint32_t const v ) noexcept { q.push ( v ); }
+    std::optional<std::uint32_t> pop ( ) noexcept { return q.pop ( ); }
+    std::optional<std::uint32_t> steal ( ) noexcept { return q.steal ( ); }
+};
+
+struct locked_podder_list { // a mutex per list.
+    std::mutex m;
+    podder<std::uint32_t> p;
+
+    void push ( std::uint32_t const v ) noexcept {
+        std::lock_guard<std::mutex> const lock ( m );
+        p.emplace_back ( v );
+    }
+    std::optional<std::uint32_t> pop ( ) noexcept {
+        std::lock_guard<std::mutex> const lock ( m );
+        return p.pop_back_get ( );
+    }
+    std::optional<std::uint32_t> steal ( ) noexcept {
+        std::lock_guard<std::mutex> const lock ( m );
+        return p.pop_front_get ( );
+    }
+};
+
+template<typename List>
+void bm_traversal ( benchmark::State & state ) {
+    graph const & g           = graph::instance ( );
+    std::size_t const threads = static_cast<std::size_t> ( state.range ( 0 ) );
+    for ( auto _ : state ) {
+        std::vector<std::atomic<bool>> visited ( graph::nodes );
+        std::atomic<std::uint32_t> processed{ 0 };
+        std::vector<List> lists ( threads );
+        visited[ 0 ].store ( true, std::memory_order_relaxed );
+        lists[ 0 ].push ( 0u );
+        auto work = [ & ] ( std::size_t const self ) {
+            std::size_t victim = self;
+            while ( processed.load ( std::memory_order_relaxed ) < graph::nodes ) {
+                std::optional<std::uint32_t> n = lists[ self ].pop ( );
+                if ( not n ) {
+                    victim = ( victim + 1 ) % threads;
+                    if ( victim == self or not( n = lists[ victim ].steal ( ) ) ) {
+                        std::this_thread::yield ( );
+                        continue;
+                    }
+                }
+                for ( std::uint32_t e = 0; e < graph::degree; ++e ) {
+                    std::uint32_t const m = g.edges[ std::size_t{ *n } * graph::degree + e ];
+                    if ( not visited[ m ].exchange ( true, std::memory_order_relaxed ) )
+                        lists[ self ].push ( m );
+                }
+                processed.fetch_add ( 1u, std::memory_order_relaxed );
+            }
+        };
+        std::vector<std::thread> pool;
+        for ( std::size_t t = 1; t < threads; ++t )
+            pool.emplace_back ( work, t );
+        work ( 0 );
+        for ( std::thread & t : pool )
+            t.join ( );
+    }
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * graph::nodes ) );
+}
+
+// interning, a corpus of 2^16 token lists (1 - 16 tokens) of which 80% are duplicates. Each iteration either copies
+// the corpus into a vector of podders, or interns it (keeping the handles), the counters report the memory (heap and
+// inline) of the result.
+
+[[nodiscard]] std::vector<podder<std::uint32_t>> const & token_corpus ( ) {
+    static std::vector<podder<std::uint32_t>> const corpus = [ ] {
+        std::size_t const n = std::size_t{ 1 } << 16;
+        std::uint64_t x     = 0x2545'F491'4F6C'DD1Dull;
+        auto next           = [ &x ] { // xorshift64.
+            x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+            return x;
+        };
+        std::vector<podder<std::uint32_t>> uniques ( n / 5u ), c;
+        for ( podder<std::uint32_t> & u : uniques ) {
+            std::size_t const size = 1u + next ( ) % 16u;
+            for ( std::size_t i = 0; i < size; ++i )
+                u.emplace_back ( static_cast<std::uint32_t> ( next ( ) % 50'000u ) );
+        }
+        c = uniques;
+        while ( c.size ( ) < n )
+            c.push_back ( uniques[ next ( ) % uniques.size ( ) ] );
+        for ( std::size_t i = c.size ( ) - 1u; i; --i )
+            c[ i ].swap ( c[ next ( ) % ( i + 1u ) ] );
+        return c;
+    }( );
+    return corpus;
+}
+
+void bm_corpus_copy ( benchmark::State & state ) noexcept {
+    std::vector<podder<std::uint32_t>> const & corpus = token_corpus ( );
+    std::size_t bytes                                  = 0;
+    for ( auto _ : state ) {
+        std::vector<podder<std::uint32_t>> c ( corpus.begin ( ), corpus.end ( ) );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        bytes = c.capacity ( ) * sizeof ( podder<std::uint32_t> );
+        for ( podder<std::uint32_t> const & p : c )
+            bytes += p.capacity ( ) > podder<std::uint32_t>::svo_capacity ( ) ? p.capacity_in_bytes ( ) : 0u;
+    }
+    state.counters[ "bytes" ] = static_cast<double> ( bytes );
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * corpus.size ( ) ) );
+}
+
+void bm_corpus_intern ( benchmark::State & state ) noexcept {
+    std::vector<podder<std::uint32_t>> const & corpus = token_corpus ( );
+    std::size_t bytes                                  = 0;
+    for ( auto _ : state ) {
+        pdr::interner<std::uint32_t> in;
+        std::vector<pdr::interner<std::uint32_t>::handle> handles;
+        handles.reserve ( corpus.size ( ) );
+        for ( podder<std::uint32_t> const & p : corpus )
+            handles.push_back ( in.intern ( p.data ( ), p.size ( ) ) );
+        benchmark::DoNotOptimize ( handles.data ( ) );
+        bytes = in.memory_in_bytes ( ) + handles.capacity ( ) * sizeof ( pdr::interner<std::uint32_t>::handle );
+    }
+    state.counters[ "bytes" ] = static_cast<double> ( bytes );
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * corpus.size ( ) ) );
+}
+
+// strings, pdr::pstring against std::string, on log-like data: copies of 1'024 short (8 - 23 char) tokens, a search
+// for a needle at the end of a state.range ( 0 ) char line, and the split of a line in 16 fields.
+
+template<typename String>
+void bm_string_copy ( benchmark::State & state ) noexcept {
+    std::vector<String> tokens;
+    for ( std::size_t i = 0; i < 1'024u; ++i )
+        tokens.emplace_back ( std::string ( 8u + i % 16u, static_cast<char> ( 'a' + i % 26u ) ) );
+    std::size_t aa = 0, ar = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( aa, ar );
+        std::vector<String> c ( tokens );
+        benchmark::DoNotOptimize ( c.data ( ) );
+    }
+    report ( state, aa, ar, tokens.size ( ) );
+}
+
+template<typename String>
+void bm_string_find ( benchmark::State & state ) noexcept {
+    std::string line ( static_cast<std::size_t> ( state.range ( 0 ) ), '.' );
+    for ( std::size_t i = 0; i < line.size ( ); i += 7u )
+        line[ i ] = 'E'; // first char candidates.
+    line.replace ( line.size ( ) - 5u, 5u, "ERROR" );
+    String const s ( line );
+    for ( auto _ : state ) {
+        std::size_t const i = s.find ( std::string_view ( "ERROR" ) );
+        benchmark::DoNotOptimize ( i );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * line.size ( ) ) );
+}
+
+template<typename String>
+void bm_string_split ( benchmark::State & state ) noexcept {
+    std::string line;
+    for ( std::size_t i = 0; i < 16u; ++i )
+        line += ( i ? "," : "" ) + std::string ( 1u + i % 11u, 'x' );
+    String const s ( line );
+    for ( auto _ : state ) {
+        std::size_t fields = 0;
+        if constexpr ( std::is_same<String, pdr::pstring>::value ) {
+            s.split ( ',', [ &fields ] ( std::string_view const f ) { fields += f.size ( ); } );
+        }
+        else {
+            for ( std::size_t b = 0;; ) {
+                std::size_t const e = s.find ( ',', b );
+                fields += std::string_view ( s ).substr ( b, e - b ).size ( );
+                if ( e == std::string::npos )
+                    break;
+                b = e + 1u;
+            }
+        }
+        benchmark::DoNotOptimize ( fields );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * line.size ( ) ) );
+}
+
+// filters of state.range ( 0 ) flags, pdr::bit_podder against podder<bool>, counting the set flags and intersecting
+// two filters, the counters report the memory of one filter.
+
+template<typename Filter>
+[[nodiscard]] Filter make_filter ( std::size_t const n, std::uint64_t x ) noexcept {
+    Filter f;
+    for ( std::size_t i = 0; i < n; ++i ) { // xorshift64.
+        x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+        f.push_back ( x & 1u );
+    }
+    return f;
+}
+
+template<typename Filter>
+void bm_filter_count ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Filter const f      = make_filter<Filter> ( n, 0x9E37'79B9'7F4A'7C15ull );
+    for ( auto _ : state ) {
+        std::size_t c;
+        if constexpr ( std::is_same<Filter, podder<bool>>::value )
+            c = static_cast<std::size_t> ( std::count ( f.begin ( ), f.end ( ), true ) );
+        else
+            c = f.count ( );
+        benchmark::DoNotOptimize ( c );
+    }
+    state.counters[ "bytes" ] = static_cast<double> ( f.size_in_bytes ( ) );
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n ) );
+}
+
+template<typename Filter>
+void bm_filter_and ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Filter a = make_filter<Filter> ( n, 0x9E37'79B9'7F4A'7C15ull ), b = make_filter<Filter> ( n, 0x2545'F491'4F6C'DD1Dull );
+    for ( auto _ : state ) {
+        if constexpr ( std::is_same<Filter, podder<bool>>::value ) {
+            for ( std::size_t i = 0; i < n; ++i )
+                a[ i ] = a[ i ] and b[ i ];
+        }
+        else {
+            a &= b;
+        }
+        benchmark::ClobberMemory ( );
+    }
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n ) );
+}
+
+// editor-like edits on a text of state.range ( 0 ) bytes, typing and backspacing at a cursor that mostly stays put
+// and now and then jumps.
+
+struct edit_script {
+    std::vector<std::uint32_t> ops; // low 2 bits the op, jump target in the rest.
+
+    explicit edit_script ( std::size_t const n ) {
+        std::uint64_t x = 0x9E37'79B9'7F4A'7C15ull;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+            ops.push_back ( static_cast<std::uint32_t> ( x ) );
+        }
+    }
+};
+
+template<typename Text>
+void bm_edits ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    edit_script const script ( 4'096 );
+    for ( auto _ : state ) {
+        state.PauseTiming ( );
+        Text t;
+        for ( std::size_t i = 0; i < n; ++i )
+            t.insert ( t.size ( ), static_cast<char> ( 'a' + i % 26 ) );
+        std::size_t cursor = n / 2;
+        state.ResumeTiming ( );
+        for ( std::uint32_t const op : script.ops ) {
+            switch ( op % 16u ) {
+                case 0: cursor = ( op >> 4 ) % ( t.size ( ) + 1 ); break; // jump.
+                case 1:
+                case 2:
+                case 3:
+                    if ( cursor ) // backspace.
+                        t.erase ( --cursor );
+                    break;
+                default: t.insert ( cursor++, static_cast<char> ( 'a' + op % 26u ) ); // type.
+            }
+        }
+        benchmark::DoNotOptimize ( t.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * script.ops.size ( ) ) );
+}
+
+struct podder_text { // podder, edited in place.
+    podder<char> p;
+
+    [[nodiscard]] std::size_t size ( ) const noexcept { return p.size ( ); }
+    [[nodiscard]] char * data ( ) noexcept { return p.data ( ); }
+    void insert ( std::size_t const i, char const c ) noexcept { p.insert ( p.begin ( ) + i, c ); }
+    void erase ( std::size_t const i ) noexcept { p.erase ( p.begin ( ) + i ); }
+};
+
+// inserts at random positions into a sequence of state.range ( 0 ) values, and a full scan.
+
+struct podder_sequence { // podder, inserted into in place.
+    podder<std::uint32_t> p;
+
+    podder_sequence ( std::uint32_t const * const first, std::size_t const n ) noexcept : p ( first, n ) {}
+    [[nodiscard]] std::size_t size ( ) const noexcept { return p.size ( ); }
+    void insert ( std::size_t const i, std::uint32_t const v ) noexcept { p.insert ( p.begin ( ) + i, v ); }
+    template<typename Function>
+    void for_each_leaf ( Function f ) const {
+        f ( p.data ( ), p.size ( ) );
+    }
+};
+
+template<typename Sequence>
+void bm_random_insert ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::vector<std::uint32_t> const src ( n, 1u );
+    std::uint64_t x = 0x2545'F491'4F6C'DD1Dull;
+    for ( auto _ : state ) {
+        state.PauseTiming ( );
+        Sequence s ( src.data ( ), n );
+        state.ResumeTiming ( );
+        for ( std::size_t i = 0; i < 1'024u; ++i ) {
+            x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+            s.insert ( static_cast<std::size_t> ( x % ( s.size ( ) + 1 ) ), static_cast<std::uint32_t> ( x ) );
+        }
+        std::uint64_t sum = 0;
+        s.for_each_leaf ( [ &sum ] ( std::uint32_t const * p, std::size_t const m ) {
+            for ( std::uint32_t const * const e = p + m; p != e; ++p )
+                sum += *p;
+        } );
+        benchmark::DoNotOptimize ( sum );
+    }
+    state.SetItemsProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * 1'024u ) );
+}
+
+// appending state.range ( 0 ) values, one by one, to a podder (relocating) or a segmented_podder (never relocating).
+
+template<typename Container>
+void bm_append ( benchmark::State & state ) noexcept {
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        Container c;
+        for ( std::size_t i = 0; i < n; ++i )
+            c.emplace_back ( make_value<value_type> ( i ) );
+        benchmark::DoNotOptimize ( &c.back ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, n );
+}
+
+// filling state.range ( 0 ) values, a value that isn't byte-repeatable (not a memset), or the sequence 0, 3, 6, ...
+
+template<typename Container>
+void bm_fill ( benchmark::State & state ) noexcept {
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container c;
+    for ( auto _ : state ) {
+        c.assign ( n, make_value<value_type> ( 0x0102'0304u ) );
+        benchmark::DoNotOptimize ( c.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n * sizeof ( value_type ) ) );
+}
+
+template<typename Container>
+void bm_iota ( benchmark::State & state ) noexcept {
+    using value_type    = typename Container::value_type;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    for ( auto _ : state ) {
+        if constexpr ( is_podder<Container>::value ) {
+            Container c ( n, value_type{ 0 }, 3 );
+            benchmark::DoNotOptimize ( c.data ( ) );
+        }
+        else {
+            Container c ( n );
+            value_type v = 0;
+            for ( auto & e : c ) {
+                e = v;
+                v += 3;
+            }
+            benchmark::DoNotOptimize ( c.data ( ) );
+        }
+        benchmark::ClobberMemory ( );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * n * sizeof ( value_type ) ) );
+}
+
+// a = b * c + d over state.range ( 0 ) floats, fused (pdr::expr), by hand, or a pass (and a temporary) per operation.
+
+enum class evaluation { fused, loop, temporaries };
+
+template<evaluation E>
+void bm_expression ( benchmark::State & state ) noexcept {
+    using namespace pdr::expr;
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    podder<float> a, t, b ( n, 1.5f ), c ( n, 2.0f ), d ( n, 0.5f );
+    for ( auto _ : state ) {
+        if constexpr ( E == evaluation::fused ) {
+            assign ( a, of ( b ) * of ( c ) + of ( d ) );
+        }
+        else if constexpr ( E == evaluation::loop ) {
+            a.resize_reserve_only ( n );
+            float * const pa = a.data ( );
+            float const *const pb = b.data ( ), *const pc = c.data ( ), *const pd = d.data ( );
+            for ( std::size_t i = 0; i < n; ++i )
+                pa[ i ] = pb[ i ] * pc[ i ] + pd[ i ];
+        }
+        else {
+            t.resize_reserve_only ( n );
+            std::transform ( b.begin ( ), b.end ( ), c.begin ( ), t.begin ( ), std::multiplies<> ( ) );
+            a.resize_reserve_only ( n );
+            std::transform ( t.begin ( ), t.end ( ), d.begin ( ), a.begin ( ), std::plus<> ( ) );
+        }
+        benchmark::DoNotOptimize ( a.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * 4u * n * sizeof ( float ) ) );
+}
+
+// reductions of state.range ( 0 ) values, by the pdr kernels or by the scalar loops (as in develop and test).
+
+enum class reduction { sum, dot, minmax };
+
+template<reduction R, typename Type, bool kernel>
+void bm_reduction ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    podder<Type> a, b;
+    for ( std::size_t i = 0; i < n; ++i ) {
+        a.emplace_back ( static_cast<Type> ( i * 7u % 251u ) );
+        b.emplace_back ( static_cast<Type> ( i % 13u ) );
+    }
+    for ( auto _ : state ) {
+        if constexpr ( R == reduction::sum ) {
+            if constexpr ( kernel ) {
+                benchmark::DoNotOptimize ( pdr::sum ( a ) );
+            }
+            else {
+                pdr::detail::sum_type<Type> s = 0;
+                for ( auto v : a )
+                    s += v;
+                benchmark::DoNotOptimize ( s );
+            }
+        }
+        else if constexpr ( R == reduction::dot ) {
+            if constexpr ( kernel ) {
+                benchmark::DoNotOptimize ( pdr::dot ( a, b ) );
+            }
+            else {
+                pdr::detail::sum_type<Type> s = 0;
+                for ( std::size_t i = 0; i < n; ++i )
+                    s += a[ i ] * b[ i ];
+                benchmark::DoNotOptimize ( s );
+            }
+        }
+        else {
+            if constexpr ( kernel ) {
+                benchmark::DoNotOptimize ( pdr::minmax ( a ) );
+            }
+            else {
+                Type lo = a[ 0 ], hi = a[ 0 ];
+                for ( auto v : a ) {
+                    lo = v < lo ? v : lo;
+                    hi = hi < v ? v : hi;
+                }
+                benchmark::DoNotOptimize ( lo );
+                benchmark::DoNotOptimize ( hi );
+            }
+        }
+    }
+    state.SetBytesProcessed (
+        static_cast<std::int64_t> ( state.iterations ( ) * n * sizeof ( Type ) * ( R == reduction::dot ? 2u : 1u ) ) );
+}
+
+// records of 3 columns, appended one by one ( state.range ( 0 ) of them), into a soa_podder or into 3 parallel podders.
+
+struct parallel_podders {
+    podder<float> a;
+    podder<std::uint32_t> b;
+    podder<double> c;
+
+    void emplace_back ( float const x, std::uint32_t const y, double const z ) noexcept {
+        a.emplace_back ( x );
+        b.emplace_back ( y );
+        c.emplace_back ( z );
+    }
+};
+
+template<typename Records>
+void bm_records ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    std::size_t aa = 0, ar = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( aa, ar );
+        Records r;
+        for ( std::size_t i = 0; i < n; ++i )
+            r.emplace_back ( static_cast<float> ( i ), static_cast<std::uint32_t> ( i ), static_cast<double> ( i ) );
+        benchmark::DoNotOptimize ( &r );
+    }
+    report ( state, aa, ar, n );
+}
+
+// fan-out, 8 copies of a read-mostly buffer handed to consumers that only read it.
+
+template<typename Container>
+void bm_fan_out ( benchmark::State & state ) noexcept {
+    std::size_t const n = static_cast<std::size_t> ( state.range ( 0 ) );
+    Container src;
+    for ( std::size_t i = 0; i < n; ++i )
+        src.push_back ( static_cast<std::uint8_t> ( i ) );
+    std::size_t a = 0, r = 0;
+    for ( auto _ : state ) {
+        allocation_scope const as ( a, r );
+        std::array<Container, 8> consumers{ src, src, src, src, src, src, src, src };
+        benchmark::DoNotOptimize ( consumers.data ( ) );
+        benchmark::ClobberMemory ( );
+    }
+    report ( state, a, r, 8u );
+}
+
+// bulk copies, memcpy against pdr::stream_copy (non-temporal stores) on buffers larger than the last level cache.
+
+inline void memcpy_copy ( void * dst, void const * src, std::size_t size ) noexcept { std::memcpy ( dst, src, size ); }
+
+struct buffers {
+    std::size_t const size;
+    char * const src;
+    char * const dst;
+
+    explicit buffers ( std::size_t const size_ ) noexcept :
+        size ( size_ ), src ( static_cast<char *> ( pdr::malloc ( size_ ) ) ), dst ( static_cast<char *> ( pdr::malloc ( size_ ) ) ) {
+        std::memset ( src, 1, size );
+        std::memset ( dst, 2, size );
+    }
+    ~buffers ( ) noexcept {
+        pdr::free ( dst );
+        pdr::free ( src );
+    }
+};
+
+template<void ( *Copy ) ( void *, void const *, std::size_t )>
+void bm_bulk_copy ( benchmark::State & state ) noexcept {
+    buffers const b ( static_cast<std::size_t> ( state.range ( 0 ) ) );
+    for ( auto _ : state ) {
+        Copy ( b.dst, b.src, b.size );
+        benchmark::ClobberMemory ( );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * b.size ) );
+}
+
+// the (timed) walk over a 1 MB working set following each (untimed) copy, slower if the copy evicted it.
+template<void ( *Copy ) ( void *, void const *, std::size_t )>
+void bm_working_set_after_copy ( benchmark::State & state ) noexcept {
+    buffers const b ( static_cast<std::size_t> ( state.range ( 0 ) ) );
+    std::vector<std::uint64_t> working_set ( 1'024u * 1'024u / sizeof ( std::uint64_t ), 1u );
     for ( auto _ : state ) {
         state.PauseTiming ( );
-        size_type const is =
-            sax::uniform_int_distribution<size_type> ( size_type{ 0 }, static_cast<size_type> ( state.range ( 0u ) - 1 ) ) ( gen );
-        Container data ( static_cast<size_type> ( is ) );
-        benchmark::DoNotOptimize ( data.data ( ) );
-        size_type i = sax::uniform_int_distribution<size_type> ( size_type{ 1 }, static_cast<size_type> (  state.range ( 0u ) - is ) ) ( gen );
+        Copy ( b.dst, b.src, b.size );
+        benchmark::ClobberMemory ( );
         state.ResumeTiming ( );
-        while ( i-- )
-            data.emplace_back ( static_cast<value_type> ( i ) );
-        benchmark::ClobberMemory ( );
-    }
-}
-
-#include <pector/pector.h>
-#include <pector/malloc_allocator.h>
-#include <pector/mimalloc_allocator.h>
-
-template<typename T, typename S>
-using alpector = pt::pector<T, std::allocator<T>, S, pt::default_recommended_size, false>;
-template<typename T, typename S>
-using mapector = pt::pector<T, pt::malloc_allocator<T, true, false>, S, pt::default_recommended_size, false>;
-template<typename T, typename S>
-using mipector = pt::pector<T, pt::mimalloc_allocator<T, true, false>, S, pt::default_recommended_size, false>;
-
-/*
-BENCHMARK_TEMPLATE ( bm_emplace_back_random, std::vector<std::uint8_t> )
-    ->Apply ( custom_arguments<std::uint8_t> )
-    ->Repetitions ( 4 )
-    ->ReportAggregatesOnly ( true );
-*/
-
-using size_type = std::uint64_t;
-
-BENCHMARK_TEMPLATE ( bm_emplace_back_random, alpector<std::uint8_t, size_type> )
-    ->Apply ( custom_arguments<std::uint8_t> )
-    ->Repetitions ( 4 )
-    ->ReportAggregatesOnly ( true );
-BENCHMARK_TEMPLATE ( bm_emplace_back_random, mapector<std::uint8_t, size_type> )
-    ->Apply ( custom_arguments<std::uint8_t> )
-    ->Repetitions ( 4 )
-    ->ReportAggregatesOnly ( true );
-BENCHMARK_TEMPLATE ( bm_emplace_back_random, mipector<std::uint8_t, size_type> )
-    ->Apply ( custom_arguments<std::uint8_t> )
-    ->Repetitions ( 4 )
-    ->ReportAggregatesOnly ( true );
-
-/*
-BENCHMARK_TEMPLATE ( bm_emplace_back_random, podder<std::uint8_t, size_type> )
-    ->Apply ( custom_arguments<std::uint8_t> )
-    ->Repetitions ( 4 )
-    ->ReportAggregatesOnly ( true );
-*/
+        std::uint64_t sum = 0;
+        for ( std::uint64_t const v : working_set )
+            sum += v;
+        benchmark::DoNotOptimize ( sum );
+    }
+    state.SetBytesProcessed ( static_cast<std::int64_t> ( state.iterations ( ) * working_set.size ( ) * sizeof ( std::uint64_t ) ) );
+}
+
+void bulk_copy_arguments ( benchmark::internal::Benchmark * b ) { // 8 MB - 1 GB.
+    for ( std::int64_t s = std::int64_t{ 8 } << 20; s <= std::int64_t{ 1 } << 30; s *= 8 )
+        b->Arg ( s );
+    b->Arg ( std::int64_t{ 1 } << 30 );
+}
+
+void prefix_arguments ( benchmark::internal::Benchmark * b ) { // 16 B - 1 MB.
+    b->RangeMultiplier ( 8 )->Range ( 16, 1 << 20 );
+}
+
+// arguments, sizes around the svo-boundary and some larger ones.
+
+template<typename ValueType>
+void linear_arguments ( benchmark::internal::Benchmark * b ) {
+    std::size_t const bs = podder<ValueType>::svo_capacity ( );
+    std::set<std::size_t> sizes{ 1u, 32u, 256u, 4'096u, 65'536u };
+    if ( bs ) {
+        sizes.insert ( { bs > 1u ? bs - 1u : 1u, bs, bs + 1u, 2u * bs + 2u } );
+    }
+    for ( std::size_t const s : sizes )
+        b->Arg ( static_cast<std::int64_t> ( s ) );
+}
+
+template<typename ValueType>
+void quadratic_arguments ( benchmark::internal::Benchmark * b ) { // O ( n^2 ) benchmarks, insert and erase.
+    std::size_t const bs = podder<ValueType>::svo_capacity ( );
+    std::set<std::size_t> sizes{ 1u, 32u, 256u, 4'096u };
+    if ( bs ) {
+        sizes.insert ( { bs > 1u ? bs - 1u : 1u, bs, bs + 1u, 2u * bs + 2u } );
+    }
+    for ( std::size_t const s : sizes )
+        b->Arg ( static_cast<std::int64_t> ( s ) );
+}
+
+// registration.
+
+template<typename Container>
+void register_container ( std::string const & name, void ( *args ) ( benchmark::internal::Benchmark * ),
+                          void ( *quadratic_args ) ( benchmark::internal::Benchmark * ) ) {
+    benchmark::RegisterBenchmark ( ( "construct/" + name ).c_str ( ), bm_construct<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "copy/" + name ).c_str ( ), bm_copy<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "move/" + name ).c_str ( ), bm_move<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "assign/" + name ).c_str ( ), bm_assign<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "emplace_back/" + name ).c_str ( ), bm_emplace_back<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "insert/" + name ).c_str ( ), bm_insert<Container> )->Apply ( quadratic_args );
+    benchmark::RegisterBenchmark ( ( "insert_range/front/" + name ).c_str ( ), bm_insert_range<Container, at::front> )
+        ->Apply ( quadratic_args );
+    benchmark::RegisterBenchmark ( ( "insert_range/middle/" + name ).c_str ( ), bm_insert_range<Container, at::middle> )
+        ->Apply ( quadratic_args );
+    benchmark::RegisterBenchmark ( ( "insert_range/back/" + name ).c_str ( ), bm_insert_range<Container, at::back> )
+        ->Apply ( quadratic_args );
+    benchmark::RegisterBenchmark ( ( "erase/" + name ).c_str ( ), bm_erase<Container> )->Apply ( quadratic_args );
+    benchmark::RegisterBenchmark ( ( "unordered_erase/" + name ).c_str ( ), bm_unordered_erase<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "resize/" + name ).c_str ( ), bm_resize<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "reserve/" + name ).c_str ( ), bm_reserve<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "equal/" + name ).c_str ( ), bm_equal<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "less/" + name ).c_str ( ), bm_less<Container> )->Apply ( args );
+    benchmark::RegisterBenchmark ( ( "iterate/" + name ).c_str ( ), bm_iterate<Container> )->Apply ( args );
+}
+
+template<typename ValueType>
+void register_value_type ( std::string const & name ) {
+    register_container<podder<ValueType>> ( "podder<" + name + ">", linear_arguments<ValueType>,
+                                            quadratic_arguments<ValueType> );
+    register_container<std::vector<ValueType>> ( "vector<" + name + ">", linear_arguments<ValueType>,
+                                                 quadratic_arguments<ValueType> );
+}
+
+void register_all ( ) {
+    register_value_type<std::uint8_t> ( "u8" );
+    register_value_type<std::uint16_t> ( "u16" );
+    register_value_type<std::uint32_t> ( "u32" );
+    register_value_type<std::uint64_t> ( "u64" );
+    register_value_type<pod<16>> ( "pod16" );
+    register_value_type<pod<32>> ( "pod32" );
+    register_value_type<pod<64>> ( "pod64" );
+    benchmark::RegisterBenchmark ( "less_prefix/podder<u8>", bm_less_prefix<podder<std::uint8_t>> )->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "less_prefix/vector<u8>", bm_less_prefix<std::vector<std::uint8_t>> )->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "less_prefix/podder<i32>", bm_less_prefix<podder<std::int32_t>> )->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "less_prefix/vector<i32>", bm_less_prefix<std::vector<std::int32_t>> )->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "less_prefix/podder<f64>", bm_less_prefix<podder<double>> )->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "less_prefix/vector<f64>", bm_less_prefix<std::vector<double>> )->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "less_prefix_by_key/podder<pod16>", bm_less_prefix_by_key<podder<pod<16>>> )
+        ->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "less_prefix_by_key/vector<pod16>", bm_less_prefix_by_key<std::vector<pod<16>>> )
+        ->Apply ( prefix_arguments );
+    benchmark::RegisterBenchmark ( "hash/podder<u8>", bm_hash<podder<std::uint8_t>> )->Apply ( linear_arguments<std::uint8_t> );
+    benchmark::RegisterBenchmark ( "hash/vector<u8>", bm_hash<std::vector<std::uint8_t>> )->Apply ( linear_arguments<std::uint8_t> );
+    benchmark::RegisterBenchmark ( "corpus/copy", bm_corpus_copy );
+    benchmark::RegisterBenchmark ( "corpus/intern", bm_corpus_intern );
+    benchmark::RegisterBenchmark ( "string_copy/pstring", bm_string_copy<pdr::pstring> );
+    benchmark::RegisterBenchmark ( "string_copy/string", bm_string_copy<std::string> );
+    benchmark::RegisterBenchmark ( "string_find/pstring", bm_string_find<pdr::pstring> )->RangeMultiplier ( 8 )->Range ( 64, 1 << 15 );
+    benchmark::RegisterBenchmark ( "string_find/string", bm_string_find<std::string> )->RangeMultiplier ( 8 )->Range ( 64, 1 << 15 );
+    benchmark::RegisterBenchmark ( "string_split/pstring", bm_string_split<pdr::pstring> );
+    benchmark::RegisterBenchmark ( "string_split/string", bm_string_split<std::string> );
+    benchmark::RegisterBenchmark ( "filter_count/bit_podder", bm_filter_count<pdr::bit_podder<>> )->RangeMultiplier ( 16 )->Range ( 1 << 12, 1 << 24 );
+    benchmark::RegisterBenchmark ( "filter_count/podder<bool>", bm_filter_count<podder<bool>> )->RangeMultiplier ( 16 )->Range ( 1 << 12, 1 << 24 );
+    benchmark::RegisterBenchmark ( "filter_and/bit_podder", bm_filter_and<pdr::bit_podder<>> )->RangeMultiplier ( 16 )->Range ( 1 << 12, 1 << 24 );
+    benchmark::RegisterBenchmark ( "filter_and/podder<bool>", bm_filter_and<podder<bool>> )->RangeMultiplier ( 16 )->Range ( 1 << 12, 1 << 24 );
+    benchmark::RegisterBenchmark ( "edits/gap_podder<char>", bm_edits<pdr::gap_podder<char>> )->RangeMultiplier ( 16 )->Range ( 256, 1 << 20 );
+    benchmark::RegisterBenchmark ( "edits/podder<char>", bm_edits<podder_text> )->RangeMultiplier ( 16 )->Range ( 256, 1 << 20 );
+    benchmark::RegisterBenchmark ( "random_insert/rope_podder<u32>", bm_random_insert<pdr::rope_podder<std::uint32_t>> )
+        ->RangeMultiplier ( 16 )
+        ->Range ( 1 << 12, 1 << 24 );
+    benchmark::RegisterBenchmark ( "random_insert/podder<u32>", bm_random_insert<podder_sequence> )->RangeMultiplier ( 16 )->Range ( 1 << 12, 1 << 24 );
+    benchmark::RegisterBenchmark ( "append/segmented_podder<u64>", bm_append<pdr::segmented_podder<std::uint64_t>> )
+        ->RangeMultiplier ( 16 )
+        ->Range ( 1 << 8, 1 << 24 );
+    benchmark::RegisterBenchmark ( "append/podder<u64>", bm_append<podder<std::uint64_t>> )->RangeMultiplier ( 16 )->Range ( 1 << 8, 1 << 24 );
+    benchmark::RegisterBenchmark ( "fill/podder<u32>", bm_fill<podder<std::uint32_t>> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 26 );
+    benchmark::RegisterBenchmark ( "fill/vector<u32>", bm_fill<std::vector<std::uint32_t>> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 26 );
+    benchmark::RegisterBenchmark ( "fill/podder<pod16>", bm_fill<podder<pod<16>>> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 24 );
+    benchmark::RegisterBenchmark ( "fill/vector<pod16>", bm_fill<std::vector<pod<16>>> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 24 );
+    benchmark::RegisterBenchmark ( "iota/podder<u32>", bm_iota<podder<std::uint32_t>> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 26 );
+    benchmark::RegisterBenchmark ( "iota/vector<u32>", bm_iota<std::vector<std::uint32_t>> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 26 );
+    benchmark::RegisterBenchmark ( "expression/fused", bm_expression<evaluation::fused> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 24 );
+    benchmark::RegisterBenchmark ( "expression/loop", bm_expression<evaluation::loop> )->RangeMultiplier ( 32 )->Range ( 1 << 6, 1 << 24 );
+    benchmark::RegisterBenchmark ( "expression/temporaries", bm_expression<evaluation::temporaries> )
+        ->RangeMultiplier ( 32 )
+        ->Range ( 1 << 6, 1 << 24 );
+    benchmark::RegisterBenchmark ( "sum/pdr<u8>", bm_reduction<reduction::sum, std::uint8_t, true> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "sum/loop<u8>", bm_reduction<reduction::sum, std::uint8_t, false> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "sum/pdr<i32>", bm_reduction<reduction::sum, std::int32_t, true> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "sum/loop<i32>", bm_reduction<reduction::sum, std::int32_t, false> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "sum/pdr<f32>", bm_reduction<reduction::sum, float, true> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "sum/loop<f32>", bm_reduction<reduction::sum, float, false> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "dot/pdr<f32>", bm_reduction<reduction::dot, float, true> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "dot/loop<f32>", bm_reduction<reduction::dot, float, false> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "dot/pdr<i16>", bm_reduction<reduction::dot, std::int16_t, true> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "dot/loop<i16>", bm_reduction<reduction::dot, std::int16_t, false> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "minmax/pdr<i32>", bm_reduction<reduction::minmax, std::int32_t, true> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "minmax/loop<i32>", bm_reduction<reduction::minmax, std::int32_t, false> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "minmax/pdr<f32>", bm_reduction<reduction::minmax, float, true> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "minmax/loop<f32>", bm_reduction<reduction::minmax, float, false> )->RangeMultiplier ( 32 )->Range ( 1 << 10, 1 << 25 );
+    benchmark::RegisterBenchmark ( "records/soa_podder<f32,u32,f64>", bm_records<pdr::soa_podder<float, std::uint32_t, double>> )
+        ->RangeMultiplier ( 32 )
+        ->Range ( 32, 1 << 20 );
+    benchmark::RegisterBenchmark ( "records/3 podders", bm_records<parallel_podders> )->RangeMultiplier ( 32 )->Range ( 32, 1 << 20 );
+    benchmark::RegisterBenchmark ( "fifo/podder<u32>", bm_fifo<podder<std::uint32_t>> )->RangeMultiplier ( 8 )->Range ( 8, 1 << 18 );
+    benchmark::RegisterBenchmark ( "fifo/deque<u32>", bm_fifo<std::deque<std::uint32_t>> )->RangeMultiplier ( 8 )->Range ( 8, 1 << 18 );
+    benchmark::RegisterBenchmark ( "messages/spsc_ring<u64>", bm_messages<ring_queue<pdr::spsc_ring<std::uint64_t>>> )
+        ->Arg ( 1 )
+        ->UseRealTime ( );
+    benchmark::RegisterBenchmark ( "messages/mpsc_ring<u64>", bm_messages<ring_queue<pdr::mpsc_ring<std::uint64_t>>> )
+        ->DenseRange ( 1, 4 )
+        ->UseRealTime ( );
+    benchmark::RegisterBenchmark ( "messages/mutex+podder<u64>", bm_messages<locked_podder_queue> )->DenseRange ( 1, 4 )->UseRealTime ( );
+    benchmark::RegisterBenchmark ( "round_trip/spsc_ring<u64>", bm_ring_round_trip )->UseRealTime ( );
+    benchmark::RegisterBenchmark ( "traversal/ws_deque<u32>", bm_traversal<ws_deque_list> )->RangeMultiplier ( 2 )->Range ( 1, 4 )->UseRealTime ( );
+    benchmark::RegisterBenchmark ( "traversal/mutex+podder<u32>", bm_traversal<locked_podder_list> )
+        ->RangeMultiplier ( 2 )
+        ->Range ( 1, 4 )
+        ->UseRealTime ( );
+    benchmark::RegisterBenchmark ( "fan_out/podder<u8>", bm_fan_out<podder<std::uint8_t>> )->RangeMultiplier ( 16 )->Range ( 16, 16 << 20 );
+    benchmark::RegisterBenchmark ( "fan_out/cow_podder<u8>", bm_fan_out<pdr::cow_podder<std::uint8_t>> )
+        ->RangeMultiplier ( 16 )
+        ->Range ( 16, 16 << 20 );
+    benchmark::RegisterBenchmark ( "bulk_copy/memcpy", bm_bulk_copy<memcpy_copy> )->Apply ( bulk_copy_arguments );
+    benchmark::RegisterBenchmark ( "bulk_copy/stream_copy", bm_bulk_copy<pdr::stream_copy> )->Apply ( bulk_copy_arguments );
+    benchmark::RegisterBenchmark ( "working_set_after_copy/memcpy", bm_working_set_after_copy<memcpy_copy> )
+        ->Apply ( bulk_copy_arguments );
+    benchmark::RegisterBenchmark ( "working_set_after_copy/stream_copy", bm_working_set_after_copy<pdr::stream_copy> )
+        ->Apply ( bulk_copy_arguments );
+}
+
+// replay, --replay=<file> registers (only) emplace_back workloads following the final sizes recorded in
+// a pdr::profile dump, for podder (with a few growth policies) and std::vector.
+
+// up to 1'024 final sizes, in proportion to their counts.
+[[nodiscard]] std::vector<std::size_t> replay_sizes ( pdr::profile::entry const & e ) {
+    std::uint64_t const samples = e.samples ( );
+    std::vector<std::size_t> sizes;
+    for ( auto const & [ s, c ] : e.sizes ) {
+        std::uint64_t const n = std::max ( std::uint64_t{ 1 }, c * 1'024u / samples );
+        sizes.insert ( sizes.end ( ), static_cast<std::size_t> ( n ), static_cast<std::size_t> ( s ) );
+    }
+    return sizes;
+}
+
+template<typename ValueType>
+void register_replay ( std::string const & name, pdr::profile::entry const & e ) {
+    std::vector<std::size_t> const sizes = replay_sizes ( e );
+    std::string const prefix             = "replay/" + e.tag + "/";
+    benchmark::RegisterBenchmark ( ( prefix + "podder<" + name + ">" ).c_str ( ), bm_replay<podder<ValueType>>, sizes );
+    benchmark::RegisterBenchmark ( ( prefix + "podder<" + name + ", ratio 2>" ).c_str ( ),
+                                   bm_replay<podder<ValueType, std::size_t, ratio_growth_policy<std::ratio<2, 1>>>>, sizes );
+    benchmark::RegisterBenchmark ( ( prefix + "podder<" + name + ", golden ratio>" ).c_str ( ),
+                                   bm_replay<podder<ValueType, std::size_t, golden_ratio_growth_policy<>>>, sizes );
+    benchmark::RegisterBenchmark ( ( prefix + "vector<" + name + ">" ).c_str ( ), bm_replay<std::vector<ValueType>>, sizes );
+}
+
+[[nodiscard]] bool register_replays ( char const * path ) {
+    std::ifstream in ( path );
+    std::vector<pdr::profile::entry> const entries = pdr::profile::read ( in );
+    if ( entries.empty ( ) ) {
+        std::cerr << "no podder profile in " << path << '\n';
+        return false;
+    }
+    pdr::profile::print ( std::cout, pdr::profile::recommend ( entries ) );
+    for ( pdr::profile::entry const & e : entries ) {
+        switch ( e.value_size ) {
+            case 1: register_replay<std::uint8_t> ( "u8", e ); break;
+            case 2: register_replay<std::uint16_t> ( "u16", e ); break;
+            case 4: register_replay<std::uint32_t> ( "u32", e ); break;
+            case 8: register_replay<std::uint64_t> ( "u64", e ); break;
+            case 16: register_replay<pod<16>> ( "pod16", e ); break;
+            case 32: register_replay<pod<32>> ( "pod32", e ); break;
+            default: register_replay<pod<64>> ( "pod64", e ); break; // any other size.
+        }
+    }
+    return true;
+}
+
+} // namespace bm
+
+int main ( int argc, char ** argv ) {
+    char const * replay = nullptr;
+    for ( int i = 1; i < argc; ++i ) { // strip --replay=<file>, before benchmark sees it.
+        if ( std::string_view ( argv[ i ] ).rfind ( "--replay=", 0 ) == 0 ) {
+            replay = argv[ i ] + 9;
+            std::copy ( argv + i + 1, argv + argc, argv + i );
+            --argc;
+            --i;
+        }
+    }
+    if ( replay ) {
+        if ( not bm::register_replays ( replay ) )
+            return EXIT_FAILURE;
+    }
+    else {
+        bm::register_all ( );
+    }
+    benchmark::Initialize ( &argc, argv );
+    if ( benchmark::ReportUnrecognizedArguments ( argc, argv ) )
+        return EXIT_FAILURE;
+    benchmark::RunSpecifiedBenchmarks ( );
+    benchmark::Shutdown ( );
+    return EXIT_SUCCESS;
+}
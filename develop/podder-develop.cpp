@@ -54,21 +54,13 @@
 #include <sax/uniform_int_distribution.hpp>
 
 #include "podder.hpp"
+#include "podder/reduce.hpp"
 
 inline std::uint32_t pointer_alignment ( const void * p_ ) {
 
     return ( std::uint32_t ) ( ( std::uint64_t ) p_ & ( std::uint64_t ) - ( ( std::int64_t ) p_ ) );
 }
 
-template<typename T, typename = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
-std::uint64_t sum ( podder<T> & p ) noexcept {
-    std::uint64_t sum = 0;
-    for ( auto v : p ) {
-        sum += static_cast<std::uint64_t> ( v );
-    }
-    return sum;
-}
-
 template<typename T, typename = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
 constexpr T sum2n ( const T n_ ) noexcept {
     return ( n_ * ( n_ + 1 ) ) / T ( 2 );
@@ -162,18 +154,18 @@ bool podder_range_constructor_container_test ( ) {
     Container v1{ 1, 2, 3, 4, 5 }; // 15
     podder<typename Container::value_type> p1 ( v1.begin ( ), v1.end ( ) );
 
-    a += sum ( p1 );
+    a += pdr::sum ( p1 );
 
     Container v2 = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }; // 120
     podder<typename Container::value_type> p2 ( v2.begin ( ), v2.end ( ) );
 
-    a += sum ( p2 );
+    a += pdr::sum ( p2 );
 
     Container v3 = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
                      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }; // 480
     podder<typename Container::value_type> p3 ( v3.begin ( ), v3.end ( ) );
 
-    a += sum ( p3 );
+    a += pdr::sum ( p3 );
 
     return a == sum2n ( 5u ) + sum2n ( 15u ) + 480;
 }
@@ -210,63 +202,63 @@ bool podder_insert_test ( ) {
         p1.insert ( p1.end ( ), 6 );
         std::uint16_t val = 4;
         p1.insert ( p1.begin ( ) + 3, val );
-        a += sum ( p1 );
+        a += pdr::sum ( p1 );
 
         podder<std::uint16_t> p2{ 2, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
         p2.insert ( p2.end ( ), 16 );
         p2.insert ( p2.begin ( ), 1 );
         p2.insert ( p2.begin ( ) + 3, val );
-        a += sum ( p2 );
+        a += pdr::sum ( p2 );
     }
     // iterator insert ( const_iterator pos, size_type count, const_reference value )
     {
         podder<std::uint16_t> p3{ 1, 2, 3, 4, 5 };
         p3.insert ( p3.begin ( ), 4, 1 );
-        a += sum ( p3 );
+        a += pdr::sum ( p3 );
 
         podder<std::uint16_t> p4{ 1, 2, 3, 4, 5 };
         p4.insert ( p4.end ( ), 4, 1 );
-        a += sum ( p4 );
+        a += pdr::sum ( p4 );
 
         podder<std::uint16_t> p5{ 1, 2, 3, 4, 5 };
         p5.insert ( &p5[ 3 ], 4, 1 );
-        a += sum ( p5 );
+        a += pdr::sum ( p5 );
 
         podder<std::uint16_t> p6{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p6.insert ( p6.begin ( ), 4, 1 );
-        a += sum ( p6 );
+        a += pdr::sum ( p6 );
 
         podder<std::uint16_t> p7{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p7.insert ( p7.end ( ), 4, 1 );
-        a += sum ( p7 );
+        a += pdr::sum ( p7 );
 
         podder<std::uint16_t> p8{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p8.insert ( &p8[ 3 ], 4, 1 );
-        a += sum ( p8 );
+        a += pdr::sum ( p8 );
 
         podder<std::uint16_t> p9{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p9.insert ( p9.begin ( ), 4, 1 );
-        a += sum ( p9 );
+        a += pdr::sum ( p9 );
 
         podder<std::uint16_t> p10{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p10.insert ( p10.end ( ), 4, 1 );
-        a += sum ( p10 );
+        a += pdr::sum ( p10 );
 
         podder<std::uint16_t> p11{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p11.insert ( &p11[ 3 ], 4, 1 );
-        a += sum ( p11 );
+        a += pdr::sum ( p11 );
 
         podder<std::uint16_t> p12{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p12.insert ( p12.begin ( ), 4, 1 );
-        a += sum ( p12 );
+        a += pdr::sum ( p12 );
 
         podder<std::uint16_t> p13{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p13.insert ( p13.end ( ), 4, 1 );
-        a += sum ( p13 );
+        a += pdr::sum ( p13 );
 
         podder<std::uint16_t> p14{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p14.insert ( &p14[ 3 ], 4, 1 );
-        a += sum ( p14 );
+        a += pdr::sum ( p14 );
     }
     // iterator insert ( const_iterator pos, InputIt first, InputIt last ) ( contiguous )
 
@@ -274,51 +266,51 @@ bool podder_insert_test ( ) {
     {
         podder<std::uint16_t> p15{ 1, 2, 3, 4, 5 };
         p15.insert ( p15.begin ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p15 );
+        a += pdr::sum ( p15 );
 
         podder<std::uint16_t> p16{ 1, 2, 3, 4, 5 };
         p16.insert ( p16.end ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p16 );
+        a += pdr::sum ( p16 );
 
         podder<std::uint16_t> p17{ 1, 2, 3, 4, 5 };
         p17.insert ( &p17[ 3 ], vec.begin ( ), vec.end ( ) );
-        a += sum ( p17 );
+        a += pdr::sum ( p17 );
 
         podder<std::uint16_t> p18{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p18.insert ( p18.begin ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p18 );
+        a += pdr::sum ( p18 );
 
         podder<std::uint16_t> p19{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p19.insert ( p19.end ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p19 );
+        a += pdr::sum ( p19 );
 
         podder<std::uint16_t> p20{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p20.insert ( &p20[ 3 ], vec.begin ( ), vec.end ( ) );
-        a += sum ( p20 );
+        a += pdr::sum ( p20 );
 
         podder<std::uint16_t> p21{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p21.insert ( p21.begin ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p21 );
+        a += pdr::sum ( p21 );
 
         podder<std::uint16_t> p22{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p22.insert ( p22.end ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p22 );
+        a += pdr::sum ( p22 );
 
         podder<std::uint16_t> p23{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p23.insert ( &p23[ 3 ], vec.begin ( ), vec.end ( ) );
-        a += sum ( p23 );
+        a += pdr::sum ( p23 );
 
         podder<std::uint16_t> p24{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p24.insert ( p24.begin ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p24 );
+        a += pdr::sum ( p24 );
 
         podder<std::uint16_t> p25{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p25.insert ( p25.end ( ), vec.begin ( ), vec.end ( ) );
-        a += sum ( p25 );
+        a += pdr::sum ( p25 );
 
         podder<std::uint16_t> p26{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p26.insert ( &p26[ 3 ], vec.begin ( ), vec.end ( ) );
-        a += sum ( p26 );
+        a += pdr::sum ( p26 );
     }
     // iterator insert ( const_iterator pos, InputIt first, InputIt last ) ( discontiguous )
 
@@ -326,54 +318,54 @@ bool podder_insert_test ( ) {
     {
         podder<std::uint16_t> p27{ 1, 2, 3, 4, 5 };
         p27.insert ( p27.begin ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p27 );
+        a += pdr::sum ( p27 );
 
         podder<std::uint16_t> p28{ 1, 2, 3, 4, 5 };
         p28.insert ( p28.end ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p28 );
+        a += pdr::sum ( p28 );
 
         podder<std::uint16_t> p29{ 1, 2, 3, 4, 5 };
         p29.insert ( &p29[ 3 ], deq.begin ( ), deq.end ( ) );
-        a += sum ( p29 );
+        a += pdr::sum ( p29 );
     }
     {
         podder<std::uint16_t> p30{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p30.insert ( p30.begin ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p30 );
+        a += pdr::sum ( p30 );
 
         podder<std::uint16_t> p31{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p31.insert ( p31.end ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p31 );
+        a += pdr::sum ( p31 );
 
         podder<std::uint16_t> p32{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         p32.insert ( &p32[ 3 ], deq.begin ( ), deq.end ( ) );
-        a += sum ( p32 );
+        a += pdr::sum ( p32 );
     }
     {
         podder<std::uint16_t> p33{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p33.insert ( p33.begin ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p33 );
+        a += pdr::sum ( p33 );
 
         podder<std::uint16_t> p34{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p34.insert ( p34.end ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p34 );
+        a += pdr::sum ( p34 );
 
         podder<std::uint16_t> p35{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
         p35.insert ( &p35[ 3 ], deq.begin ( ), deq.end ( ) );
-        a += sum ( p35 );
+        a += pdr::sum ( p35 );
     }
     {
         podder<std::uint16_t> p36{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p36.insert ( p36.begin ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p36 );
+        a += pdr::sum ( p36 );
 
         podder<std::uint16_t> p37{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p37.insert ( p37.end ( ), deq.begin ( ), deq.end ( ) );
-        a += sum ( p37 );
+        a += pdr::sum ( p37 );
 
         podder<std::uint16_t> p38{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
         p38.insert ( &p38[ 3 ], deq.begin ( ), deq.end ( ) );
-        a += sum ( p38 );
+        a += pdr::sum ( p38 );
     }
     return a ==
            sum2n ( 6u ) + sum2n ( 16u ) +
@@ -0,0 +1,369 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#if defined( __AVX2__ ) or defined( __SSE2__ ) or defined( _M_X64 )
+#    include <immintrin.h>
+#endif
+#if defined( _MSC_VER ) and not defined( __clang__ )
+#    include <intrin.h>
+#endif
+
+#include "podder.hpp"
+
+namespace pdr {
+
+namespace detail {
+
+[[nodiscard]] inline unsigned popcount ( std::uint64_t const w ) noexcept {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+    return static_cast<unsigned> ( __popcnt64 ( w ) );
+#else
+    return static_cast<unsigned> ( __builtin_popcountll ( w ) );
+#endif
+}
+
+[[nodiscard]] inline unsigned ctz64 ( std::uint64_t const w ) noexcept {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+    unsigned long i;
+    _BitScanForward64 ( &i, w );
+    return static_cast<unsigned> ( i );
+#else
+    return static_cast<unsigned> ( __builtin_ctzll ( w ) );
+#endif
+}
+
+// the position of the k-th (0-based) set bit of w.
+[[nodiscard]] inline unsigned select64 ( std::uint64_t w, unsigned k ) noexcept {
+#if defined( __BMI2__ )
+    return ctz64 ( _pdep_u64 ( std::uint64_t{ 1 } << k, w ) );
+#else
+    for ( ; k; --k )
+        w &= w - 1u;
+    return ctz64 ( w );
+#endif
+}
+
+enum class bit_op { and_, or_, xor_, and_not };
+
+template<bit_op Op>
+[[nodiscard]] inline std::uint64_t apply ( std::uint64_t const a, std::uint64_t const b ) noexcept {
+    if constexpr ( Op == bit_op::and_ )
+        return a & b;
+    else if constexpr ( Op == bit_op::or_ )
+        return a | b;
+    else if constexpr ( Op == bit_op::xor_ )
+        return a ^ b;
+    else
+        return a & ~b;
+}
+
+// dst = dst op src, over size bytes.
+template<bit_op Op>
+inline void bitwise ( std::uint8_t * dst, std::uint8_t const * src, std::size_t const size ) noexcept {
+    std::size_t i = 0;
+#if defined( __AVX2__ )
+    for ( ; i + 32u <= size; i += 32u ) {
+        __m256i const a = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( dst + i ) );
+        __m256i const b = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( src + i ) );
+        __m256i r;
+        if constexpr ( Op == bit_op::and_ )
+            r = _mm256_and_si256 ( a, b );
+        else if constexpr ( Op == bit_op::or_ )
+            r = _mm256_or_si256 ( a, b );
+        else if constexpr ( Op == bit_op::xor_ )
+            r = _mm256_xor_si256 ( a, b );
+        else
+            r = _mm256_andnot_si256 ( b, a );
+        _mm256_storeu_si256 ( reinterpret_cast<__m256i *> ( dst + i ), r );
+    }
+#endif
+#if defined( __SSE2__ ) or defined( _M_X64 )
+    for ( ; i + 16u <= size; i += 16u ) {
+        __m128i const a = _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( dst + i ) );
+        __m128i const b = _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( src + i ) );
+        __m128i r;
+        if constexpr ( Op == bit_op::and_ )
+            r = _mm_and_si128 ( a, b );
+        else if constexpr ( Op == bit_op::or_ )
+            r = _mm_or_si128 ( a, b );
+        else if constexpr ( Op == bit_op::xor_ )
+            r = _mm_xor_si128 ( a, b );
+        else
+            r = _mm_andnot_si128 ( b, a );
+        _mm_storeu_si128 ( reinterpret_cast<__m128i *> ( dst + i ), r );
+    }
+#endif
+    for ( ; i < size; ++i )
+        dst[ i ] = static_cast<std::uint8_t> ( apply<Op> ( dst[ i ], src[ i ] ) );
+}
+
+} // namespace detail
+
+// A packed bit vector on podder<std::uint8_t> storage, i.e. 184 bits inline (as against 23 for podder<bool>), and
+// processed in (unaligned) 64 bit words. The bits past size ( ) in the last byte are kept zero.
+template<typename SizeType = std::size_t, typename GrowthPolicy = visual_studio_growth_policy<SizeType>>
+class bit_podder {
+
+    public:
+    using size_type   = SizeType;
+    using podder_type = podder<std::uint8_t, SizeType, GrowthPolicy>;
+
+    static constexpr size_type npos = std::numeric_limits<size_type>::max ( );
+
+    private:
+    podder_type b; // ceil ( n / 8 ) bytes.
+    size_type n = 0;
+
+    [[nodiscard]] static constexpr size_type bytes_for ( size_type const bits ) noexcept { return ( bits + 7u ) / 8u; }
+
+    public:
+    // the i-th 64 bit word (zero-extended at the end).
+    [[nodiscard]] std::uint64_t word ( size_type const i ) const noexcept {
+        std::size_t const o = std::size_t{ i } * 8u, s = b.size ( );
+        std::uint64_t w     = 0;
+        std::memcpy ( &w, b.data ( ) + o, std::min<std::size_t> ( 8u, s - o ) );
+#if defined( __BYTE_ORDER__ ) and __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        w = __builtin_bswap64 ( w );
+#endif
+        return w;
+    }
+    [[nodiscard]] size_type word_count ( ) const noexcept { return ( n + 63u ) / 64u; }
+
+    private:
+    void clear_tail ( ) noexcept { // zero the bits past n in the last byte.
+        if ( n % 8u )
+            b.back ( ) &= static_cast<std::uint8_t> ( ( 1u << ( n % 8u ) ) - 1u );
+    }
+
+    template<detail::bit_op Op>
+    bit_podder & bitwise ( bit_podder const & rhs ) noexcept {
+        assert ( size ( ) == rhs.size ( ) );
+        detail::bitwise<Op> ( b.data ( ), rhs.b.data ( ), std::min ( b.size ( ), rhs.b.size ( ) ) );
+        return *this;
+    }
+
+    public:
+    bit_podder ( ) noexcept = default;
+    explicit bit_podder ( size_type const count, bool const value = false ) noexcept { resize ( count, value ); }
+
+    [[nodiscard]] size_type size ( ) const noexcept { return n; }
+    [[nodiscard]] bool empty ( ) const noexcept { return not n; }
+    [[nodiscard]] size_type capacity ( ) const noexcept { return b.capacity ( ) * 8u; }
+    [[nodiscard]] static constexpr size_type svo_capacity ( ) noexcept { return podder_type::svo_capacity ( ) * 8u; }
+    [[nodiscard]] size_type size_in_bytes ( ) const noexcept { return b.size ( ); }
+    [[nodiscard]] std::uint8_t const * data ( ) const noexcept { return b.data ( ); }
+
+    void reserve ( size_type const bits ) noexcept { b.reserve ( bytes_for ( bits ) ); }
+
+    void clear ( ) noexcept {
+        b.clear ( );
+        n = 0;
+    }
+
+    void resize ( size_type const bits, bool const value = false ) noexcept {
+        size_type const old = n;
+        if ( bits > old and value and old % 8u ) // the rest of the last byte.
+            b.back ( ) |= static_cast<std::uint8_t> ( 0xFFu << ( old % 8u ) );
+        size_type const s0 = b.size ( ), s1 = bytes_for ( bits );
+        if ( s1 > s0 )
+            b.insert ( b.end ( ), s1 - s0, value ? std::uint8_t{ 0xFF } : std::uint8_t{ 0 } );
+        else
+            b.resize ( s1 );
+        n = bits;
+        clear_tail ( );
+    }
+
+    void push_back ( bool const value ) noexcept {
+        if ( not( n % 8u ) )
+            b.emplace_back ( std::uint8_t{ 0 } );
+        if ( value )
+            b.back ( ) |= static_cast<std::uint8_t> ( 1u << ( n % 8u ) );
+        ++n;
+    }
+    void pop_back ( ) noexcept {
+        assert ( n );
+        --n;
+        if ( not( n % 8u ) )
+            b.pop_back ( );
+        else
+            clear_tail ( );
+    }
+
+    // single bits.
+
+    [[nodiscard]] bool test ( size_type const i ) const noexcept {
+        assert ( i < n );
+        return ( b[ i / 8u ] >> ( i % 8u ) ) & 1u;
+    }
+    [[nodiscard]] bool operator[] ( size_type const i ) const noexcept { return test ( i ); }
+    void set ( size_type const i ) noexcept {
+        assert ( i < n );
+        b[ i / 8u ] |= static_cast<std::uint8_t> ( 1u << ( i % 8u ) );
+    }
+    void set ( size_type const i, bool const value ) noexcept { value ? set ( i ) : reset ( i ); }
+    void reset ( size_type const i ) noexcept {
+        assert ( i < n );
+        b[ i / 8u ] &= static_cast<std::uint8_t> ( ~( 1u << ( i % 8u ) ) );
+    }
+    void flip ( size_type const i ) noexcept {
+        assert ( i < n );
+        b[ i / 8u ] ^= static_cast<std::uint8_t> ( 1u << ( i % 8u ) );
+    }
+
+    // all bits.
+
+    void set ( ) noexcept {
+        std::fill ( b.begin ( ), b.end ( ), std::uint8_t{ 0xFF } );
+        clear_tail ( );
+    }
+    void reset ( ) noexcept { std::fill ( b.begin ( ), b.end ( ), std::uint8_t{ 0 } ); }
+    void flip ( ) noexcept {
+        for ( std::uint8_t & v : b )
+            v = static_cast<std::uint8_t> ( ~v );
+        clear_tail ( );
+    }
+
+    // the number of set bits, popcnt over 64 bit words.
+    [[nodiscard]] size_type count ( ) const noexcept {
+        std::uint8_t const * p = b.data ( );
+        std::size_t const s    = b.size ( );
+        std::size_t i          = 0;
+        size_type c0 = 0, c1 = 0;
+        for ( ; i + 16u <= s; i += 16u ) { // 2 independent sums.
+            std::uint64_t w0, w1;
+            std::memcpy ( &w0, p + i, 8u );
+            std::memcpy ( &w1, p + i + 8u, 8u );
+            c0 += detail::popcount ( w0 );
+            c1 += detail::popcount ( w1 );
+        }
+        for ( ; i < s; ++i )
+            c0 += detail::popcount ( p[ i ] );
+        return c0 + c1;
+    }
+    [[nodiscard]] bool any ( ) const noexcept {
+        return std::any_of ( b.begin ( ), b.end ( ), [] ( std::uint8_t const v ) { return v != 0u; } );
+    }
+    [[nodiscard]] bool none ( ) const noexcept { return not any ( ); }
+    [[nodiscard]] bool all ( ) const noexcept { return count ( ) == n; }
+
+    // the index of the first set bit at or after i, npos if none.
+    [[nodiscard]] size_type find_next ( size_type const i ) const noexcept {
+        if ( i >= n )
+            return npos;
+        size_type w        = i / 64u;
+        std::uint64_t bits = word ( w ) & ( ~std::uint64_t{ 0 } << ( i % 64u ) );
+        for ( size_type const e = word_count ( ); not bits; bits = word ( w ) )
+            if ( ++w == e )
+                return npos;
+        return w * 64u + detail::ctz64 ( bits );
+    }
+    [[nodiscard]] size_type find_first ( ) const noexcept { return find_next ( 0u ); }
+
+    // bulk operations, between bit podders of equal size.
+
+    bit_podder & operator&= ( bit_podder const & rhs ) noexcept { return bitwise<detail::bit_op::and_> ( rhs ); }
+    bit_podder & operator|= ( bit_podder const & rhs ) noexcept { return bitwise<detail::bit_op::or_> ( rhs ); }
+    bit_podder & operator^= ( bit_podder const & rhs ) noexcept { return bitwise<detail::bit_op::xor_> ( rhs ); }
+    bit_podder & and_not ( bit_podder const & rhs ) noexcept { return bitwise<detail::bit_op::and_not> ( rhs ); }
+
+    [[nodiscard]] friend bit_podder operator& ( bit_podder a, bit_podder const & b ) noexcept { return a &= b; }
+    [[nodiscard]] friend bit_podder operator| ( bit_podder a, bit_podder const & b ) noexcept { return a |= b; }
+    [[nodiscard]] friend bit_podder operator^ ( bit_podder a, bit_podder const & b ) noexcept { return a ^= b; }
+
+    [[nodiscard]] bool operator== ( bit_podder const & rhs ) const noexcept { return n == rhs.n and b == rhs.b; }
+    [[nodiscard]] bool operator!= ( bit_podder const & rhs ) const noexcept { return not operator== ( rhs ); }
+};
+
+// rank/select directories over a bit podder, a cumulative count per 512 bit block. Build it when the bits don't change
+// anymore (rebuild after changes). rank is O ( 1 ), select O ( log ( n / 512 ) ).
+template<typename BitPodder>
+class rank_select {
+
+    public:
+    using size_type = typename BitPodder::size_type;
+
+    private:
+    static constexpr size_type block_words = 8u; // 512 bits.
+
+    BitPodder const * bits = nullptr;
+    podder<size_type> blocks; // set bits before each block, and the total.
+
+    public:
+    rank_select ( ) noexcept = default;
+    explicit rank_select ( BitPodder const & b ) noexcept { build ( b ); }
+
+    void build ( BitPodder const & b ) noexcept {
+        bits = &b;
+        blocks.clear ( );
+        size_type c = 0;
+        for ( size_type w = 0, e = b.word_count ( ); w < e; ++w ) {
+            if ( not( w % block_words ) )
+                blocks.emplace_back ( c );
+            c += detail::popcount ( b.word ( w ) );
+        }
+        blocks.emplace_back ( c );
+    }
+
+    // the number of set bits in [ 0, i ).
+    [[nodiscard]] size_type rank ( size_type const i ) const noexcept {
+        assert ( bits and i <= bits->size ( ) );
+        size_type const w = i / 64u, block = w / block_words;
+        size_type c       = blocks[ block ];
+        for ( size_type j = block * block_words; j < w; ++j )
+            c += detail::popcount ( bits->word ( j ) );
+        if ( i % 64u )
+            c += detail::popcount ( bits->word ( w ) & ( ( std::uint64_t{ 1 } << ( i % 64u ) ) - 1u ) );
+        return c;
+    }
+
+    // the index of the k-th (0-based) set bit, BitPodder::npos if there are not that many.
+    [[nodiscard]] size_type select ( size_type k ) const noexcept {
+        assert ( bits );
+        if ( k >= blocks.back ( ) )
+            return BitPodder::npos;
+        // the last block with a count <= k.
+        size_type const block = static_cast<size_type> ( std::upper_bound ( blocks.begin ( ), blocks.end ( ) - 1, k ) - blocks.begin ( ) ) - 1u;
+        k -= blocks[ block ];
+        for ( size_type w = block * block_words;; ++w ) {
+            std::uint64_t const word = bits->word ( w );
+            unsigned const c         = detail::popcount ( word );
+            if ( k < c )
+                return w * 64u + detail::select64 ( word, static_cast<unsigned> ( k ) );
+            k -= c;
+        }
+    }
+};
+
+} // namespace pdr
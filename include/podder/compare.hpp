@@ -0,0 +1,160 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <type_traits>
+
+#if defined( __AVX2__ ) or defined( __SSE2__ ) or defined( _M_X64 )
+#    include <immintrin.h>
+#endif
+
+namespace pdr {
+
+namespace detail {
+[[nodiscard]] inline std::size_t count_trailing_zeros ( std::uint32_t const m ) noexcept {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+    unsigned long i;
+    _BitScanForward ( &i, m );
+    return i;
+#else
+    return static_cast<std::size_t> ( __builtin_ctz ( m ) );
+#endif
+}
+} // namespace detail
+
+// the index of the first byte in which a and b differ, or size if they're equal.
+[[nodiscard]] inline std::size_t mismatch ( void const * a, void const * b, std::size_t const size ) noexcept {
+    unsigned char const * l = static_cast<unsigned char const *> ( a );
+    unsigned char const * r = static_cast<unsigned char const *> ( b );
+    std::size_t i           = 0;
+#if defined( __AVX2__ )
+    for ( ; i + 64u <= size; i += 64u ) { // 2 vectors per iteration, one test.
+        __m256i const e0 = _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( l + i ) ),
+                                               _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( r + i ) ) );
+        __m256i const e1 = _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( l + i + 32u ) ),
+                                               _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( r + i + 32u ) ) );
+        if ( static_cast<std::uint32_t> ( _mm256_movemask_epi8 ( _mm256_and_si256 ( e0, e1 ) ) ) != 0xFFFF'FFFFu ) {
+            std::uint32_t const m0 = ~static_cast<std::uint32_t> ( _mm256_movemask_epi8 ( e0 ) );
+            return m0 ? i + detail::count_trailing_zeros ( m0 )
+                      : i + 32u + detail::count_trailing_zeros ( ~static_cast<std::uint32_t> ( _mm256_movemask_epi8 ( e1 ) ) );
+        }
+    }
+    for ( ; i + 32u <= size; i += 32u ) {
+        __m256i const x = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( l + i ) );
+        __m256i const y = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( r + i ) );
+        std::uint32_t const m = ~static_cast<std::uint32_t> ( _mm256_movemask_epi8 ( _mm256_cmpeq_epi8 ( x, y ) ) );
+        if ( m )
+            return i + detail::count_trailing_zeros ( m );
+    }
+#endif
+#if defined( __SSE2__ ) or defined( _M_X64 )
+    for ( ; i + 16u <= size; i += 16u ) {
+        __m128i const x = _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( l + i ) );
+        __m128i const y = _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( r + i ) );
+        std::uint32_t const m =
+            ~static_cast<std::uint32_t> ( _mm_movemask_epi8 ( _mm_cmpeq_epi8 ( x, y ) ) ) & 0xFFFFu;
+        if ( m )
+            return i + detail::count_trailing_zeros ( m );
+    }
+#endif
+    for ( ; i < size; ++i )
+        if ( l[ i ] != r[ i ] )
+            return i;
+    return size;
+}
+
+// the index of the first element in which a and b differ bitwise, or size if they don't.
+template<typename Type>
+[[nodiscard]] std::size_t mismatch ( Type const * a, Type const * b, std::size_t const size ) noexcept {
+    return mismatch ( static_cast<void const *> ( a ), static_cast<void const *> ( b ), size * sizeof ( Type ) ) /
+           sizeof ( Type );
+}
+
+struct identity {
+    template<typename Type>
+    [[nodiscard]] constexpr Type const & operator( ) ( Type const & v ) const noexcept {
+        return v;
+    }
+};
+
+// lexicographical three-way comparison of [a, a + a_size) and [b, b + b_size), elements compare by the <
+// of proj ( element ), i.e. the order of std::lexicographical_compare. Equal bytes are skipped with the
+// mismatch kernel, which is sound as long as bitwise equal elements have equivalent keys (true for any pod and
+// any pure projection). Elements that differ bitwise but are equivalent (-0.0 and 0.0, nan's) are skipped over.
+template<typename Type, typename Proj = identity>
+[[nodiscard]] int compare ( Type const * a, std::size_t const a_size, Type const * b, std::size_t const b_size,
+                            Proj proj = { } ) noexcept {
+    std::size_t const n = std::min ( a_size, b_size );
+    if constexpr ( std::is_same<Proj, identity>::value and sizeof ( Type ) == 1u and std::is_unsigned<Type>::value ) {
+        if ( int const c = n ? std::memcmp ( a, b, n ) : 0 ) // bytes, memcmp orders them correctly.
+            return c < 0 ? -1 : 1;
+        return ( a_size > b_size ) - ( a_size < b_size );
+    }
+    for ( std::size_t i = 0; ( i += mismatch ( a + i, b + i, n - i ) ) < n; ++i ) {
+        auto const & l = proj ( a[ i ] );
+        auto const & r = proj ( b[ i ] );
+        if ( l < r )
+            return -1;
+        if ( r < l )
+            return 1;
+    }
+    return ( a_size > b_size ) - ( a_size < b_size );
+}
+
+template<typename Type>
+[[nodiscard]] bool equal ( Type const * a, std::size_t const a_size, Type const * b, std::size_t const b_size ) noexcept {
+    if ( a_size != b_size )
+        return false;
+    if constexpr ( std::is_floating_point<Type>::value ) // -0.0 == 0.0 and nan != nan, bytes won't do.
+        return std::equal ( a, a + a_size, b );
+    else
+        return not a_size or std::memcmp ( a, b, a_size * sizeof ( Type ) ) == 0;
+}
+
+// contiguous containers (anything with data ( ) and size ( )).
+
+template<typename ContainerA, typename ContainerB, typename Proj = identity>
+[[nodiscard]] int compare ( ContainerA const & a, ContainerB const & b, Proj proj = { } ) noexcept {
+    return compare ( a.data ( ), static_cast<std::size_t> ( a.size ( ) ), b.data ( ), static_cast<std::size_t> ( b.size ( ) ),
+                     proj );
+}
+
+// a comparator for sorted containers of podders (std::set, std::sort), ordering by proj ( element ).
+template<typename Proj = identity>
+struct key_less {
+    Proj proj;
+
+    template<typename Container>
+    [[nodiscard]] bool operator( ) ( Container const & a, Container const & b ) const noexcept {
+        return compare ( a, b, proj ) < 0;
+    }
+};
+
+} // namespace pdr
@@ -0,0 +1,86 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined( __AVX__ )
+#    include <immintrin.h>
+#endif
+
+// costumization point, copies of at least PODDER_STREAMING_THRESHOLD bytes bypass the cache (on AVX-targets), i.e.
+// they don't evict the working set. It should be about the size of the last level cache, copies that (mostly) fit
+// the cache are faster with memcpy. Define it as 0 to always use memcpy.
+#ifndef PODDER_STREAMING_THRESHOLD
+#    define PODDER_STREAMING_THRESHOLD ( std::size_t{ 8 } * 1'024u * 1'024u )
+#endif
+
+namespace pdr {
+
+[[nodiscard]] constexpr std::size_t streaming_threshold ( ) noexcept { return PODDER_STREAMING_THRESHOLD; }
+
+// copies size bytes with non-temporal stores, the ranges should not overlap.
+inline void stream_copy ( void * dst, void const * src, std::size_t size ) noexcept {
+#if defined( __AVX__ )
+    char * d       = static_cast<char *> ( dst );
+    char const * s = static_cast<char const *> ( src );
+    // align the destination on 32 bytes.
+    std::size_t const head = ( 32u - ( reinterpret_cast<std::uintptr_t> ( d ) & 31u ) ) & 31u;
+    if ( head >= size ) {
+        std::memcpy ( d, s, size );
+        return;
+    }
+    std::memcpy ( d, s, head );
+    d += head, s += head, size -= head;
+    // 128 bytes (2 cache lines) per iteration, prefetching 8 lines ahead.
+    for ( ; size >= 128u; d += 128, s += 128, size -= 128u ) {
+        _mm_prefetch ( s + 512, _MM_HINT_NTA );
+        _mm_prefetch ( s + 576, _MM_HINT_NTA );
+        __m256i const a = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s ) );
+        __m256i const b = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s + 32 ) );
+        __m256i const c = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s + 64 ) );
+        __m256i const e = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s + 96 ) );
+        _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d ), a );
+        _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d + 32 ), b );
+        _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d + 64 ), c );
+        _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d + 96 ), e );
+    }
+    _mm_sfence ( ); // non-temporal stores are weakly ordered.
+    std::memcpy ( d, s, size );
+#else
+    std::memcpy ( dst, src, size );
+#endif
+}
+
+// the bulk copy used by podder, memcpy below the streaming threshold, stream_copy from it.
+inline void bulk_copy ( void * dst, void const * src, std::size_t size ) noexcept {
+    if ( streaming_threshold ( ) and size >= streaming_threshold ( ) )
+        stream_copy ( dst, src, size );
+    else
+        std::memcpy ( dst, src, size );
+}
+
+} // namespace pdr
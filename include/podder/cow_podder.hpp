@@ -0,0 +1,371 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "podder.hpp"
+
+namespace pdr {
+
+// A copy-on-write podder, for cheap snapshots of (large) read-mostly buffers. Small (svo) cow_podders are plain
+// values, like podder. Larger ones live in a heap block that starts with a (thread-safe) reference count,
+// copies share the block, copying is O(1), and the first mutation of a shared block detaches (copies) it.
+//
+// Note: the non-const accessors (data, begin/end, operator[], at, front and back) count as mutations and detach,
+// read through a const cow_podder (or cbegin/cend) to not detach.
+template<typename Type = std::uint8_t, typename SizeType = std::size_t,
+         typename GrowthPolicy = visual_studio_growth_policy<SizeType>>
+class cow_podder {
+
+    static_assert ( std::is_trivially_copyable<Type>::value, "Type must be trivially copyable!" );
+    static_assert ( std::numeric_limits<typename std::make_unsigned<SizeType>::type>::digits >= 32,
+                    "SizeType must be an unsigned 32- or 64-bit integer type!" );
+
+    public:
+    using value_type      = Type;
+    using pointer         = value_type *;
+    using const_pointer   = value_type const *;
+    using reference       = value_type &;
+    using const_reference = value_type const &;
+
+    using size_type        = SizeType;
+    using signed_size_type = typename std::make_signed<size_type>::type;
+    using difference_type  = signed_size_type;
+
+    using iterator       = pointer;
+    using const_iterator = const_pointer;
+
+    using podder_type = podder<Type, SizeType, GrowthPolicy>;
+
+    private:
+    using growth_policy = GrowthPolicy;
+
+    // the block header, the values follow it.
+    struct header {
+        std::atomic<std::size_t> count;
+        size_type capacity;
+    };
+
+    static constexpr std::size_t header_size =
+        ( sizeof ( header ) + alignof ( std::max_align_t ) - 1u ) / alignof ( std::max_align_t ) * alignof ( std::max_align_t );
+    static constexpr std::size_t storage_size = 3u * sizeof ( void * ); // the tag is the highest byte.
+    static constexpr std::size_t buffer_size  = ( storage_size - 1u ) / sizeof ( value_type );
+
+    struct shared_s {
+        pointer data; // nullptr, iff not allocated.
+        size_type size;
+    };
+
+    static_assert ( sizeof ( shared_s ) < storage_size, "the tag byte should not overlap shared_s" );
+
+    union cow_data_u {
+        shared_s s;
+        value_type buffer[ buffer_size ? buffer_size : 1u ];
+        std::uint8_t bytes[ storage_size ];
+    };
+
+    public:
+    // constructors.
+
+    cow_podder ( ) noexcept { clear_to_empty ( ); }
+    explicit cow_podder ( size_type const count ) noexcept {
+        clear_to_empty ( );
+        resize ( count );
+    }
+    cow_podder ( size_type count, const_reference value ) noexcept {
+        clear_to_empty ( );
+        pointer p = make_writable ( count );
+        set_size ( count );
+        while ( count-- )
+            *p++ = value;
+    }
+    explicit cow_podder ( const_pointer first, size_type const count ) noexcept {
+        clear_to_empty ( );
+        if ( count ) {
+            pdr::bulk_copy ( ( void * ) make_writable ( count ), ( void * ) first, count * sizeof ( value_type ) );
+            set_size ( count );
+        }
+    }
+    cow_podder ( std::initializer_list<value_type> il ) noexcept :
+        cow_podder ( il.begin ( ), static_cast<size_type> ( il.size ( ) ) ) {}
+    explicit cow_podder ( podder_type const & p ) noexcept : cow_podder ( p.data ( ), p.size ( ) ) {}
+
+    cow_podder ( cow_podder const & c ) noexcept {
+        std::memcpy ( ( void * ) &d, ( void * ) &c.d, sizeof ( d ) );
+        retain ( );
+    }
+    cow_podder ( cow_podder && c ) noexcept {
+        std::memcpy ( ( void * ) &d, ( void * ) &c.d, sizeof ( d ) );
+        c.clear_to_empty ( );
+    }
+
+    ~cow_podder ( ) noexcept { release ( ); }
+
+    // assignment.
+
+    [[maybe_unused]] cow_podder & operator= ( cow_podder const & rhs ) noexcept {
+        if ( this != &rhs ) {
+            release ( );
+            std::memcpy ( ( void * ) &d, ( void * ) &rhs.d, sizeof ( d ) );
+            retain ( );
+        }
+        return *this;
+    }
+    [[maybe_unused]] cow_podder & operator= ( cow_podder && rhs ) noexcept {
+        if ( this != &rhs ) {
+            release ( );
+            std::memcpy ( ( void * ) &d, ( void * ) &rhs.d, sizeof ( d ) );
+            rhs.clear_to_empty ( );
+        }
+        return *this;
+    }
+
+    // size and capacity.
+
+    [[nodiscard]] size_type size ( ) const noexcept { return is_small ( ) ? small_size ( ) : d.s.size; }
+    [[nodiscard]] bool empty ( ) const noexcept { return not size ( ); }
+    [[nodiscard]] size_type capacity ( ) const noexcept {
+        if ( is_small ( ) )
+            return static_cast<size_type> ( buffer_size );
+        return d.s.data ? block_header ( d.s.data )->capacity : size_type{ 0 };
+    }
+    [[nodiscard]] static constexpr size_type svo_capacity ( ) noexcept { return static_cast<size_type> ( buffer_size ); }
+    [[nodiscard]] static constexpr bool svo ( ) noexcept { return buffer_size > 0u; }
+
+    // the number of cow_podders sharing the block, 0 for small or unallocated cow_podders.
+    [[nodiscard]] std::size_t use_count ( ) const noexcept {
+        return is_small ( ) or not d.s.data ? std::size_t{ 0 } : block_header ( d.s.data )->count.load ( std::memory_order_acquire );
+    }
+    [[nodiscard]] bool shared ( ) const noexcept { return use_count ( ) > 1u; }
+
+    // const access, never detaches.
+
+    [[nodiscard]] const_pointer data ( ) const noexcept { return is_small ( ) ? d.buffer : d.s.data; }
+    [[nodiscard]] const_iterator begin ( ) const noexcept { return data ( ); }
+    [[nodiscard]] const_iterator end ( ) const noexcept { return data ( ) + size ( ); }
+    [[nodiscard]] const_iterator cbegin ( ) const noexcept { return begin ( ); }
+    [[nodiscard]] const_iterator cend ( ) const noexcept { return end ( ); }
+    [[nodiscard]] const_reference operator[] ( size_type const idx ) const noexcept { return data ( )[ idx ]; }
+    [[nodiscard]] const_reference at ( size_type const pos ) const {
+        if ( pos >= size ( ) )
+            throw std::out_of_range ( std::string ( "index out of bounds, pos = " ) + std::to_string ( pos ) +
+                                      std::string ( " , size = " ) + std::to_string ( size ( ) ) + std::string ( "." ) );
+        return data ( )[ pos ];
+    }
+    [[nodiscard]] const_reference front ( ) const noexcept { return *data ( ); }
+    [[nodiscard]] const_reference back ( ) const noexcept { return data ( )[ size ( ) - 1 ]; }
+
+    // non-const access, detaches.
+
+    [[nodiscard]] pointer data ( ) noexcept { return make_writable ( size ( ) ); }
+    [[nodiscard]] iterator begin ( ) noexcept { return data ( ); }
+    [[nodiscard]] iterator end ( ) noexcept {
+        pointer const p = data ( );
+        return p + size ( );
+    }
+    [[nodiscard]] reference operator[] ( size_type const idx ) noexcept { return data ( )[ idx ]; }
+    [[nodiscard]] reference at ( size_type const pos ) {
+        static_cast<void> ( std::as_const ( *this ).at ( pos ) ); // throws.
+        return data ( )[ pos ];
+    }
+    [[nodiscard]] reference front ( ) noexcept { return *data ( ); }
+    [[nodiscard]] reference back ( ) noexcept {
+        pointer const p = data ( );
+        return p[ size ( ) - 1 ];
+    }
+
+    // modifiers.
+
+    void reserve ( size_type const count ) noexcept {
+        if ( count > capacity ( ) )
+            make_writable ( count );
+    }
+    void resize ( size_type const count ) noexcept {
+        size_type const s = size ( );
+        if ( count > s ) {
+            pointer const p = make_writable ( std::max ( count, capacity ( ) ) );
+            std::memset ( ( void * ) ( p + s ), 0, ( count - s ) * sizeof ( value_type ) );
+            set_size ( count );
+        }
+        else if ( count < s ) {
+            make_writable ( capacity ( ) );
+            set_size ( count );
+        }
+    }
+    template<typename... Args>
+    [[maybe_unused]] reference emplace_back ( Args &&... args ) noexcept {
+        size_type const s = size ( ), c = capacity ( );
+        pointer const p   = make_writable ( s == c ? growth_policy::grow_capacity_from ( c ) : c );
+        set_size ( s + 1 );
+        return *new ( p + s ) value_type{ std::forward<Args> ( args )... };
+    }
+    [[maybe_unused]] reference push_back ( const_reference value ) noexcept { return emplace_back ( value ); }
+    void pop_back ( ) noexcept {
+        assert ( size ( ) );
+        make_writable ( capacity ( ) );
+        set_size ( size ( ) - 1 );
+    }
+    // releases the block (if any), a shared block stays alive for its other owners.
+    void clear ( ) noexcept {
+        release ( );
+        clear_to_empty ( );
+    }
+    void swap ( cow_podder & c ) noexcept {
+        cow_data_u t;
+        std::memcpy ( ( void * ) &t, ( void * ) &d, sizeof ( d ) );
+        std::memcpy ( ( void * ) &d, ( void * ) &c.d, sizeof ( d ) );
+        std::memcpy ( ( void * ) &c.d, ( void * ) &t, sizeof ( d ) );
+    }
+
+    // conversion.
+
+    [[nodiscard]] podder_type to_podder ( ) const noexcept { return podder_type ( data ( ), size ( ) ); }
+
+    // comparison.
+
+    // by value, as podder's (-0.0 == 0.0 and nan != nan).
+    [[nodiscard]] bool operator== ( cow_podder const & rhs ) const noexcept {
+        if constexpr ( not std::is_floating_point<value_type>::value ) { // a shared block (a nan isn't equal to itself).
+            if ( data ( ) == rhs.data ( ) and size ( ) == rhs.size ( ) )
+                return true;
+        }
+        return pdr::equal ( data ( ), static_cast<std::size_t> ( size ( ) ), rhs.data ( ), static_cast<std::size_t> ( rhs.size ( ) ) );
+    }
+    [[nodiscard]] bool operator!= ( cow_podder const & rhs ) const noexcept { return not operator== ( rhs ); }
+
+    private:
+    // the tag.
+
+    [[nodiscard]] bool is_small ( ) const noexcept {
+        if constexpr ( svo ( ) )
+            return d.bytes[ storage_size - 1u ] & 0b0010'0000;
+        else
+            return false;
+    }
+    [[nodiscard]] size_type small_size ( ) const noexcept {
+        return static_cast<size_type> ( d.bytes[ storage_size - 1u ] & 0b0001'1111 );
+    }
+    void set_small_size ( size_type const s ) noexcept {
+        assert ( s <= buffer_size );
+        d.bytes[ storage_size - 1u ] = static_cast<std::uint8_t> ( s ) | 0b0010'0000;
+    }
+    void set_shared ( pointer const p, size_type const s ) noexcept {
+        std::memset ( ( void * ) &d, 0, sizeof ( d ) );
+        d.s.data = p;
+        d.s.size = s;
+    }
+    // the storage is writable (see make_writable).
+    void set_size ( size_type const s ) noexcept {
+        if ( is_small ( ) )
+            set_small_size ( s );
+        else
+            d.s.size = s;
+    }
+    void clear_to_empty ( ) noexcept {
+        std::memset ( ( void * ) &d, 0, sizeof ( d ) );
+        if constexpr ( svo ( ) )
+            set_small_size ( 0 );
+    }
+
+    // the block.
+
+    [[nodiscard]] static header * block_header ( const_pointer const p ) noexcept {
+        return reinterpret_cast<header *> ( reinterpret_cast<char *> ( const_cast<pointer> ( p ) ) - header_size );
+    }
+    [[nodiscard]] static pointer allocate ( size_type const capacity ) noexcept {
+        char * const b = static_cast<char *> ( pdr::malloc ( header_size + capacity * sizeof ( value_type ) ) );
+        new ( b ) header{ { 1u }, capacity };
+        return reinterpret_cast<pointer> ( b + header_size );
+    }
+    void retain ( ) const noexcept {
+        if ( not is_small ( ) and d.s.data )
+            block_header ( d.s.data )->count.fetch_add ( 1u, std::memory_order_relaxed );
+    }
+    void release ( ) noexcept {
+        if ( not is_small ( ) and d.s.data ) {
+            header * const h = block_header ( d.s.data );
+            if ( h->count.fetch_sub ( 1u, std::memory_order_acq_rel ) == 1u ) {
+                h->~header ( );
+                pdr::free ( h );
+            }
+        }
+    }
+
+    // detaches, returns the (then exclusively owned) values, with room for at least count values.
+    pointer make_writable ( size_type const count ) noexcept {
+        size_type const s = size ( );
+        if ( is_small ( ) ) {
+            if ( count <= buffer_size )
+                return d.buffer;
+            pointer const p = allocate ( count );
+            std::memcpy ( ( void * ) p, ( void * ) d.buffer, s * sizeof ( value_type ) );
+            set_shared ( p, s );
+            return p;
+        }
+        if ( not d.s.data ) { // only no_svo types, svo types start out small.
+            if ( not count )
+                return nullptr;
+            set_shared ( allocate ( count ), 0 );
+            return d.s.data;
+        }
+        header * const h = block_header ( d.s.data );
+        if ( h->count.load ( std::memory_order_acquire ) == 1u ) { // unique.
+            if ( count > h->capacity ) {
+                header * const n = static_cast<header *> ( pdr::realloc ( h, header_size + count * sizeof ( value_type ) ) );
+                n->capacity      = count;
+                d.s.data         = reinterpret_cast<pointer> ( reinterpret_cast<char *> ( n ) + header_size );
+            }
+            return d.s.data;
+        }
+        size_type const c = std::max ( count, s );
+        pointer const p   = allocate ( c );
+        pdr::bulk_copy ( ( void * ) p, ( void * ) d.s.data, s * sizeof ( value_type ) );
+        release ( );
+        set_shared ( p, s );
+        return p;
+    }
+
+    cow_data_u d;
+};
+
+template<typename Type, typename SizeType, typename GrowthPolicy>
+void swap ( cow_podder<Type, SizeType, GrowthPolicy> & a, cow_podder<Type, SizeType, GrowthPolicy> & b ) noexcept {
+    a.swap ( b );
+}
+
+} // namespace pdr
@@ -0,0 +1,448 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "podder.hpp"
+#include "reduce.hpp" // detail::sum_type.
+#include "span.hpp"
+
+// Lazy elementwise expressions over podders and views (anything with std::data and std::size, f.e. pdr::span), no
+// temporaries, evaluated in one (vectorizable) pass by assign, append, store, eval or a reduction:
+//
+//     using namespace pdr::expr;
+//     assign ( a, of ( b ) * of ( c ) + of ( d ) ); // a = b * c + d, one read of b, c and d, one write of a.
+//
+// The nodes are small values (a terminal is a pointer and a size), copied into the expression, the containers must
+// outlive it. Scalars broadcast, the value types follow the C++ rules (as in b[ i ] * c[ i ]), i.e. of ( floats ) * 2.0
+// is a double expression (write 2.0f), and small integers promote (stored back, they convert to the destination type).
+// Comparisons give masks (bool), for select, count, any and all.
+
+namespace pdr::expr {
+
+// the base of the nodes, which have a value_type, size ( ) (0 for scalars, which fit any size), operator[] ( i ), and
+// overlap ( b, e, size ) (see below).
+struct node {};
+
+template<typename Type>
+inline constexpr bool is_node_v = std::is_base_of<node, std::decay_t<Type>>::value;
+
+// how the terminals of an expression overlap the bytes [ b, e ) of values of size bytes: not, at b only with values of
+// the same size (elementwise in place is safe), or shifted (a narrower terminal at b, f.e., is read behind the writes).
+enum class overlap_type : std::uint8_t { none, in_place, shifted };
+
+template<typename Type>
+struct terminal : node {
+    using value_type = std::remove_cv_t<Type>;
+
+    value_type const * p;
+    std::size_t n;
+
+    [[nodiscard]] std::size_t size ( ) const noexcept { return n; }
+    [[nodiscard]] value_type operator[] ( std::size_t const i ) const noexcept { return p[ i ]; }
+    [[nodiscard]] overlap_type overlap ( void const * const b, void const * const e, std::size_t const size ) const noexcept {
+        char const * const s = reinterpret_cast<char const *> ( p );
+        if ( not n or s >= static_cast<char const *> ( e ) or s + n * sizeof ( value_type ) <= static_cast<char const *> ( b ) )
+            return overlap_type::none;
+        return s == b and sizeof ( value_type ) == size ? overlap_type::in_place : overlap_type::shifted;
+    }
+};
+
+template<typename Type>
+struct scalar : node {
+    using value_type = Type;
+
+    value_type v;
+
+    [[nodiscard]] std::size_t size ( ) const noexcept { return 0u; }
+    [[nodiscard]] value_type operator[] ( std::size_t ) const noexcept { return v; }
+    [[nodiscard]] overlap_type overlap ( void const *, void const *, std::size_t ) const noexcept { return overlap_type::none; }
+};
+
+namespace detail {
+[[nodiscard]] inline std::size_t common_size ( std::size_t const a, std::size_t const b ) noexcept {
+    assert ( not a or not b or a == b );
+    return a ? a : b;
+}
+[[nodiscard]] inline overlap_type common_overlap ( overlap_type const a, overlap_type const b ) noexcept {
+    return std::max ( a, b );
+}
+} // namespace detail
+
+template<typename Op, typename A>
+struct unary : node {
+    using value_type = std::decay_t<decltype ( Op{ }( std::declval<typename A::value_type> ( ) ) )>;
+
+    A a;
+
+    [[nodiscard]] std::size_t size ( ) const noexcept { return a.size ( ); }
+    [[nodiscard]] value_type operator[] ( std::size_t const i ) const noexcept { return Op{ }( a[ i ] ); }
+    [[nodiscard]] overlap_type overlap ( void const * const b, void const * const e, std::size_t const size ) const noexcept {
+        return a.overlap ( b, e, size );
+    }
+};
+
+template<typename Op, typename A, typename B>
+struct binary : node {
+    using value_type =
+        std::decay_t<decltype ( Op{ }( std::declval<typename A::value_type> ( ), std::declval<typename B::value_type> ( ) ) )>;
+
+    A a;
+    B b;
+
+    [[nodiscard]] std::size_t size ( ) const noexcept { return detail::common_size ( a.size ( ), b.size ( ) ); }
+    [[nodiscard]] value_type operator[] ( std::size_t const i ) const noexcept { return Op{ }( a[ i ], b[ i ] ); }
+    [[nodiscard]] overlap_type overlap ( void const * const b_, void const * const e_, std::size_t const size ) const noexcept {
+        return detail::common_overlap ( a.overlap ( b_, e_, size ), b.overlap ( b_, e_, size ) );
+    }
+};
+
+// m[ i ] ? a[ i ] : b[ i ], both sides are read (a blend, not a branch).
+template<typename M, typename A, typename B>
+struct selection : node {
+    using value_type = std::common_type_t<typename A::value_type, typename B::value_type>;
+
+    M m;
+    A a;
+    B b;
+
+    [[nodiscard]] std::size_t size ( ) const noexcept {
+        return detail::common_size ( m.size ( ), detail::common_size ( a.size ( ), b.size ( ) ) );
+    }
+    [[nodiscard]] value_type operator[] ( std::size_t const i ) const noexcept {
+        value_type const x = a[ i ], y = b[ i ];
+        return m[ i ] ? x : y;
+    }
+    [[nodiscard]] overlap_type overlap ( void const * const b_, void const * const e_, std::size_t const size ) const noexcept {
+        return detail::common_overlap ( m.overlap ( b_, e_, size ),
+                                        detail::common_overlap ( a.overlap ( b_, e_, size ), b.overlap ( b_, e_, size ) ) );
+    }
+};
+
+template<typename Type, typename A>
+struct conversion : node {
+    using value_type = Type;
+
+    A a;
+
+    [[nodiscard]] std::size_t size ( ) const noexcept { return a.size ( ); }
+    [[nodiscard]] value_type operator[] ( std::size_t const i ) const noexcept { return static_cast<Type> ( a[ i ] ); }
+    [[nodiscard]] overlap_type overlap ( void const * const b, void const * const e, std::size_t const size ) const noexcept {
+        return a.overlap ( b, e, size );
+    }
+};
+
+// terminals.
+
+template<typename Container>
+[[nodiscard]] auto of ( Container const & c ) noexcept {
+    using value_type = std::remove_cv_t<std::remove_reference_t<decltype ( *std::data ( c ) )>>;
+    return terminal<value_type>{ { }, std::data ( c ), static_cast<std::size_t> ( std::size ( c ) ) };
+}
+template<typename Type>
+[[nodiscard]] terminal<Type> of ( Type const * const p, std::size_t const n ) noexcept {
+    return { { }, p, n };
+}
+
+namespace detail {
+// nodes as is, arithmetic values as scalars and containers as terminals.
+template<typename Type>
+[[nodiscard]] auto lift ( Type const & x ) noexcept {
+    if constexpr ( is_node_v<Type> )
+        return x;
+    else if constexpr ( std::is_arithmetic<Type>::value )
+        return scalar<Type>{ { }, x };
+    else
+        return of ( x );
+}
+template<typename Type>
+using lift_t = decltype ( lift ( std::declval<Type const &> ( ) ) );
+
+template<typename A, typename B>
+using if_node_t = std::enable_if_t<is_node_v<A> or is_node_v<B>, int>;
+
+struct minimum {
+    template<typename A, typename B>
+    [[nodiscard]] auto operator( ) ( A const a, B const b ) const noexcept {
+        return b < a ? b : a;
+    }
+};
+struct maximum {
+    template<typename A, typename B>
+    [[nodiscard]] auto operator( ) ( A const a, B const b ) const noexcept {
+        return a < b ? b : a;
+    }
+};
+struct absolute {
+    template<typename A>
+    [[nodiscard]] A operator( ) ( A const a ) const noexcept {
+        if constexpr ( std::is_unsigned<A>::value )
+            return a;
+        else
+            return a < A{ 0 } ? static_cast<A> ( -a ) : a;
+    }
+};
+struct square_root {
+    template<typename A>
+    [[nodiscard]] auto operator( ) ( A const a ) const noexcept {
+        return std::sqrt ( a );
+    }
+};
+} // namespace detail
+
+// operators, at least one side a node (found by adl), the other a node, a scalar or a container.
+
+#define PODDER_EXPR_BINARY( OP, FUNCTOR )                                                                                      \
+    template<typename A, typename B, detail::if_node_t<A, B> = 0>                                                              \
+    [[nodiscard]] auto operator OP ( A const & a, B const & b ) noexcept {                                                      \
+        return binary<FUNCTOR, detail::lift_t<A>, detail::lift_t<B>>{ { }, detail::lift ( a ), detail::lift ( b ) };          \
+    }
+
+PODDER_EXPR_BINARY ( +, std::plus<> )
+PODDER_EXPR_BINARY ( -, std::minus<> )
+PODDER_EXPR_BINARY ( *, std::multiplies<> )
+PODDER_EXPR_BINARY ( /, std::divides<> )
+PODDER_EXPR_BINARY ( %, std::modulus<> )
+PODDER_EXPR_BINARY ( &, std::bit_and<> )
+PODDER_EXPR_BINARY ( |, std::bit_or<> )
+PODDER_EXPR_BINARY ( ^, std::bit_xor<> )
+PODDER_EXPR_BINARY ( ==, std::equal_to<> )
+PODDER_EXPR_BINARY ( !=, std::not_equal_to<> )
+PODDER_EXPR_BINARY ( <, std::less<> )
+PODDER_EXPR_BINARY ( <=, std::less_equal<> )
+PODDER_EXPR_BINARY ( >, std::greater<> )
+PODDER_EXPR_BINARY ( >=, std::greater_equal<> )
+
+#undef PODDER_EXPR_BINARY
+
+template<typename A, std::enable_if_t<is_node_v<A>, int> = 0>
+[[nodiscard]] auto operator- ( A const & a ) noexcept {
+    return unary<std::negate<>, A>{ { }, a };
+}
+template<typename A, std::enable_if_t<is_node_v<A>, int> = 0>
+[[nodiscard]] auto operator! ( A const & a ) noexcept {
+    return unary<std::logical_not<>, A>{ { }, a };
+}
+template<typename A, std::enable_if_t<is_node_v<A>, int> = 0>
+[[nodiscard]] auto operator~ ( A const & a ) noexcept {
+    return unary<std::bit_not<>, A>{ { }, a };
+}
+
+// elementwise functions.
+
+template<typename A, typename B, detail::if_node_t<A, B> = 0>
+[[nodiscard]] auto minimum ( A const & a, B const & b ) noexcept {
+    return binary<detail::minimum, detail::lift_t<A>, detail::lift_t<B>>{ { }, detail::lift ( a ), detail::lift ( b ) };
+}
+template<typename A, typename B, detail::if_node_t<A, B> = 0>
+[[nodiscard]] auto maximum ( A const & a, B const & b ) noexcept {
+    return binary<detail::maximum, detail::lift_t<A>, detail::lift_t<B>>{ { }, detail::lift ( a ), detail::lift ( b ) };
+}
+template<typename A, std::enable_if_t<is_node_v<A>, int> = 0>
+[[nodiscard]] auto abs ( A const & a ) noexcept {
+    return unary<detail::absolute, A>{ { }, a };
+}
+template<typename A, std::enable_if_t<is_node_v<A>, int> = 0>
+[[nodiscard]] auto sqrt ( A const & a ) noexcept {
+    return unary<detail::square_root, A>{ { }, a };
+}
+
+template<typename M, typename A, typename B>
+[[nodiscard]] auto select ( M const & m, A const & a, B const & b ) noexcept {
+    return selection<detail::lift_t<M>, detail::lift_t<A>, detail::lift_t<B>>{ { }, detail::lift ( m ), detail::lift ( a ),
+                                                                                 detail::lift ( b ) };
+}
+
+// the values of a as Type, f.e. cast<float> ( of ( bytes ) ).
+template<typename Type, typename A>
+[[nodiscard]] auto cast ( A const & a ) noexcept {
+    return conversion<Type, detail::lift_t<A>>{ { }, detail::lift ( a ) };
+}
+
+// evaluation.
+
+namespace detail {
+// the one pass, out doesn't alias the terminals (the callers make sure).
+template<typename Type, typename E>
+void store ( Type * __restrict out, E const e, std::size_t const n ) noexcept {
+    for ( std::size_t i = 0; i < n; ++i )
+        out[ i ] = static_cast<Type> ( e[ i ] );
+}
+// the one pass where out is a terminal as well (not shifted, i.e. value i is read before it's written).
+template<typename Type, typename E>
+void store_in_place ( Type * out, E const e, std::size_t const n ) noexcept {
+    for ( std::size_t i = 0; i < n; ++i )
+        out[ i ] = static_cast<Type> ( e[ i ] );
+}
+} // namespace detail
+
+// writes e into the view (or container) v of the same size, through a temporary if e reads v shifted.
+template<typename View, typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+void store ( View && v, E const & e ) noexcept {
+    using value_type    = std::remove_reference_t<decltype ( *std::data ( v ) )>;
+    std::size_t const n = e.size ( );
+    assert ( n == static_cast<std::size_t> ( std::size ( v ) ) );
+    value_type * const p = std::data ( v );
+    overlap_type const o = e.overlap ( p, p + n, sizeof ( value_type ) );
+    if ( o == overlap_type::none ) {
+        detail::store ( p, e, n );
+    }
+    else if ( o == overlap_type::in_place ) {
+        detail::store_in_place ( p, e, n );
+    }
+    else {
+        podder<value_type> t;
+        t.resize_reserve_only ( n );
+        detail::store ( t.data ( ), e, n );
+        std::memcpy ( ( void * ) p, ( void * ) t.data ( ), n * sizeof ( value_type ) );
+    }
+}
+
+// p = e, the podder gets resized (without initialization), an e that reads p is evaluated in place if that's safe
+// (same size, no shifts), into a new block otherwise.
+template<typename Podder, typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+Podder & assign ( Podder & p, E const & e ) noexcept {
+    using value_type    = typename Podder::value_type;
+    std::size_t const n = e.size ( );
+    overlap_type const o =
+        p.size ( ) ? e.overlap ( p.data ( ), p.data ( ) + p.size ( ), sizeof ( value_type ) ) : overlap_type::none;
+    if ( o == overlap_type::none ) {
+        p.resize_reserve_only ( static_cast<typename Podder::size_type> ( n ) );
+        detail::store<value_type> ( p.data ( ), e, n );
+    }
+    else if ( o == overlap_type::in_place and n == static_cast<std::size_t> ( p.size ( ) ) ) {
+        detail::store_in_place<value_type> ( p.data ( ), e, n );
+    }
+    else {
+        Podder t;
+        t.resize_reserve_only ( static_cast<typename Podder::size_type> ( n ) );
+        detail::store<value_type> ( t.data ( ), e, n );
+        p.swap ( t );
+    }
+    return p;
+}
+
+// p += e (appended), an e that reads p is evaluated into a temporary (the podder might relocate).
+template<typename Podder, typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+Podder & append ( Podder & p, E const & e ) noexcept {
+    using value_type    = typename Podder::value_type;
+    using size_type     = typename Podder::size_type;
+    std::size_t const n = e.size ( ), s = static_cast<std::size_t> ( p.size ( ) );
+    if ( s and e.overlap ( p.data ( ), p.data ( ) + s, sizeof ( value_type ) ) != overlap_type::none ) {
+        Podder t;
+        t.resize_reserve_only ( static_cast<size_type> ( n ) );
+        detail::store<value_type> ( t.data ( ), e, n );
+        p.resize_reserve_only ( static_cast<size_type> ( s + n ) );
+        std::memcpy ( ( void * ) ( p.data ( ) + s ), ( void * ) t.data ( ), n * sizeof ( value_type ) );
+    }
+    else {
+        p.resize_reserve_only ( static_cast<size_type> ( s + n ) );
+        detail::store<value_type> ( p.data ( ) + s, e, n );
+    }
+    return p;
+}
+
+// a new podder holding e.
+template<typename Type = void, typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+[[nodiscard]] auto eval ( E const & e ) noexcept {
+    using value_type = std::conditional_t<std::is_void<Type>::value, typename E::value_type, Type>;
+    podder<value_type> p;
+    p.resize_reserve_only ( e.size ( ) );
+    detail::store<value_type> ( p.data ( ), e, e.size ( ) );
+    return p;
+}
+
+// reductions, fused with the evaluation of e, lanes independent accumulators (a fixed association, so the results
+// don't vary from run to run, they do differ from a left to right sum for floating point values).
+
+namespace detail {
+inline constexpr std::size_t lanes = 8u;
+
+// folds e[ i, n ).
+template<typename Acc, typename E, typename Op>
+[[nodiscard]] Acc fold ( E const e, std::size_t i, std::size_t const n, Acc const init, Op const op ) noexcept {
+    Acc acc[ lanes ];
+    for ( std::size_t k = 0; k < lanes; ++k )
+        acc[ k ] = init;
+    for ( ; i + lanes <= n; i += lanes )
+        for ( std::size_t k = 0; k < lanes; ++k )
+            acc[ k ] = op ( acc[ k ], static_cast<Acc> ( e[ i + k ] ) );
+    Acc tail = init; // kept apart, indexing acc by a variable spills it to the stack.
+    for ( ; i < n; ++i )
+        tail = op ( tail, static_cast<Acc> ( e[ i ] ) );
+    for ( std::size_t w = lanes / 2u; w; w /= 2u ) // pairwise.
+        for ( std::size_t k = 0; k < w; ++k )
+            acc[ k ] = op ( acc[ k ], acc[ k + w ] );
+    return op ( acc[ 0 ], tail );
+}
+} // namespace detail
+
+template<typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+[[nodiscard]] auto sum ( E const & e ) noexcept {
+    using value_type = typename E::value_type;
+    using acc_type   = pdr::detail::sum_type<value_type>; // widened, as pdr::sum.
+    return detail::fold<acc_type> ( e, 0u, e.size ( ), acc_type{ 0 }, std::plus<>{ } );
+}
+// e is not empty.
+template<typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+[[nodiscard]] auto min ( E const & e ) noexcept {
+    assert ( e.size ( ) );
+    return detail::fold<typename E::value_type> ( e, 0u, e.size ( ), e[ 0 ], detail::minimum{ } );
+}
+template<typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+[[nodiscard]] auto max ( E const & e ) noexcept {
+    assert ( e.size ( ) );
+    return detail::fold<typename E::value_type> ( e, 0u, e.size ( ), e[ 0 ], detail::maximum{ } );
+}
+// the number of true (non-zero) values, of a mask.
+template<typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+[[nodiscard]] std::size_t count ( E const & e ) noexcept {
+    return detail::fold<std::size_t> ( cast<bool> ( e ), 0u, e.size ( ), std::size_t{ 0 }, std::plus<>{ } );
+}
+template<typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+[[nodiscard]] bool any ( E const & e ) noexcept {
+    std::size_t const n = e.size ( );
+    for ( std::size_t i = 0; i < n; i += 256u ) // blocks, for an early out that doesn't stop the vectorization.
+        if ( detail::fold<bool> ( cast<bool> ( e ), i, std::min ( n, i + 256u ), false, std::logical_or<>{ } ) )
+            return true;
+    return false;
+}
+template<typename E, std::enable_if_t<is_node_v<E>, int> = 0>
+[[nodiscard]] bool all ( E const & e ) noexcept {
+    return not any ( not e );
+}
+
+} // namespace pdr::expr
@@ -0,0 +1,154 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <type_traits>
+
+#if defined( __AVX__ ) or defined( __SSE2__ ) or defined( _M_X64 )
+#    include <immintrin.h>
+#endif
+
+#include "copy.hpp"
+
+namespace pdr {
+
+namespace detail {
+
+#if defined( __AVX__ )
+inline constexpr std::size_t vector_width = 32u;
+#else
+inline constexpr std::size_t vector_width = 16u;
+#endif
+
+// whether the size bytes at p are all the same, i.e. whether a fill is a memset.
+[[nodiscard]] inline bool is_byte_repeatable ( void const * const p, std::size_t const size ) noexcept {
+    unsigned char const * const b = static_cast<unsigned char const *> ( p );
+    for ( std::size_t i = 1; i < size; ++i )
+        if ( b[ i ] != b[ 0 ] )
+            return false;
+    return true;
+}
+
+// fills size bytes at d with pattern, 2 vectors of a value whose size divides the vector width, the vectors get
+// loaded from it at the phase of the first aligned address.
+inline void fill_pattern ( char * d, unsigned char const * const pattern, std::size_t size ) noexcept {
+    constexpr std::size_t width = vector_width;
+    // align the destination.
+    std::size_t const head = std::min ( size, ( width - ( reinterpret_cast<std::uintptr_t> ( d ) & ( width - 1u ) ) ) & ( width - 1u ) );
+    std::memcpy ( d, pattern, head );
+    d += head, size -= head;
+#if defined( __AVX__ )
+    __m256i const v = _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( pattern + head ) );
+    if ( streaming_threshold ( ) and size >= streaming_threshold ( ) ) { // bypass the cache, no reads for ownership.
+        for ( ; size >= 128u; d += 128, size -= 128u ) {
+            _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d ), v );
+            _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d + 32 ), v );
+            _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d + 64 ), v );
+            _mm256_stream_si256 ( reinterpret_cast<__m256i *> ( d + 96 ), v );
+        }
+        _mm_sfence ( ); // non-temporal stores are weakly ordered.
+    }
+    for ( ; size >= 128u; d += 128, size -= 128u ) {
+        _mm256_store_si256 ( reinterpret_cast<__m256i *> ( d ), v );
+        _mm256_store_si256 ( reinterpret_cast<__m256i *> ( d + 32 ), v );
+        _mm256_store_si256 ( reinterpret_cast<__m256i *> ( d + 64 ), v );
+        _mm256_store_si256 ( reinterpret_cast<__m256i *> ( d + 96 ), v );
+    }
+    for ( ; size >= 32u; d += 32, size -= 32u )
+        _mm256_store_si256 ( reinterpret_cast<__m256i *> ( d ), v );
+#elif defined( __SSE2__ ) or defined( _M_X64 )
+    __m128i const v = _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( pattern + head ) );
+    for ( ; size >= 64u; d += 64, size -= 64u ) {
+        _mm_store_si128 ( reinterpret_cast<__m128i *> ( d ), v );
+        _mm_store_si128 ( reinterpret_cast<__m128i *> ( d + 16 ), v );
+        _mm_store_si128 ( reinterpret_cast<__m128i *> ( d + 32 ), v );
+        _mm_store_si128 ( reinterpret_cast<__m128i *> ( d + 48 ), v );
+    }
+    for ( ; size >= 16u; d += 16, size -= 16u )
+        _mm_store_si128 ( reinterpret_cast<__m128i *> ( d ), v );
+#else
+    for ( ; size >= width; d += width, size -= width )
+        std::memcpy ( d, pattern + head, width );
+#endif
+    std::memcpy ( d, pattern + head, size ); // the tail, head + size < 2 * width.
+}
+
+} // namespace detail
+
+// fills count values of size bytes at dst with (copies of) the value at value, which should not lie in the range. A
+// memset if the value is byte-repeatable, a vector broadcast (streaming from the streaming threshold on) if its size
+// divides the vector width, and doubling copies of the filled part for other sizes.
+inline void fill ( void * const dst, void const * const value, std::size_t const size, std::size_t const count ) noexcept {
+    if ( not count )
+        return;
+    std::size_t const bytes = size * count;
+    if ( detail::is_byte_repeatable ( value, size ) ) {
+        std::memset ( dst, *static_cast<unsigned char const *> ( value ), bytes );
+        return;
+    }
+    if ( detail::vector_width % size == 0u ) {
+        alignas ( 32 ) unsigned char pattern[ 2u * detail::vector_width ];
+        for ( std::size_t i = 0; i < sizeof ( pattern ); i += size )
+            std::memcpy ( pattern + i, value, size );
+        detail::fill_pattern ( static_cast<char *> ( dst ), pattern, bytes );
+        return;
+    }
+    // the filled part doubles up to a chunk (of whole values) that stays in L1, which is then repeated.
+    char * const d          = static_cast<char *> ( dst );
+    std::size_t const chunk = std::max ( size, std::size_t{ 4'096u } / size * size );
+    std::size_t filled      = size;
+    std::memcpy ( d, value, size );
+    while ( filled < bytes ) {
+        std::size_t const n = std::min ( std::min ( filled, chunk ), bytes - filled );
+        std::memcpy ( d + filled, d, n );
+        filled += n;
+    }
+}
+
+// count values first, first + stride, first + 2 * stride, ..., for arithmetic types, computed as first + i * stride,
+// i.e. a plain induction the compiler vectorizes. For the integers that's modulo 2^n (exact, as repeated addition),
+// for floating point there's no drift from repeated rounding.
+template<typename Type>
+void iota ( Type * const dst, std::size_t const count, Type const first, Type const stride ) noexcept {
+    static_assert ( std::is_arithmetic<Type>::value and not std::is_same<Type, bool>::value, "Type must be arithmetic!" );
+    if constexpr ( std::is_floating_point<Type>::value ) {
+        for ( std::size_t i = 0; i < count; ++i )
+            dst[ i ] = first + static_cast<Type> ( i ) * stride;
+    }
+    else {
+        // unsigned (at least unsigned int, no promotion to int), modulo 2^n either way.
+        using word   = std::conditional_t<sizeof ( Type ) <= sizeof ( unsigned ), unsigned, std::make_unsigned_t<Type>>;
+        word const f = static_cast<word> ( first ), s = static_cast<word> ( stride );
+        for ( std::size_t i = 0; i < count; ++i )
+            dst[ i ] = static_cast<Type> ( f + static_cast<word> ( i ) * s );
+    }
+}
+
+} // namespace pdr
@@ -0,0 +1,197 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+#include <algorithm>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "podder.hpp"
+
+namespace pdr {
+
+// A gap buffer on podder storage, for edits clustered around a (moving) cursor. The values live in [ 0, g0 ) and
+// [ g1, n ) of the block of n values, the gap [ g0, g1 ) sits at the cursor. Inserting and erasing at the cursor is
+// O ( 1 ) amortized, moving the cursor costs one memmove of the values in between, and data ( ) closes the gap (by
+// moving it to the back) only when a contiguous view is asked for. Growing the block goes by resize_reserve_only, i.e.
+// by realloc, after which only the values after the gap move.
+template<typename Type, typename SizeType = std::size_t, typename GrowthPolicy = visual_studio_growth_policy<SizeType>>
+class gap_podder {
+
+    public:
+    using value_type      = Type;
+    using size_type       = SizeType;
+    using podder_type     = podder<Type, SizeType, GrowthPolicy>;
+    using pointer         = value_type *;
+    using const_pointer   = value_type const *;
+    using reference       = value_type &;
+    using const_reference = value_type const &;
+
+    private:
+    podder_type b; // the block, values and gap.
+    size_type g0 = 0, g1 = 0;
+
+    [[nodiscard]] size_type gap ( ) const noexcept { return g1 - g0; }
+    [[nodiscard]] size_type tail ( ) const noexcept { return static_cast<size_type> ( b.size ( ) ) - g1; }
+
+    // makes the gap at least count values wide.
+    void make_room ( size_type const count ) noexcept {
+        if ( gap ( ) >= count )
+            return;
+        size_type const n0 = static_cast<size_type> ( b.size ( ) ), t = tail ( );
+        size_type const n1 = std::max ( static_cast<size_type> ( GrowthPolicy::grow_capacity_from ( n0 ) ),
+                                        static_cast<size_type> ( n0 - gap ( ) + count ) );
+        b.resize_reserve_only ( n1 );
+        pointer const p = b.data ( );
+        std::memmove ( ( void * ) ( p + n1 - t ), ( void * ) ( p + g1 ), t * sizeof ( value_type ) );
+        g1 = n1 - t;
+    }
+
+    public:
+    gap_podder ( ) noexcept = default;
+    gap_podder ( const_pointer const first, size_type const count ) noexcept :
+        b ( first, count ), g0 ( count ), g1 ( count ) {}
+    gap_podder ( std::initializer_list<value_type> il ) noexcept :
+        gap_podder ( il.begin ( ), static_cast<size_type> ( il.size ( ) ) ) {}
+
+    [[nodiscard]] size_type size ( ) const noexcept { return static_cast<size_type> ( b.size ( ) ) - gap ( ); }
+    [[nodiscard]] bool empty ( ) const noexcept { return not size ( ); }
+    [[nodiscard]] size_type capacity ( ) const noexcept { return static_cast<size_type> ( b.capacity ( ) ); }
+    [[nodiscard]] size_type cursor ( ) const noexcept { return g0; }
+
+    void reserve ( size_type const count ) noexcept {
+        if ( count > size ( ) )
+            make_room ( count - size ( ) );
+    }
+
+    void clear ( ) noexcept {
+        b.clear ( );
+        g0 = g1 = 0;
+    }
+
+    // moves the gap to i (in [ 0, size ( ) ]), one memmove of the values in between.
+    void move_to ( size_type const i ) noexcept {
+        assert ( i <= size ( ) );
+        pointer const p = b.data ( );
+        if ( i < g0 )
+            std::memmove ( ( void * ) ( p + i + gap ( ) ), ( void * ) ( p + i ), ( g0 - i ) * sizeof ( value_type ) );
+        else if ( i > g0 )
+            std::memmove ( ( void * ) ( p + g0 ), ( void * ) ( p + g1 ), ( i - g0 ) * sizeof ( value_type ) );
+        g1 = i + gap ( );
+        g0 = i;
+    }
+
+    // element access.
+
+    [[nodiscard]] reference operator[] ( size_type const i ) noexcept {
+        assert ( i < size ( ) );
+        return b[ i < g0 ? i : i + gap ( ) ];
+    }
+    [[nodiscard]] const_reference operator[] ( size_type const i ) const noexcept {
+        assert ( i < size ( ) );
+        return b[ i < g0 ? i : i + gap ( ) ];
+    }
+    [[nodiscard]] reference front ( ) noexcept { return ( *this )[ 0 ]; }
+    [[nodiscard]] const_reference front ( ) const noexcept { return ( *this )[ 0 ]; }
+    [[nodiscard]] reference back ( ) noexcept { return ( *this )[ size ( ) - 1 ]; }
+    [[nodiscard]] const_reference back ( ) const noexcept { return ( *this )[ size ( ) - 1 ]; }
+
+    // the values, contiguous, moves the gap to the back (if not there already).
+    [[nodiscard]] pointer data ( ) noexcept {
+        move_to ( size ( ) );
+        return b.data ( );
+    }
+
+    // the two runs of values either side of the gap, no values are moved.
+    [[nodiscard]] std::pair<const_pointer, size_type> before ( ) const noexcept { return { b.data ( ), g0 }; }
+    [[nodiscard]] std::pair<const_pointer, size_type> after ( ) const noexcept { return { b.data ( ) + g1, tail ( ) }; }
+
+    // modifiers, all move the cursor to ( after ) the edit.
+
+    template<typename... Args>
+    reference emplace ( size_type const i, Args &&... args ) noexcept {
+        value_type const v{ std::forward<Args> ( args )... }; // args might refer into the block.
+        move_to ( i );
+        make_room ( 1 );
+        return *new ( b.data ( ) + g0++ ) value_type{ v };
+    }
+    reference insert ( size_type const i, const_reference value ) noexcept { return emplace ( i, value ); }
+
+    void insert ( size_type const i, size_type const count, const_reference value ) noexcept {
+        value_type const v = value;
+        move_to ( i );
+        make_room ( count );
+        pdr::fill ( ( void * ) ( b.data ( ) + g0 ), ( void const * ) &v, sizeof ( value_type ), count );
+        g0 += count;
+    }
+    void insert ( size_type const i, const_pointer const first, size_type const count ) noexcept {
+        if ( not count )
+            return;
+        if ( first >= b.data ( ) and first < b.data ( ) + b.size ( ) ) { // inserting (part of) itself.
+            podder_type const values ( first, count );
+            insert ( i, values.data ( ), count );
+            return;
+        }
+        move_to ( i );
+        make_room ( count );
+        std::memcpy ( ( void * ) ( b.data ( ) + g0 ), ( void * ) first, count * sizeof ( value_type ) );
+        g0 += count;
+    }
+
+    void push_back ( const_reference value ) noexcept { emplace ( size ( ), value ); }
+
+    // erases count values from i on.
+    void erase ( size_type const i, size_type const count = 1 ) noexcept {
+        assert ( i + count <= size ( ) );
+        move_to ( i );
+        g1 += count;
+    }
+    void pop_back ( ) noexcept { erase ( size ( ) - 1 ); }
+
+    // the storage, with the gap closed.
+    [[nodiscard]] podder_type release ( ) noexcept {
+        move_to ( size ( ) );
+        b.resize ( g0 );
+        g1 = g0 = 0;
+        return std::move ( b );
+    }
+
+    [[nodiscard]] bool operator== ( gap_podder const & rhs ) const noexcept {
+        if ( size ( ) != rhs.size ( ) )
+            return false;
+        for ( size_type i = 0; i < size ( ); ++i )
+            if ( not( ( *this )[ i ] == rhs[ i ] ) )
+                return false;
+        return true;
+    }
+    [[nodiscard]] bool operator!= ( gap_podder const & rhs ) const noexcept { return not( *this == rhs ); }
+};
+
+} // namespace pdr
@@ -54,9 +54,13 @@ struct ratio_growth_policy {
 
     using size_type = SizeType;
 
+    // R::num * capacity_ overflows for the golden ratio (and grows by nothing for small ratios and capacities),
+    // hence the double and the lower bound of capacity_ + 1.
     static constexpr size_type grow_capacity_from ( size_type const capacity_ = 1 ) noexcept pure_function {
-        // assert tbd
-        return std::max ( std::size_t{ 2 }, ( R::num * static_cast<std::size_t> ( capacity_ ) + 1 ) / R::den );
+        constexpr double ratio = static_cast<double> ( R::num ) / static_cast<double> ( R::den );
+        assert ( capacity_ < std::numeric_limits<size_type>::max ( ) / 2 );
+        return std::max ( std::max ( size_type{ 2 }, static_cast<size_type> ( capacity_ + 1 ) ),
+                          static_cast<size_type> ( static_cast<double> ( capacity_ ) * ratio + 0.5 ) );
     }
 };
 
@@ -0,0 +1,194 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#if defined( _MSC_VER ) and not defined( __clang__ )
+#    include <intrin.h>
+#endif
+
+// the wyhash (final 4) construction, with fixed secrets and little-endian reads, i.e. the hash of a sequence
+// of bytes is the same in every run, build and (64 bit) platform, podder hashes can be stored on disk.
+
+namespace pdr {
+
+namespace detail {
+
+inline constexpr std::uint64_t hash_secret[ 4 ]{ 0x2D35'8DCC'AA6C'78A5ull, 0x8BB8'4B93'962E'ACC9ull, 0x4B33'A62E'D433'D4A3ull,
+                                                 0x4D5A'2DA5'1DE1'AA47ull };
+
+inline void mum ( std::uint64_t & a, std::uint64_t & b ) noexcept { // 64 x 64 -> 128 bit multiply, low in a, high in b.
+#if defined( __SIZEOF_INT128__ )
+    __uint128_t const r = static_cast<__uint128_t> ( a ) * b;
+    a                   = static_cast<std::uint64_t> ( r );
+    b                   = static_cast<std::uint64_t> ( r >> 64 );
+#elif defined( _MSC_VER ) and defined( _M_X64 )
+    a = _umul128 ( a, b, &b );
+#else
+    std::uint64_t const ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t> ( a ), lb = static_cast<std::uint32_t> ( b );
+    std::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + ( rm0 << 32 );
+    std::uint64_t hi = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + ( t < rl );
+    std::uint64_t lo = t + ( rm1 << 32 );
+    hi += lo < t;
+    a = lo, b = hi;
+#endif
+}
+
+[[nodiscard]] inline std::uint64_t mix ( std::uint64_t a, std::uint64_t b ) noexcept {
+    mum ( a, b );
+    return a ^ b;
+}
+
+template<typename Word>
+[[nodiscard]] inline Word read_le ( unsigned char const * p ) noexcept {
+    Word w;
+    std::memcpy ( &w, p, sizeof ( Word ) );
+#if defined( __BYTE_ORDER__ ) and __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    if constexpr ( sizeof ( Word ) == 8u )
+        w = __builtin_bswap64 ( w );
+    else
+        w = __builtin_bswap32 ( w );
+#endif
+    return w;
+}
+
+[[nodiscard]] inline std::uint64_t r8 ( unsigned char const * p ) noexcept { return read_le<std::uint64_t> ( p ); }
+[[nodiscard]] inline std::uint64_t r4 ( unsigned char const * p ) noexcept { return read_le<std::uint32_t> ( p ); }
+[[nodiscard]] inline std::uint64_t r3 ( unsigned char const * p, std::size_t const k ) noexcept {
+    return ( std::uint64_t{ p[ 0 ] } << 16 ) | ( std::uint64_t{ p[ k >> 1 ] } << 8 ) | p[ k - 1u ];
+}
+
+[[nodiscard]] inline std::uint64_t finish ( std::uint64_t a, std::uint64_t b, std::uint64_t const seed,
+                                            std::size_t const size ) noexcept {
+    a ^= hash_secret[ 1 ];
+    b ^= seed;
+    mum ( a, b );
+    return mix ( a ^ hash_secret[ 0 ] ^ size, b ^ hash_secret[ 1 ] );
+}
+
+// up to 16 bytes, branch-light, all in registers.
+[[nodiscard]] inline std::uint64_t hash_16 ( unsigned char const * p, std::size_t const size, std::uint64_t const seed ) noexcept {
+    std::uint64_t a = 0, b = 0;
+    if ( size >= 4u ) {
+        std::size_t const o = ( size >> 3 ) << 2;
+        a                   = ( r4 ( p ) << 32 ) | r4 ( p + o );
+        b                   = ( r4 ( p + size - 4u ) << 32 ) | r4 ( p + size - 4u - o );
+    }
+    else if ( size ) {
+        a = r3 ( p, size );
+    }
+    return finish ( a, b, seed, size );
+}
+
+[[nodiscard]] inline std::uint64_t initial ( std::uint64_t const seed ) noexcept {
+    return seed ^ mix ( seed ^ hash_secret[ 0 ], hash_secret[ 1 ] );
+}
+
+} // namespace detail
+
+// hashes size bytes at data, 3 independent lanes of 48 byte blocks for long inputs.
+[[nodiscard]] inline std::uint64_t hash_bytes ( void const * data, std::size_t const size, std::uint64_t seed = 0u ) noexcept {
+    using namespace detail;
+    unsigned char const * p = static_cast<unsigned char const *> ( data );
+    seed                    = initial ( seed );
+    if ( size <= 16u )
+        return hash_16 ( p, size, seed );
+    std::size_t i = size;
+    if ( i > 48u ) {
+        std::uint64_t see1 = seed, see2 = seed;
+        do {
+            seed = mix ( r8 ( p ) ^ hash_secret[ 1 ], r8 ( p + 8 ) ^ seed );
+            see1 = mix ( r8 ( p + 16 ) ^ hash_secret[ 2 ], r8 ( p + 24 ) ^ see1 );
+            see2 = mix ( r8 ( p + 32 ) ^ hash_secret[ 3 ], r8 ( p + 40 ) ^ see2 );
+            p += 48, i -= 48u;
+        } while ( i > 48u );
+        seed ^= see1 ^ see2;
+    }
+    while ( i > 16u ) {
+        seed = mix ( r8 ( p ) ^ hash_secret[ 1 ], r8 ( p + 8 ) ^ seed );
+        i -= 16u, p += 16;
+    }
+    return finish ( r8 ( p + i - 16u ), r8 ( p + i - 8u ), seed, size );
+}
+
+// the short path, for inputs that fit a svo buffer (up to 32 bytes), no loops. Equals hash_bytes.
+[[nodiscard]] inline std::uint64_t hash_short ( void const * data, std::size_t const size, std::uint64_t seed = 0u ) noexcept {
+    using namespace detail;
+    if ( size > 32u ) // not a short input after all.
+        return hash_bytes ( data, size, seed );
+    unsigned char const * p = static_cast<unsigned char const *> ( data );
+    seed                    = initial ( seed );
+    if ( size <= 16u )
+        return hash_16 ( p, size, seed );
+    seed = mix ( r8 ( p ) ^ hash_secret[ 1 ], r8 ( p + 8 ) ^ seed );
+    return finish ( r8 ( p + size - 16u ), r8 ( p + size - 8u ), seed, size );
+}
+
+// a container with its hash, computed on construction (and on modify). Equality tests the hashes first.
+template<typename Container, typename Hash = std::hash<Container>>
+class hashed {
+    Container c;
+    std::size_t h;
+
+    public:
+    hashed ( ) : c ( ), h ( Hash{ }( c ) ) {}
+    explicit hashed ( Container const & c_ ) : c ( c_ ), h ( Hash{ }( c ) ) {}
+    explicit hashed ( Container && c_ ) noexcept : c ( std::move ( c_ ) ), h ( Hash{ }( c ) ) {}
+
+    [[nodiscard]] Container const & get ( ) const noexcept { return c; }
+    [[nodiscard]] operator Container const & ( ) const noexcept { return c; }
+    [[nodiscard]] std::size_t hash ( ) const noexcept { return h; }
+
+    // applies f to the container and rehashes.
+    template<typename F>
+    void modify ( F && f ) {
+        std::forward<F> ( f ) ( c );
+        h = Hash{ }( c );
+    }
+
+    [[nodiscard]] Container release ( ) noexcept {
+        h = Hash{ }( Container{ } );
+        return std::exchange ( c, Container{ } );
+    }
+
+    [[nodiscard]] bool operator== ( hashed const & rhs ) const noexcept { return h == rhs.h and c == rhs.c; }
+    [[nodiscard]] bool operator!= ( hashed const & rhs ) const noexcept { return not operator== ( rhs ); }
+};
+
+} // namespace pdr
+
+namespace std {
+template<typename Container, typename Hash>
+struct hash<pdr::hashed<Container, Hash>> {
+    [[nodiscard]] std::size_t operator( ) ( pdr::hashed<Container, Hash> const & h ) const noexcept { return h.hash ( ); }
+};
+} // namespace std
@@ -0,0 +1,186 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#include "podder.hpp"
+
+namespace pdr {
+
+// An interning pool, equal (bitwise) sequences of values are stored once, in one arena, and are identified by a
+// 32 bit handle. The table is open-addressed (linear probing) on the content hash, lookups hash and compare in
+// place, i.e. they never allocate. Handles are stable, views are invalidated by interning a new sequence (the arena
+// might move).
+template<typename Type, typename SizeType = std::uint32_t>
+class interner {
+
+    static_assert ( std::is_trivially_copyable<Type>::value, "Type must be trivially copyable!" );
+
+    public:
+    using value_type    = Type;
+    using const_pointer = value_type const *;
+    using size_type     = SizeType;
+    using handle        = std::uint32_t;
+
+    // a (non-owning) view on an interned sequence.
+    class view {
+        const_pointer b, e;
+
+        public:
+        constexpr view ( const_pointer b_, const_pointer e_ ) noexcept : b ( b_ ), e ( e_ ) {}
+
+        [[nodiscard]] const_pointer data ( ) const noexcept { return b; }
+        [[nodiscard]] std::size_t size ( ) const noexcept { return static_cast<std::size_t> ( e - b ); }
+        [[nodiscard]] bool empty ( ) const noexcept { return b == e; }
+        [[nodiscard]] const_pointer begin ( ) const noexcept { return b; }
+        [[nodiscard]] const_pointer end ( ) const noexcept { return e; }
+        [[nodiscard]] value_type const & operator[] ( std::size_t const i ) const noexcept { return b[ i ]; }
+
+        template<typename Podder = podder<value_type>>
+        [[nodiscard]] Podder to_podder ( ) const noexcept {
+            return Podder ( b, static_cast<typename Podder::size_type> ( size ( ) ) );
+        }
+    };
+
+    private:
+    static constexpr handle empty_slot = std::numeric_limits<handle>::max ( );
+
+    podder<value_type, size_type> arena;
+    // offsets[ h ] to offsets[ h + 1 ] is sequence h, starts out as one 0.
+    podder<size_type, size_type> offsets = podder<size_type, size_type> ( size_type{ 1 }, size_type{ 0 } );
+    podder<std::uint32_t, size_type> hashes; // per handle, to probe and rehash without the contents.
+    podder<handle, size_type> slots;         // a power of 2 in size, or empty.
+
+    // a small podder's values are in its svo buffer, i.e. in the interner.
+    template<typename Podder>
+    [[nodiscard]] static std::size_t heap_bytes ( Podder const & p ) noexcept {
+        return p.svo_model ( ) == Podder::svo_type::small ? std::size_t{ 0 }
+                                                          : static_cast<std::size_t> ( p.capacity_in_bytes ( ) );
+    }
+
+    [[nodiscard]] static std::uint32_t hash_of ( const_pointer p, std::size_t const count ) noexcept {
+        std::uint64_t const h = hash_short ( p, count * sizeof ( value_type ) ); // loops only if > 32 bytes.
+        return static_cast<std::uint32_t> ( h ^ ( h >> 32 ) );
+    }
+
+    [[nodiscard]] bool equals ( handle const h, const_pointer p, std::size_t const count ) const noexcept {
+        std::size_t const n = offsets[ h + 1 ] - offsets[ h ];
+        return n == count and ( not n or std::memcmp ( arena.data ( ) + offsets[ h ], p, n * sizeof ( value_type ) ) == 0 );
+    }
+
+    // the slot holding the handle of the sequence, or the empty slot where it would go.
+    [[nodiscard]] std::size_t probe ( std::uint32_t const hash, const_pointer p, std::size_t const count ) const noexcept {
+        std::size_t const mask = slots.size ( ) - 1u;
+        for ( std::size_t i = hash & mask;; i = ( i + 1u ) & mask ) {
+            handle const h = slots[ i ];
+            if ( h == empty_slot or ( hashes[ h ] == hash and equals ( h, p, count ) ) )
+                return i;
+        }
+    }
+
+    void rehash ( std::size_t const slot_count ) noexcept {
+        slots.clear ( );
+        slots.resize ( static_cast<size_type> ( slot_count ) );
+        std::fill ( slots.begin ( ), slots.end ( ), empty_slot );
+        std::size_t const mask = slot_count - 1u;
+        for ( handle h = 0; h < hashes.size ( ); ++h ) {
+            std::size_t i = hashes[ h ] & mask;
+            while ( slots[ i ] != empty_slot )
+                i = ( i + 1u ) & mask;
+            slots[ i ] = h;
+        }
+    }
+
+    public:
+    interner ( ) noexcept = default;
+
+    // the handle of the sequence [ p, p + count ), interning it if new.
+    [[nodiscard]] handle intern ( const_pointer p, std::size_t const count ) noexcept {
+        if ( 4u * ( size ( ) + 1u ) > 3u * slots.size ( ) ) // load factor 3 / 4.
+            rehash ( slots.size ( ) ? 2u * slots.size ( ) : 16u );
+        std::uint32_t const hash = hash_of ( p, count );
+        std::size_t const i      = probe ( hash, p, count );
+        if ( slots[ i ] != empty_slot )
+            return slots[ i ];
+        assert ( size ( ) < empty_slot );
+        assert ( arena.size ( ) + count <= std::numeric_limits<size_type>::max ( ) );
+        handle const h = static_cast<handle> ( hashes.size ( ) );
+        arena.insert ( arena.end ( ), p, static_cast<size_type> ( count ) );
+        offsets.emplace_back ( arena.size ( ) );
+        hashes.emplace_back ( hash );
+        slots[ i ] = h;
+        return h;
+    }
+    template<typename Container>
+    [[nodiscard]] handle intern ( Container const & c ) noexcept {
+        return intern ( std::data ( c ), std::size ( c ) );
+    }
+
+    // the handle of the sequence, if interned.
+    [[nodiscard]] std::optional<handle> find ( const_pointer p, std::size_t const count ) const noexcept {
+        if ( slots.empty ( ) )
+            return { };
+        handle const h = slots[ probe ( hash_of ( p, count ), p, count ) ];
+        return h == empty_slot ? std::optional<handle>{ } : std::optional<handle>{ h };
+    }
+    template<typename Container>
+    [[nodiscard]] std::optional<handle> find ( Container const & c ) const noexcept {
+        return find ( std::data ( c ), std::size ( c ) );
+    }
+
+    [[nodiscard]] view get ( handle const h ) const noexcept {
+        assert ( h < size ( ) );
+        return { arena.data ( ) + offsets[ h ], arena.data ( ) + offsets[ h + 1 ] };
+    }
+    [[nodiscard]] view operator[] ( handle const h ) const noexcept { return get ( h ); }
+
+    // the number of distinct sequences.
+    [[nodiscard]] std::size_t size ( ) const noexcept { return hashes.size ( ); }
+    [[nodiscard]] bool empty ( ) const noexcept { return hashes.empty ( ); }
+
+    // the (heap) memory in use, in bytes.
+    [[nodiscard]] std::size_t memory_in_bytes ( ) const noexcept {
+        return heap_bytes ( arena ) + heap_bytes ( offsets ) + heap_bytes ( hashes ) + heap_bytes ( slots );
+    }
+
+    void clear ( ) noexcept {
+        arena.clear ( );
+        offsets.clear ( );
+        offsets.emplace_back ( size_type{ 0 } );
+        hashes.clear ( );
+        slots.clear ( );
+    }
+};
+
+} // namespace pdr
@@ -24,24 +24,33 @@
 #pragma once
 
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 
 #include <algorithm>
 #include <array>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <optional>
-#include <sax/iostream.hpp>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "compare.hpp"
+#include "copy.hpp"
+#include "fill.hpp"
 #include "growth_policy.hpp"
+#include "hash.hpp"
 #include "null_allocator.hpp"
+#include "profile.hpp"
+#include "stats.hpp"
 #include "tagged_pointer.hpp"
 
 #ifndef pure_function
@@ -81,7 +90,9 @@ void div ( char ( * )[ I % 2 == 1 ] = 0 ) {
 }
 
 // costumization point.
-#define USE_MIMALLOC true
+#ifndef USE_MIMALLOC
+#    define USE_MIMALLOC true
+#endif
 
 #if USE_MIMALLOC
 #    if defined( _DEBUG )
@@ -90,29 +101,182 @@ void div ( char ( * )[ I % 2 == 1 ] = 0 ) {
 #        define USE_MIMALLOC_LTO true
 #    endif
 #    include <mimalloc.h>
+#else
+#    include <malloc.h>
 #endif
 
 namespace pdr {
+namespace detail {
 #if USE_MIMALLOC
-[[nodiscard]] inline void * malloc ( std::size_t size ) noexcept { return mi_malloc ( size ); }
-[[nodiscard]] inline void * zalloc ( std::size_t size ) noexcept { return mi_zalloc ( size ); }
-[[nodiscard]] inline void * calloc ( std::size_t num, std::size_t size ) noexcept { return mi_calloc ( num, size ); }
-[[nodiscard]] inline void * realloc ( void * ptr, std::size_t new_size ) noexcept { return mi_realloc ( ptr, new_size ); }
-inline void free ( void * ptr ) noexcept { mi_free ( ptr ); }
+[[nodiscard]] inline void * sys_malloc ( std::size_t size ) noexcept { return mi_malloc ( size ); }
+[[nodiscard]] inline void * sys_zalloc ( std::size_t size ) noexcept { return mi_zalloc ( size ); }
+[[nodiscard]] inline void * sys_calloc ( std::size_t num, std::size_t size ) noexcept { return mi_calloc ( num, size ); }
+[[nodiscard]] inline void * sys_realloc ( void * ptr, std::size_t new_size ) noexcept { return mi_realloc ( ptr, new_size ); }
+inline void sys_free ( void * ptr ) noexcept { mi_free ( ptr ); }
+[[nodiscard]] inline std::size_t sys_usable_size ( void * ptr ) noexcept { return mi_usable_size ( ptr ); }
+[[nodiscard]] inline void * sys_aligned_malloc ( std::size_t alignment, std::size_t size ) noexcept {
+    return mi_malloc_aligned ( size, alignment );
+}
+[[nodiscard]] inline void * sys_aligned_calloc ( std::size_t alignment, std::size_t num, std::size_t size ) noexcept {
+    return mi_calloc_aligned ( num, size, alignment );
+}
+[[nodiscard]] inline void * sys_aligned_realloc ( void * ptr, std::size_t alignment, std::size_t new_size ) noexcept {
+    return mi_realloc_aligned ( ptr, new_size, alignment );
+}
+inline void sys_aligned_free ( void * ptr ) noexcept { mi_free ( ptr ); }
+[[nodiscard]] inline std::size_t sys_aligned_usable_size ( void * ptr, std::size_t ) noexcept { return mi_usable_size ( ptr ); }
 #else
-[[nodiscard]] inline void * malloc ( std::size_t size ) noexcept { return std::malloc ( size ); }
-[[nodiscard]] inline void * zalloc ( std::size_t size ) noexcept { return std::calloc ( 1u, size ); }
-[[nodiscard]] inline void * calloc ( std::size_t num, std::size_t size ) noexcept { return std::calloc ( num, size ); }
-[[nodiscard]] inline void * realloc ( void * ptr, std::size_t new_size ) noexcept { return std::realloc ( ptr, new_size ); }
-inline void free ( void * ptr ) noexcept { std::free ( ptr ); }
+[[nodiscard]] inline void * sys_malloc ( std::size_t size ) noexcept { return std::malloc ( size ); }
+[[nodiscard]] inline void * sys_zalloc ( std::size_t size ) noexcept { return std::calloc ( 1u, size ); }
+[[nodiscard]] inline void * sys_calloc ( std::size_t num, std::size_t size ) noexcept { return std::calloc ( num, size ); }
+[[nodiscard]] inline void * sys_realloc ( void * ptr, std::size_t new_size ) noexcept { return std::realloc ( ptr, new_size ); }
+inline void sys_free ( void * ptr ) noexcept { std::free ( ptr ); }
+#    ifdef _WIN32
+[[nodiscard]] inline std::size_t sys_usable_size ( void * ptr ) noexcept { return _msize ( ptr ); }
+[[nodiscard]] inline void * sys_aligned_malloc ( std::size_t alignment, std::size_t size ) noexcept {
+    return _aligned_malloc ( size, alignment );
+}
+[[nodiscard]] inline void * sys_aligned_calloc ( std::size_t alignment, std::size_t num, std::size_t size ) noexcept {
+    return _aligned_recalloc ( nullptr, num, size, alignment );
+}
+[[nodiscard]] inline void * sys_aligned_realloc ( void * ptr, std::size_t alignment, std::size_t new_size ) noexcept {
+    return _aligned_realloc ( ptr, new_size, alignment );
+}
+inline void sys_aligned_free ( void * ptr ) noexcept { _aligned_free ( ptr ); }
+// _msize is undefined on an _aligned_malloc block.
+[[nodiscard]] inline std::size_t sys_aligned_usable_size ( void * ptr, std::size_t alignment ) noexcept {
+    return _aligned_msize ( ptr, alignment, 0 );
+}
+#    else
+[[nodiscard]] inline std::size_t sys_usable_size ( void * ptr ) noexcept { return malloc_usable_size ( ptr ); }
+// aligned_alloc wants a multiple of the alignment.
+[[nodiscard]] inline void * sys_aligned_malloc ( std::size_t alignment, std::size_t size ) noexcept {
+    return std::aligned_alloc ( alignment, ( size + alignment - 1u ) & ~( alignment - 1u ) );
+}
+// there's no aligned calloc either, the block is zeroed eagerly (not lazily, by fresh pages, as calloc's are).
+[[nodiscard]] inline void * sys_aligned_calloc ( std::size_t alignment, std::size_t num, std::size_t size ) noexcept {
+    void * const p = sys_aligned_malloc ( alignment, num * size );
+    if ( p )
+        std::memset ( p, 0, num * size );
+    return p;
+}
+// there's no aligned realloc, a realloc that comes back misaligned is moved (once more) into an aligned block.
+[[nodiscard]] inline void * sys_aligned_realloc ( void * ptr, std::size_t alignment, std::size_t new_size ) noexcept {
+    void * const p = std::realloc ( ptr, new_size );
+    if ( not( reinterpret_cast<std::uintptr_t> ( p ) & ( alignment - 1u ) ) )
+        return p;
+    void * const a = sys_aligned_malloc ( alignment, new_size );
+    if ( a )
+        std::memcpy ( a, p, new_size );
+    std::free ( p );
+    return a;
+}
+inline void sys_aligned_free ( void * ptr ) noexcept { std::free ( ptr ); }
+[[nodiscard]] inline std::size_t sys_aligned_usable_size ( void * ptr, std::size_t ) noexcept { return malloc_usable_size ( ptr ); }
+#    endif
 #endif
+} // namespace detail
+
+// the allocation functions used by podder, all allocations go through these (and the stats hooks).
+
+[[nodiscard]] inline void * malloc ( std::size_t size ) noexcept {
+    stats::on_malloc ( size );
+    return detail::sys_malloc ( size );
+}
+[[nodiscard]] inline void * zalloc ( std::size_t size ) noexcept {
+    stats::on_malloc ( size );
+    return detail::sys_zalloc ( size );
+}
+[[nodiscard]] inline void * calloc ( std::size_t num, std::size_t size ) noexcept {
+    stats::on_malloc ( num * size );
+    return detail::sys_calloc ( num, size );
+}
+[[nodiscard]] inline void * realloc ( void * ptr, std::size_t new_size ) noexcept {
+    if constexpr ( stats::enabled ( ) ) {
+        std::size_t const moved = ptr ? std::min ( detail::sys_usable_size ( ptr ), new_size ) : std::size_t{ 0 };
+        void * const p          = detail::sys_realloc ( ptr, new_size );
+        stats::on_realloc ( ptr, p, moved, new_size );
+        return p;
+    }
+    else {
+        return detail::sys_realloc ( ptr, new_size );
+    }
+}
+inline void free ( void * ptr ) noexcept {
+    stats::on_free ( ptr );
+    detail::sys_free ( ptr );
+}
+
+// aligned on alignment (a power of 2, at least alignof ( std::max_align_t )), the blocks go back by aligned_free.
+[[nodiscard]] inline void * aligned_malloc ( std::size_t alignment, std::size_t size ) noexcept {
+    stats::on_malloc ( size );
+    return detail::sys_aligned_malloc ( alignment, size );
+}
+[[nodiscard]] inline void * aligned_calloc ( std::size_t alignment, std::size_t num, std::size_t size ) noexcept {
+    stats::on_malloc ( num * size );
+    return detail::sys_aligned_calloc ( alignment, num, size );
+}
+[[nodiscard]] inline void * aligned_realloc ( void * ptr, std::size_t alignment, std::size_t new_size ) noexcept {
+    if constexpr ( stats::enabled ( ) ) {
+        std::size_t const moved =
+            ptr ? std::min ( detail::sys_aligned_usable_size ( ptr, alignment ), new_size ) : std::size_t{ 0 };
+        void * const p = detail::sys_aligned_realloc ( ptr, alignment, new_size );
+        stats::on_realloc ( ptr, p, moved, new_size );
+        return p;
+    }
+    else {
+        return detail::sys_aligned_realloc ( ptr, alignment, new_size );
+    }
+}
+inline void aligned_free ( void * ptr ) noexcept {
+    stats::on_free ( ptr );
+    detail::sys_aligned_free ( ptr );
+}
+
+// a block from pdr::malloc (and friends), holding size values, handed to (adopt) or taken from (release) a podder,
+// free it with pdr::free (pdr::aligned_malloc and pdr::aligned_free for podders with an Alignment).
+template<typename Type>
+struct buffer {
+    Type * data          = nullptr;
+    std::size_t size     = 0;
+    std::size_t capacity = 0;
+};
+
+// costumization point, whether a value-initialized Type is all zero bits, i.e. whether podder can value-initialize
+// by calloc (fresh zeroed pages, which cost nothing until touched) or memset. Holds for the arithmetic types, enums,
+// pointers and the trivially default constructible classes thereof, specialize it (to false) for a class holding a
+// pointer to data member (null is -1 there).
+template<typename Type>
+struct is_zero_initialized
+    : std::bool_constant<std::is_trivially_default_constructible<Type>::value and not std::is_member_pointer<Type>::value> {};
+
+namespace detail {
+[[nodiscard]] inline bool is_zero_bytes ( void const * const p, std::size_t const size ) noexcept {
+    unsigned char const * b = static_cast<unsigned char const *> ( p );
+    for ( unsigned char const * const e = b + size; b != e; ++b )
+        if ( *b )
+            return false;
+    return true;
+}
+} // namespace detail
 } // namespace pdr
 
+// Alignment, if not 0, is the alignment of the (medium) block, f.e. 32 or 64 for simd consumers of data ( ), or 4'096
+// for a page, it's kept over reallocation. The svo buffer lives in the podder object (see svo_alignment ( )). On POSIX
+// without mimalloc there's no aligned calloc, aligned podders zero (resize, the zeroing constructors) eagerly, i.e.
+// they don't get the lazy zeroing of fresh pages unaligned podders get for large blocks.
+// TailPadding, if not 0, is the number of readable bytes past capacity ( ) (f.e. 64, a simd register), so kernels can
+// run over size ( ) values in full vectors, without a scalar epilogue. The padding is allocated on top of the
+// capacity (which, as capacity_in_bytes ( ), counts usable values only). A padded podder has no svo, there's no room
+// for padding past a buffer inside the object.
 template<typename Type = std::uint8_t, typename SizeType = std::size_t,
-         typename GrowthPolicy = visual_studio_growth_policy<SizeType>>
-class podder {
+         typename GrowthPolicy = visual_studio_growth_policy<SizeType>, std::size_t Alignment = 0u,
+         std::size_t TailPadding = 0u>
+class podder : private pdr::profile::tracker<> { // the tracker is empty, unless PODDER_PROFILE is true.
 
     static_assert ( std::is_trivially_copyable<Type>::value, "Type must be trivially copyable!" );
+    static_assert ( not Alignment or ( not( Alignment & ( Alignment - 1u ) ) and Alignment >= alignof ( std::max_align_t ) ),
+                    "Alignment must be 0, or a power of 2 of at least alignof ( std::max_align_t )!" );
     static_assert ( std::numeric_limits<typename std::make_unsigned<SizeType>::type>::digits >= 32,
                     "SizeType must be an unsigned 32- or 64-bit integer type!" );
 
@@ -209,6 +373,19 @@ class podder {
     template<typename It>
     using discontiguous_input_iterator_t = std::enable_if_t<is_discontiguous_input_iterator<It>::value, dii_tag>;
 
+    // count copies of value at p, vectorized (pdr::fill), or the sequence value, value + stride, ... if stride isn't
+    // 0. A stride only makes sense for arithmetic value_type's (bar bool), it's ignored otherwise.
+    static void fill_values ( pointer const p, size_type const count, const_reference value,
+                              [[maybe_unused]] signed_size_type const stride = 0 ) noexcept {
+        if constexpr ( std::is_arithmetic<value_type>::value and not std::is_same<value_type, bool>::value ) {
+            if ( stride ) {
+                pdr::iota ( p, count, value, static_cast<value_type> ( stride ) );
+                return;
+            }
+        }
+        pdr::fill ( ( void * ) p, ( void const * ) &value, sizeof ( value_type ), count );
+    }
+
     PUBLIC
 
     // constructors.
@@ -221,38 +398,27 @@ class podder {
             // zeroes the class. end is nullptr, capacity = 0, or when checking
             // for realocation: size == capacity, evaluates to true, i.e. needs
             // (re-)alloc'ing.
-            std::memset ( ( void * ) this, 0, sizeof ( *this ) );
+            std::memset ( ( void * ) &d, 0, sizeof ( d ) );
         }
     }
-    podder ( size_type count, const_reference value, signed_size_type stride = 0 ) noexcept {
-        value_type v = value;
+    podder ( size_type const count, const_reference value, signed_size_type const stride = 0 ) noexcept {
         if ( count ) {
             if constexpr ( svo ( ) ) {
                 if ( count <= buff_size ( ) ) {
                     set_small_size ( count );
-                    pointer p = d.s.buffer;
-                    while ( count-- ) {
-                        new ( p++ ) value_type ( std::forward<value_type> ( { v } ) );
-                        v += static_cast<value_type> ( stride );
-                    }
-                }
-                else {
-                    new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                    while ( count-- ) {
-                        new ( d.m.end++ ) value_type ( std::forward<value_type> ( { v } ) );
-                        v += static_cast<value_type> ( stride );
-                    }
+                    fill_values ( d.s.buffer, count, value, stride );
+                    return;
                 }
             }
+            pointer b;
+            if ( not stride and pdr::detail::is_zero_bytes ( &value, sizeof ( value_type ) ) ) { // fresh zeroed pages.
+                b = static_cast<pointer> ( block_calloc ( count, sizeof ( value_type ) ) );
+            }
             else {
-                new ( &d.m ) medium ( std::forward<medium> (
-                    { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                while ( count-- ) {
-                    new ( d.m.end++ ) value_type ( std::forward<value_type> ( { v } ) );
-                    v += static_cast<value_type> ( stride );
-                }
+                b = static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) );
+                fill_values ( b, count, value, stride );
             }
+            new ( &d.m ) medium{ count, count, b + count };
         }
         else {
             small_clear ( );
@@ -263,23 +429,11 @@ class podder {
             if constexpr ( svo ( ) ) {
                 if ( count <= buff_size ( ) ) {
                     set_small_size ( count );
-                    pointer p = d.s.buffer;
-                    while ( count-- )
-                        new ( p++ ) value_type ( );
-                }
-                else {
-                    new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                    while ( count-- )
-                        new ( d.m.end++ ) value_type ( );
+                    value_initialize ( d.s.buffer, d.s.buffer + count );
+                    return;
                 }
             }
-            else {
-                new ( &d.m ) medium ( std::forward<medium> (
-                    { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                while ( count-- )
-                    new ( d.m.end++ ) value_type ( );
-            }
+            new ( &d.m ) medium{ count, count, value_initialized_block ( count ) + count };
         }
         else {
             small_clear ( );
@@ -301,14 +455,14 @@ class podder {
                 }
                 else {
                     new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
+                        { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
                     while ( first != last )
                         *d.m.end++ = *first++;
                 }
             }
             else { // constexpr else.
                 new ( &d.m ) medium ( std::forward<medium> (
-                    { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
+                    { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
                 while ( first != last )
                     *d.m.end++ = *first++;
             }
@@ -318,19 +472,31 @@ class podder {
         }
     }
     podder ( podder const & p ) noexcept {
-        if ( p.d.s.is_small ) {
-            std::memcpy ( ( void * ) this, ( void * ) &p, sizeof ( podder ) );
+        if ( p.d.s.is_small or not p.d.m.capacity ) {
+            std::memcpy ( ( void * ) &d, ( void * ) &p.d, sizeof ( d ) );
         }
-        else {
-            new ( &d.m )
-                medium{ p.d.m.size, p.d.m.capacity, static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) ) };
-            std::memcpy ( ( void * ) d.m.end, ( void * ) p.begin_pointer ( ), d.m.size * sizeof ( value_type ) );
-            d.m.end += d.m.size;
+        else { // the copy gets a block of size values (p's capacity might be offset, i.e. be anything).
+            size_type const size = p.d.m.size;
+            if constexpr ( svo ( ) ) {
+                if ( size <= buff_size ( ) ) {
+                    std::memcpy ( ( void * ) d.s.buffer, ( void * ) p.begin_pointer ( ), size * sizeof ( value_type ) );
+                    set_small_size ( size );
+                    return;
+                }
+            }
+            if ( not size ) {
+                small_clear ( ); // no_svo types, the unallocated medium state.
+                return;
+            }
+            pointer const b = static_cast<pointer> ( block_malloc ( size * sizeof ( value_type ) ) );
+            pdr::bulk_copy ( ( void * ) b, ( void * ) p.begin_pointer ( ), size * sizeof ( value_type ) );
+            new ( &d.m ) medium{ size, size, b + size };
         }
     }
     podder ( podder && p ) noexcept {
-        std::memcpy ( ( void * ) this, ( void * ) &p, sizeof ( podder ) );
+        std::memcpy ( ( void * ) &d, ( void * ) &p.d, sizeof ( d ) );
         p.small_clear ( );
+        profile_move ( p );
     }
     podder ( std::initializer_list<value_type> il ) noexcept : podder ( il.begin ( ), static_cast<size_type> ( il.size ( ) ) ) {}
     template<auto S>
@@ -352,15 +518,15 @@ class podder {
                 }
                 else {
                     new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
+                        { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                    pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
                     d.m.end += d.m.size;
                 }
             }
             else {
                 new ( &d.m ) medium ( std::forward<medium> (
-                    { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
+                    { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
                 d.m.end += d.m.size;
             }
         }
@@ -372,13 +538,15 @@ class podder {
     // destructor.
 
     ~podder ( ) noexcept {
+        pdr::stats::on_destroy ( d.s.is_small, size_in_bytes ( ), capacity_in_bytes ( ) );
+        profile_exit ( sizeof ( value_type ), svo_capacity ( ), size ( ) );
         if ( not d.s.is_small ) {
-            pdr::free ( d.m.end - d.m.size );
+            block_free ( block_pointer ( ) );
             return;
         }
         if constexpr ( is_debug::value ) { // checking whether the above condition is sufficiently strong.
             if ( not d.m.end )
-                std::cerr << "This code in the destructor should be free-ing as well." << nl;
+                std::fputs ( "This code in the destructor should be free-ing as well.\n", stderr );
             return;
         }
     }
@@ -386,41 +554,48 @@ class podder {
     // assignment operator.
 
     [[maybe_unused]] podder & operator= ( podder const & rhs ) noexcept {
+        if ( this == &rhs )
+            return *this;
+        normalize ( );
         size_type const count = rhs.size ( );
         if ( not count ) {
             clear ( );
+            return *this;
         }
-        else if ( count <= buff_size ( ) ) {
-            if ( not d.s.is_small )
-                pdr::free ( d.m.end - d.m.size );
-            std::memcpy ( ( void * ) this, ( void * ) &rhs, sizeof ( podder ) );
-        }
-        else {
+        if constexpr ( svo ( ) ) {
+            if ( count <= buff_size ( ) ) { // rhs might be medium, so copy the values, not the podder.
+                if ( not d.s.is_small )
+                    block_free ( d.m.end - d.m.size );
+                std::memcpy ( ( void * ) d.s.buffer, ( void * ) rhs.begin_pointer ( ), count * sizeof ( value_type ) );
+                set_small_size ( count );
+                return *this;
+            }
             if ( d.s.is_small ) {
+                pdr::stats::on_spill ( 0 );
                 new ( &d.m ) medium ( std::forward<medium> (
-                    { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                std::memcpy ( ( void * ) d.m.end, ( void * ) ( rhs.d.m.end - rhs.d.m.size ), count * sizeof ( value_type ) );
+                    { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) ( rhs.d.m.end - rhs.d.m.size ), count * sizeof ( value_type ) );
                 d.m.end += count;
+                return *this;
             }
-            else {
-                pointer const b = d.m.end - d.m.size;
-                if ( count <= d.m.capacity ) {
-                    std::memcpy ( ( void * ) b, ( void * ) ( rhs.d.m.end - rhs.d.m.size ), count * sizeof ( value_type ) );
-                    d.m.size = count;
-                    d.m.end  = b + count;
-                }
-                else {
-                    d.m.capacity = d.m.size = count;
-                    d.m.end                 = static_cast<pointer> ( pdr::realloc ( ( void * ) b, count * sizeof ( value_type ) ) );
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) ( rhs.d.m.end - rhs.d.m.size ), count * sizeof ( value_type ) );
-                    d.m.end += count;
-                }
-            }
+        }
+        pointer const b = d.m.end - d.m.size;
+        if ( count <= d.m.capacity ) {
+            pdr::bulk_copy ( ( void * ) b, ( void * ) ( rhs.d.m.end - rhs.d.m.size ), count * sizeof ( value_type ) );
+            d.m.size = count;
+            d.m.end  = b + count;
+        }
+        else {
+            d.m.capacity = d.m.size = count;
+            d.m.end                 = static_cast<pointer> ( block_realloc ( ( void * ) b, count * sizeof ( value_type ) ) );
+            pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) ( rhs.d.m.end - rhs.d.m.size ), count * sizeof ( value_type ) );
+            d.m.end += count;
         }
         return *this;
     }
     template<typename Container>
     [[maybe_unused]] podder & operator= ( Container const & container ) noexcept {
+        normalize ( );
         size_type const count = static_cast<size_type> ( container.size ( ) );
         if ( not count ) {
             clear ( );
@@ -429,28 +604,29 @@ class podder {
         if constexpr ( is_contiguous_container<Container>::value ) {
             if ( count <= buff_size ( ) ) {
                 if ( not d.s.is_small )
-                    pdr::free ( d.m.end - d.m.size );
+                    block_free ( d.m.end - d.m.size );
                 std::memcpy ( ( void * ) d.s.buffer, ( void * ) &*std::begin ( container ), count * sizeof ( value_type ) );
                 set_small_size ( count );
             }
             else {
                 if ( d.s.is_small ) {
+                    pdr::stats::on_spill ( 0 );
                     new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) &*std::begin ( container ), count * sizeof ( value_type ) );
+                        { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                    pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) &*std::begin ( container ), count * sizeof ( value_type ) );
                     d.m.end += count;
                 }
                 else {
                     pointer const p = d.m.end - d.m.size;
                     if ( count <= d.m.capacity ) {
-                        std::memcpy ( ( void * ) p, ( void * ) &*std::begin ( container ), count * sizeof ( value_type ) );
+                        pdr::bulk_copy ( ( void * ) p, ( void * ) &*std::begin ( container ), count * sizeof ( value_type ) );
                         d.m.size = count;
                         d.m.end  = p + count;
                     }
                     else {
                         d.m.capacity = d.m.size = count;
-                        d.m.end                 = static_cast<pointer> ( pdr::realloc ( p, count * sizeof ( value_type ) ) );
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) &*std::begin ( container ), count * sizeof ( value_type ) );
+                        d.m.end                 = static_cast<pointer> ( block_realloc ( p, count * sizeof ( value_type ) ) );
+                        pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) &*std::begin ( container ), count * sizeof ( value_type ) );
                         d.m.end += count;
                     }
                 }
@@ -461,7 +637,7 @@ class podder {
             auto const last = std::cend ( container );
             if ( count <= buff_size ( ) ) {
                 if ( not d.s.is_small )
-                    pdr::free ( d.m.end - d.m.size );
+                    block_free ( d.m.end - d.m.size );
                 set_small_size ( count );
                 iterator it ( d.s.buffer );
                 while ( first != last )
@@ -469,8 +645,9 @@ class podder {
             }
             else {
                 if ( d.s.is_small ) {
+                    pdr::stats::on_spill ( 0 );
                     new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
+                        { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
                     while ( first != last )
                         *d.m.end++ = *first++;
                 }
@@ -484,7 +661,7 @@ class podder {
                     }
                     else {
                         d.m.capacity = d.m.size = count;
-                        d.m.end                 = static_cast<pointer> ( pdr::realloc ( p, count * sizeof ( value_type ) ) );
+                        d.m.end                 = static_cast<pointer> ( block_realloc ( p, count * sizeof ( value_type ) ) );
                         while ( first != last )
                             *d.m.end++ = *first++;
                     }
@@ -496,103 +673,89 @@ class podder {
     template<auto S>
     [[maybe_unused]] podder & operator= ( value_type ( *a )[ S ] ) noexcept {
         constexpr size_type count = static_cast<size_type> ( S );
+        normalize ( );
         if constexpr ( count <= buff_size ( ) ) {
             if ( not d.s.is_small )
-                pdr::free ( d.m.end - d.m.size );
+                block_free ( d.m.end - d.m.size );
             std::memcpy ( ( void * ) d.s.buffer, ( void * ) a, count * sizeof ( value_type ) );
             set_small_size ( count );
         }
         else {
             if ( d.s.is_small ) {
+                pdr::stats::on_spill ( 0 );
                 new ( &d.m ) medium ( std::forward<medium> (
-                    { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                std::memcpy ( ( void * ) d.m.end, ( void * ) a, count * sizeof ( value_type ) );
+                    { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) a, count * sizeof ( value_type ) );
                 d.m.end += count;
             }
             else {
                 pointer const p = d.m.end - d.m.size;
                 if ( count <= d.m.capacity ) {
-                    std::memcpy ( ( void * ) p, ( void * ) a, count * sizeof ( value_type ) );
+                    pdr::bulk_copy ( ( void * ) p, ( void * ) a, count * sizeof ( value_type ) );
                     d.m.size = count;
                     d.m.end  = p + count;
                 }
                 else {
                     d.m.capacity = d.m.size = count;
-                    d.m.end                 = static_cast<pointer> ( pdr::realloc ( p, count * sizeof ( value_type ) ) );
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) a, count * sizeof ( value_type ) );
+                    d.m.end                 = static_cast<pointer> ( block_realloc ( p, count * sizeof ( value_type ) ) );
+                    pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) a, count * sizeof ( value_type ) );
                     d.m.end += count;
                 }
             }
         }
     }
     [[maybe_unused]] podder & operator= ( podder && rhs ) noexcept {
+        profile_exit ( sizeof ( value_type ), svo_capacity ( ), size ( ) );
         if ( not d.s.is_small )
-            pdr::free ( d.m.end - d.m.size );
-        std::memcpy ( ( void * ) this, ( void * ) &rhs, sizeof ( podder ) );
+            block_free ( block_pointer ( ) );
+        std::memcpy ( ( void * ) &d, ( void * ) &rhs.d, sizeof ( d ) );
         rhs.small_clear ( );
+        profile_move ( rhs );
         return *this;
     }
 
     // assign.
 
-    void assign ( size_type count, const_reference value ) noexcept {
-        assert ( count >= 0 );
-        if ( count ) {
+    void assign ( size_type const count, const_reference value_ ) noexcept {
+        value_type const value = value_; // value_ might refer into the podder.
+        normalize ( );
+        if ( not count ) {
+            clear ( );
+            return;
+        }
+        if ( count > capacity ( ) ) {
             if constexpr ( svo ( ) ) {
-                if ( d.s.is_small ) {
-                    if ( count <= buff_size ( ) ) {
-                        pointer p = d.s.buffer, e = p + count;
-                        while ( p != e )
-                            *p++ = value;
-                        d.s.size = count;
-                    }
-                    else {
-                        new ( &d.m ) medium ( std::forward<medium> (
-                            { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                        pointer e = d.m.end + count;
-                        while ( d.m.end != e )
-                            *d.m.end++ = value;
-                    }
-                }
-                else {
-                    if ( count > d.m.capacity ) {
-                        pdr::free ( d.m.end - d.m.size );
-                        new ( &d.m ) medium ( std::forward<medium> (
-                            { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                        pointer e = d.m.end + count;
-                        while ( d.m.end != e )
-                            *d.m.end++ = value;
-                    }
-                    else {
-                        pointer p = d.m.end - d.m.size, e = p + count;
-                        while ( p != e )
-                            *p++ = value;
-                        d.m.end += count - d.m.size;
-                        d.m.size = count;
-                    }
-                }
+                if ( d.s.is_small )
+                    pdr::stats::on_spill ( 0 );
+                else
+                    block_free ( d.m.end - d.m.size );
             }
             else {
-                if ( count > d.m.capacity ) {
-                    pdr::free ( d.m.end - d.m.size );
-                    new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                    pointer e = d.m.end + count;
-                    while ( d.m.end != e )
-                        *d.m.end++ = value;
-                }
-                else {
-                    pointer p = d.m.end - d.m.size, e = p + count;
-                    while ( p != e )
-                        *p++ = value;
-                    d.m.end += count - d.m.size;
-                    d.m.size = count;
-                }
+                if ( d.m.capacity )
+                    block_free ( d.m.end - d.m.size );
             }
+            pointer b;
+            if ( pdr::detail::is_zero_bytes ( &value, sizeof ( value_type ) ) ) { // fresh zeroed pages.
+                b = static_cast<pointer> ( block_calloc ( count, sizeof ( value_type ) ) );
+            }
+            else {
+                b = static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) );
+                fill_values ( b, count, value );
+            }
+            new ( &d.m ) medium{ count, count, b + count };
+            return;
         }
-        else {
-            clear ( );
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small ) {
+                fill_values ( d.s.buffer, count, value );
+                set_small_size ( count );
+                return;
+            }
         }
+        pointer const b = d.m.end - d.m.size;
+        fill_values ( b, count, value );
+        d.m.size = count;
+        d.m.end  = b + count;
     }
     template<typename InputIt, contiguous_input_iterator_t<InputIt> * = nullptr>
     void assign ( InputIt first, InputIt last ) noexcept {
@@ -602,6 +765,7 @@ class podder {
     void assign ( InputIt first, InputIt last ) noexcept {
         size_type const count = static_cast<size_type> ( std::distance ( first, last ) );
         assert ( std::distance ( first, last ) >= 0 );
+        normalize ( );
         if ( count ) {
             if constexpr ( svo ( ) ) {
                 if ( d.s.is_small ) {
@@ -612,17 +776,18 @@ class podder {
                         d.s.size = count;
                     }
                     else {
+                        pdr::stats::on_spill ( 0 );
                         new ( &d.m ) medium ( std::forward<medium> (
-                            { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
+                            { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
                         while ( first != last )
                             *d.m.end++ = *first++;
                     }
                 }
                 else {
                     if ( count > d.m.capacity ) {
-                        pdr::free ( d.m.end - d.m.size );
+                        block_free ( d.m.end - d.m.size );
                         new ( &d.m ) medium ( std::forward<medium> (
-                            { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
+                            { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
                         while ( first != last )
                             *d.m.end++ = *first++;
                     }
@@ -637,9 +802,9 @@ class podder {
             }
             else {
                 if ( count > d.m.capacity ) {
-                    pdr::free ( d.m.end - d.m.size );
+                    block_free ( d.m.end - d.m.size );
                     new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
+                        { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
                     pointer e = d.m.end + count;
                     while ( d.m.end != e )
                         *d.m.end++ = *first++;
@@ -662,6 +827,7 @@ class podder {
     }
     void assign ( const_pointer first, size_type const count ) noexcept {
         assert ( count >= 0 );
+        normalize ( );
         if ( count ) {
             if constexpr ( svo ( ) ) {
                 if ( d.s.is_small ) {
@@ -670,23 +836,24 @@ class podder {
                         d.s.size = count;
                     }
                     else {
+                        pdr::stats::on_spill ( 0 );
                         new ( &d.m ) medium ( std::forward<medium> (
-                            { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
+                            { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                        pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
                         d.m.end += count;
                     }
                 }
                 else {
                     if ( count > d.m.capacity ) {
-                        pdr::free ( d.m.end - d.m.size );
+                        block_free ( d.m.end - d.m.size );
                         new ( &d.m ) medium ( std::forward<medium> (
-                            { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
+                            { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                        pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
                         d.m.end += count;
                     }
                     else {
                         d.m.end -= d.m.size;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
+                        pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
                         d.m.size = count;
                         d.m.end += count;
                     }
@@ -694,15 +861,15 @@ class podder {
             }
             else {
                 if ( count > d.m.capacity ) {
-                    pdr::free ( d.m.end - d.m.size );
+                    block_free ( d.m.end - d.m.size );
                     new ( &d.m ) medium ( std::forward<medium> (
-                        { count, count, static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) ) } ) );
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
+                        { count, count, static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) ) } ) );
+                    pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
                     d.m.end += count;
                 }
                 else {
                     d.m.end -= d.m.size;
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
+                    pdr::bulk_copy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
                     d.m.size = count;
                     d.m.end += count;
                 }
@@ -721,33 +888,31 @@ class podder {
 
     PRIVATE
 
+    [[noreturn]] void throw_out_of_range ( size_type const pos ) const {
+        throw std::out_of_range ( std::string ( "index out of bounds, pos = " ) + std::to_string ( pos ) +
+                                  std::string ( " , size = " ) + std::to_string ( size ( ) ) + std::string ( "." ) );
+    }
+
     reference at_impl ( size_type pos ) {
-        pointer p = nullptr;
+        if ( pos >= size ( ) )
+            throw_out_of_range ( pos );
+        return at_operator_impl ( pos );
+    }
+    const_reference at_impl ( size_type pos ) const {
+        if ( pos >= size ( ) )
+            throw_out_of_range ( pos );
+        return at_operator_impl ( pos );
+    }
+
+    reference at_operator_impl ( size_type pos ) noexcept pure_function {
         if constexpr ( svo ( ) ) {
-            if ( d.s.is_small ) {
-                if ( pos >= d.s.size )
-                    throw std::out_of_range ( std::string ( "index out of bounds, pos = " ) + std::to_string ( pos ) +
-                                              std::string ( " , size = " ) +
-                                              std::to_string ( static_cast<size_type> ( d.s.size ) ) + std::string ( "." ) );
-                p = d.s.buffer + pos;
-            }
-            else { // medium.
-                if ( pos >= d.m.size )
-                    throw std::out_of_range ( std::string ( "index out of bounds, pos = " ) + std::to_string ( pos ) +
-                                              std::string ( " , size = " ) + std::to_string ( d.m.size ) + std::string ( "." ) );
-                p = ( d.m.end - d.m.size ) + pos;
-            }
+            return ( d.s.is_small ? d.s.buffer : ( d.m.end - d.m.size ) )[ pos ];
         }
         else {
-            if ( pos >= d.m.size )
-                throw std::out_of_range ( std::string ( "index out of bounds, pos = " ) + std::to_string ( pos ) +
-                                          std::string ( " , size = " ) + std::to_string ( d.m.size ) + std::string ( "." ) );
-            p = ( d.m.end - d.m.size ) + pos;
+            return ( d.m.end - d.m.size )[ pos ];
         }
-        return *p;
     }
-
-    reference at_operator_impl ( size_type pos ) noexcept pure_function {
+    const_reference at_operator_impl ( size_type pos ) const noexcept pure_function {
         if constexpr ( svo ( ) ) {
             return ( d.s.is_small ? d.s.buffer : ( d.m.end - d.m.size ) )[ pos ];
         }
@@ -811,10 +976,10 @@ class podder {
     // returns true, iff size == capacity.
     [[nodiscard]] bool full ( ) const noexcept {
         if constexpr ( svo ( ) ) {
-            return d.s.is_small ? d.s.size == buff_size ( ) : d.m.size == d.m.capacity;
+            return d.s.is_small ? d.s.size == buff_size ( ) : d.m.size == capacity ( );
         }
         else {
-            return d.m.size == d.m.capacity;
+            return d.m.size == capacity ( );
         }
     }
 
@@ -836,10 +1001,12 @@ class podder {
     // reserve.
 
     void reserve ( size_type const count ) noexcept {
+        normalize ( );
         if constexpr ( svo ( ) ) {
             if ( d.s.is_small ) {
                 if ( count > buff_size ( ) ) {
-                    pointer const p = static_cast<pointer> ( pdr::malloc ( count * sizeof ( value_type ) ) );
+                    pdr::stats::on_spill ( d.s.size * sizeof ( value_type ) );
+                    pointer const p = static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) );
                     std::memcpy ( ( void * ) p, ( void * ) d.s.buffer, d.s.size * sizeof ( value_type ) );
                     d.m.size     = static_cast<size_type> ( d.s.size );
                     d.m.capacity = count;
@@ -849,7 +1016,7 @@ class podder {
             else {
                 if ( count > d.m.capacity ) { // relocate.
                     d.m.end = static_cast<pointer> (
-                                  pdr::realloc ( d.m.end - d.m.size, ( d.m.capacity = count ) * sizeof ( value_type ) ) ) +
+                                  block_realloc ( d.m.end - d.m.size, ( d.m.capacity = count ) * sizeof ( value_type ) ) ) +
                               d.m.size;
                 }
             }
@@ -858,45 +1025,55 @@ class podder {
             if ( d.m.capacity ) {             // allocated.
                 if ( count > d.m.capacity ) { // relocate.
                     d.m.end = static_cast<pointer> (
-                                  pdr::realloc ( d.m.end - d.m.size, ( d.m.capacity = count ) * sizeof ( value_type ) ) ) +
+                                  block_realloc ( d.m.end - d.m.size, ( d.m.capacity = count ) * sizeof ( value_type ) ) ) +
                               d.m.size;
                 }
             }
-            else { // not allocated, allocate.
-                d.m.size     = count;
+            else if ( count ) { // not allocated, allocate.
                 d.m.capacity = count;
-                d.m.end      = static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) ) + d.m.size;
+                d.m.end      = static_cast<pointer> ( block_malloc ( d.m.capacity * sizeof ( value_type ) ) );
             }
         }
     }
 
     // capacity.
 
+    // in the offset mode, the capacity from begin ( ).
     [[nodiscard]] size_type capacity ( ) const noexcept {
         if constexpr ( svo ( ) ) {
-            return d.s.is_small ? buff_size ( ) : d.m.capacity;
-        }
-        else {
-            return d.m.capacity;
+            if ( d.s.is_small )
+                return buff_size ( );
         }
+        return d.m.capacity & offset_flag ( ) ? block_capacity ( ) - head ( ) : d.m.capacity;
     }
 
     // shrink to fit.
 
     void skrink_to_fit ( ) noexcept {
         if constexpr ( svo ( ) ) {
-            if ( not d.s.is_small )
-                if ( d.m.size < d.m.capacity )
-                    d.m.end =
-                        static_cast<pointer> ( pdr::realloc ( d.m.end - d.m.size, d.m.size * sizeof ( value_type ) ) ) + d.m.size;
+            if ( d.s.is_small )
+                return;
         }
-        if ( d.m.size < d.m.capacity )
-            d.m.end = static_cast<pointer> ( pdr::realloc ( d.m.end - d.m.size, d.m.size * sizeof ( value_type ) ) ) + d.m.size;
+        normalize ( );
+        if constexpr ( svo ( ) ) {
+            if ( d.m.size <= buff_size ( ) ) { // back into the svo buffer, a medium block holds more than it does.
+                pointer const b      = d.m.end - d.m.size;
+                size_type const size = d.m.size;
+                std::memcpy ( ( void * ) d.s.buffer, ( void * ) b, size * sizeof ( value_type ) );
+                set_small_size ( size );
+                block_free ( b );
+                return;
+            }
+        }
+        if ( d.m.size and d.m.size < d.m.capacity )
+            d.m.end = static_cast<pointer> ( block_realloc ( d.m.end - d.m.size, ( d.m.capacity = d.m.size ) * sizeof ( value_type ) ) ) +
+                      d.m.size;
     }
 
     // clear.
 
     void clear ( ) noexcept {
+        profile_clear ( sizeof ( value_type ), svo_capacity ( ), size ( ) );
         if constexpr ( svo ( ) ) {
             if ( d.s.is_small )
                 small_clear ( );
@@ -912,300 +1089,86 @@ class podder {
     // insert.
 
     [[maybe_unused]] iterator insert ( const_iterator pos, const_reference value ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, const_reference value )" << nl;
+        // std::cout << "iterator insert ( const_iterator pos, const_reference value )" << '\n';
         return emplace ( pos, value_type{ value } );
     }
     [[maybe_unused]] iterator insert ( const_iterator pos, rv_reference value ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, rv_reference value )" << nl;
+        // std::cout << "iterator insert ( const_iterator pos, rv_reference value )" << '\n';
         return emplace ( pos, std::forward<value_type> ( value ) );
     }
     iterator insert ( const_iterator pos, size_type count, const_reference value ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, size_type count, const_reference value )" << nl;
+        // std::cout << "iterator insert ( const_iterator pos, size_type count, const_reference value )" << '\n';
+        value_type const v = value; // value might refer into the podder.
+        pos                = normalize ( pos );
         if ( count ) {
-            if constexpr ( svo ( ) ) {
-                if ( d.s.is_small ) {
-                    size_type const s1 = d.s.size + count; // s1 = new size.
-                    if ( s1 <= buff_size ( ) ) {
-                        pointer p = const_cast<pointer> ( pos );
-                        pointer const e{ p + count };
-                        std::memmove ( ( void * ) e, ( void * ) p,
-                                       reinterpret_cast<char *> ( d.s.buffer + d.s.size ) - reinterpret_cast<char *> ( p ) );
-                        d.s.size += count;
-                        while ( p != e )
-                            *p++ = value;
-                    }
-                    else {
-                        podder const old ( *this );
-                        size_type const c = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                        new ( &d.m ) medium ( std::forward<medium> (
-                            { s1, c, static_cast<pointer> ( pdr::malloc ( c * sizeof ( value_type ) ) ) } ) );
-                        size_type const i0 = static_cast<size_type> ( pos - d.s.buffer );
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) old.d.s.buffer, i0 * sizeof ( value_type ) );
-                        pos = ( d.m.end += i0 );
-                        const_pointer const e{ d.m.end + count };
-                        while ( d.m.end != e )
-                            *d.m.end++ = value;
-                        size_type const i1 = old.d.s.size - i0;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) ( old.d.s.buffer + i0 ), i1 * sizeof ( value_type ) );
-                        d.m.end += i1;
-                    }
-                }
-                else {                                           // medium.
-                    size_type const s1 = d.m.size + count;       // s1 = new size.
-                    if ( d.m.size == d.m.capacity ) {            // relocation.
-                        pointer const old  = d.m.end - d.m.size; // begin.
-                        d.m.capacity       = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                        d.m.end            = static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) );
-                        size_type const i0 = pos - old, i1 = d.m.size - i0;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) old, i0 * sizeof ( value_type ) );
-                        pos = ( d.m.end += i0 );
-                        pointer const e{ const_cast<pointer> ( pos ) + count };
-                        while ( d.m.end != e )
-                            *d.m.end++ = value;
-                        std::memcpy ( ( void * ) ( d.m.end ), ( void * ) ( old + i0 ), i1 * sizeof ( value_type ) );
-                        d.m.size = s1;
-                        d.m.end += i1;
-                        pdr::free ( old );
-                    }
-                    else {
-                        pointer p = const_cast<pointer> ( pos );
-                        const_pointer const e{ p + count };
-                        std::memmove ( ( void * ) e, ( void * ) p, ( d.m.end - pos ) * sizeof ( value_type ) );
-                        while ( p != e )
-                            *p++ = value;
-                        d.m.size += count;
-                        d.m.end += count;
-                    }
-                }
-            }
-            else {
-                size_type const s1 = d.m.size + count;       // s1 = new size.
-                if ( d.m.size == d.m.capacity ) {            // relocation.
-                    pointer const old  = d.m.end - d.m.size; // begin.
-                    d.m.capacity       = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                    d.m.end            = static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) );
-                    size_type const i0 = pos - old, i1 = d.m.size - i0;
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) old, i0 * sizeof ( value_type ) );
-                    pos = ( d.m.end += i0 );
-                    pointer const e{ const_cast<pointer> ( pos ) + count };
-                    while ( d.m.end != e )
-                        *d.m.end++ = value;
-                    std::memcpy ( ( void * ) ( d.m.end ), ( void * ) ( old + i0 ), i1 * sizeof ( value_type ) );
-                    d.m.size = s1;
-                    d.m.end += i1;
-                    pdr::free ( old );
-                }
-                else {
-                    pointer const p = const_cast<pointer> ( pos );
-                    const_pointer const e{ p + count };
-                    std::memmove ( ( void * ) e, ( void * ) p, ( d.m.end - pos ) * sizeof ( value_type ) );
-                    while ( p != e )
-                        *p++ = value;
-                    d.m.size += count;
-                    d.m.end += count;
-                }
-            }
+            pointer const p = open_gap ( pos, count );
+            fill_values ( p, count, v );
+            pos = p;
         }
         return const_cast<iterator> ( pos );
     }
     template<typename InputIt, contiguous_input_iterator_t<InputIt> * = nullptr>
     [[maybe_unused]] iterator insert ( const_iterator pos, InputIt first, InputIt last ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, InputIt first, InputIt last ) ( contiguous )" << nl;
+        // std::cout << "iterator insert ( const_iterator pos, InputIt first, InputIt last ) ( contiguous )" << '\n';
         return insert ( pos, &*first, static_cast<size_type> ( last - first ) );
     }
     template<typename InputIt, discontiguous_input_iterator_t<InputIt> * = nullptr>
     [[maybe_unused]] iterator insert ( const_iterator pos, InputIt first, InputIt last ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, InputIt first, InputIt last ) ( discontiguous )" << nl;
-        const std::ptrdiff_t count = std::distance ( first, last ); // count values to be inserted.
+        // std::cout << "iterator insert ( const_iterator pos, InputIt first, InputIt last ) ( discontiguous )" << '\n';
+        size_type const count = static_cast<size_type> ( std::distance ( first, last ) ); // count values to be inserted.
+        pos                   = normalize ( pos );
         if ( count ) {
-            if constexpr ( svo ( ) ) {
-                if ( d.s.is_small ) {
-                    size_type const s1 = d.s.size + count; // s1 = new size.
-                    if ( ( s1 ) <= buff_size ( ) ) {
-                        pointer p = const_cast<pointer> ( pos );
-                        std::memmove ( ( void * ) ( p + count ), ( void * ) p,
-                                       reinterpret_cast<char *> ( d.s.buffer + d.s.size ) - reinterpret_cast<char *> ( p ) );
-                        d.s.size += count;
-                        while ( first != last )
-                            *p++ = *first++;
-                    }
-                    else {
-                        podder const old ( *this );
-                        size_type const c = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                        new ( &d.m ) medium ( std::forward<medium> (
-                            { s1, c, static_cast<pointer> ( pdr::malloc ( c * sizeof ( value_type ) ) ) } ) );
-                        size_type const i0 = static_cast<size_type> ( pos - d.s.buffer );
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) old.d.s.buffer, i0 * sizeof ( value_type ) );
-                        pos = ( d.m.end += i0 );
-                        while ( first != last )
-                            *d.m.end++ = *first++;
-                        size_type const i1 = old.d.s.size - i0;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) ( old.d.s.buffer + i0 ), i1 * sizeof ( value_type ) );
-                        d.m.end += i1;
-                    }
-                }
-                else {                                           // medium.
-                    size_type const s1 = d.m.size + count;       // s1 = new size.
-                    if ( d.m.size == d.m.capacity ) {            // relocation.
-                        pointer const old  = d.m.end - d.m.size; // begin.
-                        d.m.capacity       = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                        d.m.end            = static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) );
-                        size_type const i0 = pos - old, i1 = d.m.size - i0;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) old, i0 * sizeof ( value_type ) );
-                        pos = ( d.m.end += i0 );
-                        while ( first != last )
-                            *d.m.end++ = *first++;
-                        std::memcpy ( ( void * ) ( d.m.end ), ( void * ) ( old + i0 ), i1 * sizeof ( value_type ) );
-                        d.m.size = s1;
-                        d.m.end += i1;
-                        pdr::free ( old );
-                    }
-                    else { // no relocation.
-                        pointer p = const_cast<pointer> ( pos );
-                        std::memmove ( ( void * ) ( p + count ), ( void * ) p, count * sizeof ( value_type ) );
-                        while ( first != last )
-                            *p++ = *first++;
-                        d.m.end += count;
-                    }
-                }
-            } // non-svo.
-            else {
-                size_type const s1 = d.m.size + count;       // s1 = new size.
-                if ( d.m.size == d.m.capacity ) {            // relocation.
-                    pointer const old  = d.m.end - d.m.size; // begin.
-                    d.m.capacity       = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                    d.m.end            = static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) );
-                    size_type const i0 = pos - old, i1 = d.m.size - i0;
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) old, i0 * sizeof ( value_type ) );
-                    pos = ( d.m.end += i0 );
-                    while ( first != last )
-                        *d.m.end++ = *first++;
-                    std::memcpy ( ( void * ) ( d.m.end ), ( void * ) ( old + i0 ), i1 * sizeof ( value_type ) );
-                    d.m.size = s1;
-                    d.m.end += i1;
-                    pdr::free ( old );
-                }
-                else { // no relocation.
-                    pointer p = const_cast<pointer> ( pos );
-                    std::memmove ( ( void * ) ( p + count ), ( void * ) p, count * sizeof ( value_type ) );
-                    while ( first != last )
-                        *p++ = *first++;
-                    d.m.end += count;
-                }
-            }
+            pointer p = open_gap ( pos, count );
+            pos       = p;
+            while ( first != last )
+                *p++ = *first++;
         }
         return const_cast<iterator> ( pos );
     }
     [[maybe_unused]] iterator insert ( const_iterator pos, const_pointer first, size_type const count ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, const_pointer first, size_type const count )" << nl;
+        // std::cout << "iterator insert ( const_iterator pos, const_pointer first, size_type const count )" << '\n';
+        if ( count and first >= begin_pointer ( ) and first < end_pointer ( ) ) { // inserting (part of) itself.
+            podder const values ( first, count );
+            return insert ( pos, values.data ( ), count );
+        }
+        pos = normalize ( pos );
         if ( count ) {
-            if constexpr ( svo ( ) ) {
-                if ( d.s.is_small ) {
-                    size_type const s1 = d.s.size + count; // s1 = new size.
-                    if ( s1 <= buff_size ( ) ) {
-                        pointer p = const_cast<pointer> ( pos );
-                        std::memmove ( ( void * ) ( p + count ), ( void * ) p,
-                                       reinterpret_cast<char *> ( d.s.buffer + d.s.size ) - reinterpret_cast<char *> ( p ) );
-                        d.s.size += count;
-                        std::memcpy ( ( void * ) p, ( void * ) first, count * sizeof ( value_type ) );
-                    }
-                    else {
-                        podder const old ( *this );
-                        size_type const c = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                        new ( &d.m ) medium ( std::forward<medium> (
-                            { s1, c, static_cast<pointer> ( pdr::malloc ( c * sizeof ( value_type ) ) ) } ) );
-                        size_type const i0 = static_cast<size_type> ( pos - d.s.buffer );
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) old.d.s.buffer, i0 * sizeof ( value_type ) );
-                        pos = ( d.m.end += i0 );
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
-                        d.m.end += count;
-                        size_type const i1 = old.d.s.size - i0;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) ( old.d.s.buffer + i0 ), i1 * sizeof ( value_type ) );
-                        d.m.end += i1;
-                    }
-                }
-                else {                                           // medium.
-                    size_type const s1 = d.m.size + count;       // s1 = new size.
-                    if ( d.m.size == d.m.capacity ) {            // relocation.
-                        pointer const old  = d.m.end - d.m.size; // begin.
-                        d.m.capacity       = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                        d.m.end            = static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) );
-                        size_type const i0 = pos - old, i1 = d.m.size - i0;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) old, i0 * sizeof ( value_type ) );
-                        d.m.end += i0;
-                        pos = d.m.end;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
-                        d.m.end += count;
-                        std::memcpy ( ( void * ) d.m.end, ( void * ) ( old + i0 ), i1 * sizeof ( value_type ) );
-                        d.m.size = s1;
-                        d.m.end += i1;
-                        pdr::free ( old );
-                    }
-                    else {
-                        pointer const p = const_cast<pointer> ( pos );
-                        std::memmove ( ( void * ) ( p + count ), ( void * ) p, ( d.m.end - pos ) * sizeof ( value_type ) );
-                        std::memcpy ( ( void * ) p, ( void * ) first, count * sizeof ( value_type ) );
-                        d.m.size += count;
-                        d.m.end += count;
-                    }
-                }
-            }
-            else {
-                size_type const s1 = d.m.size + count;       // s1 = new size.
-                if ( d.m.size == d.m.capacity ) {            // relocation.
-                    pointer const old  = d.m.end - d.m.size; // begin.
-                    d.m.capacity       = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
-                    d.m.end            = static_cast<pointer> ( pdr::malloc ( d.m.capacity * sizeof ( value_type ) ) );
-                    size_type const i0 = pos - old, i1 = d.m.size - i0;
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) old, i0 * sizeof ( value_type ) );
-                    d.m.end += i0;
-                    pos = d.m.end;
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) first, count * sizeof ( value_type ) );
-                    d.m.end += count;
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) ( old + i0 ), i1 * sizeof ( value_type ) );
-                    d.m.size = s1;
-                    d.m.end += i1;
-                    pdr::free ( old );
-                }
-                else {
-                    pointer const p = const_cast<pointer> ( pos );
-                    std::memmove ( ( void * ) ( p + count ), ( void * ) p, ( d.m.end - pos ) * sizeof ( value_type ) );
-                    std::memcpy ( ( void * ) p, ( void * ) first, count * sizeof ( value_type ) );
-                    d.m.size += count;
-                    d.m.end += count;
-                }
-            }
+            pointer const p = open_gap ( pos, count );
+            std::memcpy ( ( void * ) p, ( void * ) first, count * sizeof ( value_type ) );
+            pos = p;
         }
         return const_cast<iterator> ( pos );
     }
     [[maybe_unused]] iterator insert ( const_iterator pos, const_pointer first, const_pointer last ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, const_pointer first, const_pointer last )" << nl;
+        // std::cout << "iterator insert ( const_iterator pos, const_pointer first, const_pointer last )" << '\n';
         return insert ( pos, first, static_cast<size_type> ( last - first ) );
     }
     [[maybe_unused]] iterator insert ( const_iterator pos, std::initializer_list<value_type> il ) noexcept {
-        // std::cout << "iterator insert ( const_iterator pos, std::initializer_list<value_type> il )" << nl;
+        // std::cout << "iterator insert ( const_iterator pos, std::initializer_list<value_type> il )" << '\n';
         return insert ( pos, il.begin ( ), static_cast<size_type> ( il.size ( ) ) );
     }
 
     // emplace.
 
     [[maybe_unused]] pointer mallocate ( size_type size ) noexcept {
-        return ( d.m.end = static_cast<pointer> ( pdr::malloc ( static_cast<std::size_t> ( size ) * sizeof ( value_type ) ) ) );
+        return ( d.m.end = static_cast<pointer> ( block_malloc ( static_cast<std::size_t> ( size ) * sizeof ( value_type ) ) ) );
     }
     [[maybe_unused]] pointer reallocate ( pointer p, size_type size ) noexcept {
+        normalize ( );
         return (
-            d.m.end = static_cast<pointer> ( pdr::realloc (
+            d.m.end = static_cast<pointer> ( block_realloc (
                 d.m.end - d.m.size, ( d.m.capacity = growth_policy::grow_capacity_from ( d.m.size ) ) * sizeof ( value_type ) ) ) );
     }
 
     void deallocate ( ) noexcept {
         if ( not d.s.is_small )
-            pdr::free ( d.m.end - d.m.size );
+            block_free ( block_pointer ( ) );
     }
 
     template<typename... Args>
     [[maybe_unused]] iterator emplace ( const_iterator pos, Args &&... args ) noexcept {
         // std::cout << "iterator emplace ( const_iterator pos, Args &&... args )" << nl;
+        pos = normalize ( pos );
         if constexpr ( svo ( ) ) {
             if ( d.s.is_small ) {
                 if ( d.s.size < buff_size ( ) ) { // assign into small vector.
@@ -1215,61 +1178,37 @@ class podder {
                     new ( p ) value_type{ std::forward<Args> ( args )... };
                 }
                 else { // small vector -> medium vector.
+                    pdr::stats::on_spill ( buff_size ( ) * sizeof ( value_type ) );
                     size_type const c = growth_policy::grow_capacity_from ( buff_size ( ) );
                     pointer const p =
-                        static_cast<pointer> ( pdr::malloc ( static_cast<std::size_t> ( c ) * sizeof ( value_type ) ) );
-                    pointer const pit = const_cast<pointer> ( pos );
-                    std::memcpy ( ( void * ) p, ( void * ) d.s.buffer,
-                                  reinterpret_cast<char *> ( pit ) - reinterpret_cast<char *> ( d.s.buffer ) );
-                    new ( p + buff_size ( ) ) value_type{ std::forward<Args> ( args )... };
-                    std::memcpy ( ( void * ) ( p + ( pos - d.s.buffer ) ), ( void * ) pit,
-                                  reinterpret_cast<char *> ( d.s.buffer + d.s.size ) - reinterpret_cast<char *> ( pit ) );
-                    d.m.size     = buff_size ( ) + 1;
-                    d.m.capacity = static_cast<size_type> ( c );
-                    d.m.end      = p + buff_size ( ) + 1;        // end points to back.
-                    pos          = p + ( pit - d.s.buffer ) - 1; // pointer to inserted value.
-                }
-            }
-            else {
-                if ( d.m.size == d.m.capacity ) { // relocate.
-                    difference_type const idx = pos - ( d.m.end - d.m.size );
-                    d.m.end                   = static_cast<pointer> (
-                        pdr::realloc ( d.m.end - d.m.size, ( d.m.capacity = growth_policy::grow_capacity_from ( d.m.size ) ) *
-                                                               sizeof ( value_type ) ) );
-                    pointer const p = d.m.end + idx;
-                    d.m.end += ++d.m.size;
-                    std::memmove ( ( void * ) ( p + 1 ), ( void * ) ( p ),
-                                   reinterpret_cast<char *> ( d.m.end ) - reinterpret_cast<char *> ( p ) );
-                    pos = new ( p ) value_type{ std::forward<Args> ( args )... };
-                }
-                else {
-                    pointer const p = const_cast<pointer> ( pos );
-                    ++d.m.size;
-                    std::memmove ( ( void * ) ( p + 1 ), ( void * ) ( p ),
-                                   reinterpret_cast<char *> ( d.m.end++ ) - reinterpret_cast<char *> ( p ) );
-                    new ( p ) value_type{ std::forward<Args> ( args )... };
+                        static_cast<pointer> ( block_malloc ( static_cast<std::size_t> ( c ) * sizeof ( value_type ) ) );
+                    size_type const idx = static_cast<size_type> ( pos - d.s.buffer );
+                    std::memcpy ( ( void * ) p, ( void * ) d.s.buffer, idx * sizeof ( value_type ) );
+                    std::memcpy ( ( void * ) ( p + idx + 1 ), ( void * ) ( d.s.buffer + idx ),
+                                  ( buff_size ( ) - idx ) * sizeof ( value_type ) );
+                    new ( p + idx ) value_type{ std::forward<Args> ( args )... };
+                    new ( &d.m ) medium{ buff_size ( ) + 1, c, p + buff_size ( ) + 1 };
+                    pos = p + idx; // pointer to inserted value.
                 }
+                return const_cast<iterator> ( pos );
             }
         }
-        else {                                // non-svo.
-            if ( d.m.size == d.m.capacity ) { // relocate.
-                difference_type const idx = pos - ( d.m.end - d.m.size );
-                d.m.end                   = static_cast<pointer> (
-                    pdr::realloc ( d.m.end - d.m.size,
-                                   ( d.m.capacity = growth_policy::grow_capacity_from ( d.m.size ) ) * sizeof ( value_type ) ) );
-                pointer const p = d.m.end + idx;
-                d.m.end += ++d.m.size;
-                std::memmove ( ( void * ) ( p + 1 ), ( void * ) ( p ),
-                               reinterpret_cast<char *> ( d.m.end ) - reinterpret_cast<char *> ( p ) );
-                pos = new ( p ) value_type{ std::forward<Args> ( args )... };
-            }
-            else {
-                pointer const p = const_cast<pointer> ( pos );
-                ++d.m.size;
-                std::memmove ( ( void * ) ( p + 1 ), ( void * ) ( p ),
-                               reinterpret_cast<char *> ( d.m.end++ ) - reinterpret_cast<char *> ( p ) );
-                new ( p ) value_type{ std::forward<Args> ( args )... };
-            }
+        if ( d.m.size == d.m.capacity ) { // (allocate or) relocate.
+            size_type const idx = static_cast<size_type> ( pos - ( d.m.end - d.m.size ) );
+            pointer const b     = static_cast<pointer> (
+                block_realloc ( d.m.end - d.m.size,
+                               ( d.m.capacity = growth_policy::grow_capacity_from ( d.m.size ) ) * sizeof ( value_type ) ) );
+            pointer const p = b + idx;
+            std::memmove ( ( void * ) ( p + 1 ), ( void * ) p, ( d.m.size - idx ) * sizeof ( value_type ) );
+            d.m.end = b + ++d.m.size;
+            pos     = new ( p ) value_type{ std::forward<Args> ( args )... };
+        }
+        else {
+            pointer const p = const_cast<pointer> ( pos );
+            ++d.m.size;
+            std::memmove ( ( void * ) ( p + 1 ), ( void * ) ( p ),
+                           reinterpret_cast<char *> ( d.m.end++ ) - reinterpret_cast<char *> ( p ) );
+            new ( p ) value_type{ std::forward<Args> ( args )... };
         }
         return const_cast<iterator> ( pos );
     }
@@ -1278,14 +1217,14 @@ class podder {
 
     PRIVATE
 
-    void unchecked_erase_small_impl ( pointer pos ) noexcept { // good for no_svo types.
+    void unchecked_erase_small_impl ( pointer pos ) noexcept {
         std::memmove ( ( void * ) pos, ( void * ) ( pos + 1 ),
-                       reinterpret_cast<char *> ( d.s.buffer + d.s.size-- ) - reinterpret_cast<char *> ( pos ) );
+                       reinterpret_cast<char *> ( d.s.buffer + d.s.size-- ) - reinterpret_cast<char *> ( pos + 1 ) );
     }
 
-    void unchecked_erase_medium_impl ( pointer pos ) noexcept {
+    void unchecked_erase_medium_impl ( pointer pos ) noexcept { // good for no_svo types.
         std::memmove ( ( void * ) pos, ( void * ) ( pos + 1 ),
-                       reinterpret_cast<char *> ( d.m.end ) - reinterpret_cast<char *> ( pos ) );
+                       reinterpret_cast<char *> ( d.m.end ) - reinterpret_cast<char *> ( pos + 1 ) );
         --d.m.size;
         --d.m.end;
     }
@@ -1293,10 +1232,13 @@ class podder {
     PUBLIC
 
     void unchecked_erase ( iterator pos ) noexcept { // good for no_svo types.
-        if ( d.s.is_small )
-            unchecked_erase_small_impl ( static_cast<pointer> ( pos ) );
-        else
-            unchecked_erase_medium_impl ( static_cast<pointer> ( pos ) );
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small ) {
+                unchecked_erase_small_impl ( static_cast<pointer> ( pos ) );
+                return;
+            }
+        }
+        unchecked_erase_medium_impl ( static_cast<pointer> ( pos ) );
     }
 
     void erase ( iterator pos ) noexcept {
@@ -1335,11 +1277,14 @@ class podder {
     // with the back () value and decrements size, no checking of any kind.
     // Returns an iterator to the value after the erased value.
     [[maybe_unused]] iterator unchecked_unordered_erase ( iterator pos ) noexcept {
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small ) {
+                *pos = d.s.buffer[ --d.s.size ];
+                return ++pos;
+            }
+        }
         --d.m.size;
-        if ( d.s.is_small )
-            *pos = d.s.buffer[ d.m.size ];
-        else
-            *pos = *( --d.m.end );
+        *pos = *( --d.m.end );
         return ++pos;
     }
 
@@ -1383,9 +1328,9 @@ class podder {
 
     // push_front.
 
-    [[maybe_unused]] reference push_front ( const_reference value ) noexcept { return insert ( begin ( ), value_type{ value } ); }
+    [[maybe_unused]] reference push_front ( const_reference value ) noexcept { return emplace_front ( value_type{ value } ); }
     [[maybe_unused]] reference push_front ( rv_reference value ) noexcept {
-        return insert ( begin ( ), std::forward<value_type> ( value ) );
+        return emplace_front ( std::forward<value_type> ( value ) );
     }
 
     // push_back.
@@ -1397,9 +1342,22 @@ class podder {
 
     // emplace_front.
 
+    // amortized O ( 1 ), medium podders switch to the offset mode (see make_front_room).
     template<typename... Args>
     [[maybe_unused]] reference emplace_front ( Args &&... args ) noexcept {
-        return insert ( begin ( ), value_type{ std::forward<Args> ( args )... } );
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small ) {
+                if ( d.s.size < buff_size ( ) )
+                    return *emplace ( d.s.buffer, std::forward<Args> ( args )... );
+                reserve ( growth_policy::grow_capacity_from ( buff_size ( ) ) ); // small -> medium.
+            }
+        }
+        if ( not( d.m.capacity & offset_flag ( ) ) or head ( ) == min_head ( ) )
+            make_front_room ( );
+        size_type const h = head ( ) - 1;
+        ++d.m.size;
+        store_head ( h );
+        return *new ( d.m.end - d.m.size ) value_type{ std::forward<Args> ( args )... };
     }
 
     // emplace_back.
@@ -1411,10 +1369,13 @@ class podder {
         pointer pos = nullptr;
         if constexpr ( svo ( ) ) {
             if ( not d.s.is_small ) {
+                if ( d.m.capacity & offset_flag ( ) )
+                    make_back_room ( );
                 if ( d.m.size == d.m.capacity ) { // relocate.
-                    d.m.end = static_cast<pointer> ( pdr::realloc (
+                    profile_relocation ( );
+                    d.m.end = static_cast<pointer> ( block_realloc (
                                   d.m.end - d.m.size,
-                                  ( d.m.capacity += d.m.capacity / 2 /* growth_policy::grow_capacity_from ( d.m.size ) */ ) *
+                                  ( d.m.capacity = growth_policy::grow_capacity_from ( d.m.capacity ) ) *
                                       sizeof ( value_type ) ) ) +
                               d.m.size;
                 }
@@ -1429,8 +1390,10 @@ class podder {
                     pos = new ( d.s.buffer + d.s.size++ ) value_type{ std::forward<Args> ( args )... };
                 }
                 else { // small vector -> medium vector, assign into medium vector.
+                    pdr::stats::on_spill ( buff_size ( ) * sizeof ( value_type ) );
+                    profile_relocation ( );
                     size_type const c = growth_policy::grow_capacity_from ( buff_size ( ) );
-                    pointer p = static_cast<pointer> ( pdr::malloc ( static_cast<std::size_t> ( c ) * sizeof ( value_type ) ) );
+                    pointer p = static_cast<pointer> ( block_malloc ( static_cast<std::size_t> ( c ) * sizeof ( value_type ) ) );
                     std::memcpy ( ( void * ) p, ( void * ) d.s.buffer, buff_size ( ) * sizeof ( value_type ) );
                     p += buff_size ( );
                     new ( &d.m ) medium{ buff_size ( ) + 1, c, p + 1 };
@@ -1440,16 +1403,19 @@ class podder {
                 }
             }
         }
-        else {                                // assign into non-svo (medium) vector.
+        else { // assign into non-svo (medium) vector.
+            if ( d.m.capacity & offset_flag ( ) )
+                make_back_room ( );
             if ( d.m.size == d.m.capacity ) { // not allocated or relocate.
-                if ( d.m.capacity )           // relocate.
-                    d.m.end = static_cast<pointer> ( pdr::realloc (
+                profile_relocation ( );
+                if ( d.m.capacity ) // relocate.
+                    d.m.end = static_cast<pointer> ( block_realloc (
                                   d.m.end - d.m.size,
-                                  ( d.m.capacity += d.m.capacity / 2 /* growth_policy::grow_capacity_from ( d.m.size ) */ ) *
+                                  ( d.m.capacity = growth_policy::grow_capacity_from ( d.m.capacity ) ) *
                                       sizeof ( value_type ) ) ) +
                               d.m.size;
                 else // allocate.
-                    d.m.end = static_cast<pointer> ( pdr::malloc ( ( d.m.capacity = growth_policy::grow_capacity_from ( ) ) *
+                    d.m.end = static_cast<pointer> ( block_malloc ( ( d.m.capacity = growth_policy::grow_capacity_from ( ) ) *
                                                                    sizeof ( value_type ) ) ) +
                               d.m.size;
             }
@@ -1461,28 +1427,57 @@ class podder {
 
     // pop_front.
 
-    void pop_front ( ) noexcept { erase ( begin ( ) ); }
-
-    void unchecked_pop_front ( ) noexcept { unchecked_erase ( begin ( ) ); }
-
-    [[nodiscard]] optional_value_type pop_front_get ( ) noexcept {
-        /*
-        if ( d.s.is_small ) {
-        unchecked_erase_small_impl ( p.begin ( ), p );
+    // O ( 1 ), medium podders switch to the offset mode, the values are not moved (but to enter the offset mode
+    // for value_type's smaller than size_type, once).
+    void unchecked_pop_front ( ) noexcept {
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small ) {
+                unchecked_erase_small_impl ( d.s.buffer );
+                return;
+            }
         }
-        else {
-        unchecked_erase_medium_impl ( p.begin ( ), p );
+        if ( d.m.size == 1u ) { // empty, back to the plain medium mode.
+            medium_clear ( );
+            return;
         }
-
-        if ( size ( ) ) {
-        optional_value_type value { front ( ) };
-        unchecked_erase ( p );
-        return value;
+        if ( d.m.capacity & offset_flag ( ) ) {
+            size_type const h = head ( ) + 1;
+            --d.m.size;
+            store_head ( h );
+            return;
         }
-        else {
-        return optional_value_type { };
+        pointer const b = d.m.end - d.m.size; // plain medium, b is the block.
+        --d.m.size;
+        if ( min_head ( ) + d.m.size <= d.m.capacity ) { // enter the offset mode.
+            if constexpr ( min_head ( ) > 1u ) {
+                std::memmove ( ( void * ) ( b + min_head ( ) ), ( void * ) ( b + 1 ), d.m.size * sizeof ( value_type ) );
+                d.m.end = b + min_head ( ) + d.m.size;
+            }
+            d.m.capacity |= offset_flag ( );
+            store_head ( min_head ( ) );
+        }
+        else { // no room for the head, erase.
+            std::memmove ( ( void * ) b, ( void * ) ( b + 1 ), d.m.size * sizeof ( value_type ) );
+            --d.m.end;
         }
-        */
+    }
+
+    void pop_front ( ) noexcept {
+        if ( size ( ) )
+            unchecked_pop_front ( );
+    }
+
+    [[nodiscard]] value_type unchecked_pop_front_get ( ) noexcept {
+        value_type const value = front ( );
+        unchecked_pop_front ( );
+        return value;
+    }
+
+    // pops front and returns std::optional of the popped value.
+    [[nodiscard]] optional_value_type pop_front_get ( ) noexcept {
+        if ( size ( ) )
+            return optional_value_type{ unchecked_pop_front_get ( ) };
+        return optional_value_type{};
     }
 
     // pop_back.
@@ -1503,7 +1498,7 @@ class podder {
         }
         else {
             --d.m.size;
-            return *d.m.end--;
+            return *--d.m.end;
         }
     }
 
@@ -1531,7 +1526,7 @@ class podder {
         else {
             if ( d.m.size ) {
                 --d.m.size;
-                return optional_value_type{ *d.m.end-- };
+                return optional_value_type{ *--d.m.end };
             }
             else {
                 return optional_value_type{};
@@ -1541,74 +1536,46 @@ class podder {
 
     PRIVATE
 
-    void resize_reserve_only_impl ( size_type const size, bool const construct ) noexcept {
+    void resize_reserve_impl ( size_type const size, bool const construct ) noexcept {
         if constexpr ( svo ( ) ) {
             if ( d.s.is_small ) {
+                size_type const old_size = static_cast<size_type> ( d.s.size );
                 if ( size <= buff_size ( ) ) {
-                    d.s.size = size;
-                    if ( construct ) {
-                        if ( size > d.s.size ) {
-                            pointer p = d.s.buffer + d.s.size, e = d.s.buffer + size;
-                            while ( p != e )
-                                new ( p++ ) value_type{};
-                        }
-                    }
+                    set_small_size ( size );
+                    if ( construct and size > old_size )
+                        value_initialize ( d.s.buffer + old_size, d.s.buffer + size );
                 }
                 else {
-                    pointer const p =
-                        static_cast<pointer> ( pdr::malloc ( static_cast<std::size_t> ( size ) * sizeof ( value_type ) ) );
-                    std::memcpy ( ( void * ) p, ( void * ) d.s.buffer, d.s.size * sizeof ( value_type ) );
-                    d.m.size     = static_cast<size_type> ( d.s.size );
-                    d.m.capacity = size;
-                    d.m.end      = p + d.m.size;
-                    if ( construct ) {
-                        if ( size > d.s.size ) {
-                            pointer p = d.m.end, e = d.m.end - d.m.size + size;
-                            while ( p != e )
-                                new ( p++ ) value_type{};
-                        }
-                    }
-                }
-            }
-            else {
-                if ( size <= d.m.capacity ) {
-                    d.m.size = size;
-                }
-                else { // relocate.
-                    pointer const p = d.m.end - d.m.size;
-                    d.m.end         = static_cast<pointer> ( pdr::malloc ( p * ( d.m.capacity = size ) * sizeof ( value_type ) ) );
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) p, d.m.size * sizeof ( value_type ) );
-                    d.m.end += ( d.m.size = size );
-                }
-                if ( construct ) {
-                    if ( size > d.s.size ) {
-                        pointer p = d.m.end, e = d.m.end - d.m.size + size;
-                        while ( p != e )
-                            new ( p++ ) value_type{};
-                    }
+                    pdr::stats::on_spill ( old_size * sizeof ( value_type ) );
+                    pointer const b = construct ? value_initialized_block ( size )
+                                                : static_cast<pointer> ( block_malloc ( std::size_t{ size } * sizeof ( value_type ) ) );
+                    std::memcpy ( ( void * ) b, ( void * ) d.s.buffer, old_size * sizeof ( value_type ) );
+                    new ( &d.m ) medium{ size, size, b + size };
                 }
+                return;
             }
         }
-        else {
-            if ( size > d.m.capacity ) { // not allocated or relocate.
-                if ( d.m.capacity ) {    // it is allocated.
-                    pointer const p = d.m.end - d.m.size;
-                    d.m.end         = static_cast<pointer> ( pdr::malloc ( p * ( d.m.capacity = size ) * sizeof ( value_type ) ) );
-                    std::memcpy ( ( void * ) d.m.end, ( void * ) p, d.m.size * sizeof ( value_type ) );
-                    d.m.end += d.m.size;
-                }
-                else { // allocate.
-                    d.m.end = static_cast<pointer> ( pdr::malloc ( ( d.m.capacity = size ) * sizeof ( value_type ) ) ) + d.m.size;
-                }
-            }
-            if ( construct ) {
-                if ( size > d.s.size ) {
-                    pointer p = d.m.end, e = d.m.end - d.m.size + size;
-                    while ( p != e )
-                        new ( p++ ) value_type{};
+        normalize ( );
+        pointer b = d.m.end - d.m.size;
+        if ( size > d.m.capacity ) { // not allocated or relocate.
+            if ( pdr::is_zero_initialized<value_type>::value and construct and d.m.size <= size / 4u ) {
+                // mostly new values, fresh zeroed pages beat a realloc and zeroing the tail.
+                pointer const n = value_initialized_block ( size );
+                if ( d.m.capacity ) {
+                    std::memcpy ( ( void * ) n, ( void * ) b, d.m.size * sizeof ( value_type ) );
+                    block_free ( b );
                 }
+                new ( &d.m ) medium{ size, size, n + size };
+                return;
             }
+            b = static_cast<pointer> ( d.m.capacity ? block_realloc ( ( void * ) b, size * sizeof ( value_type ) )
+                                                    : block_malloc ( size * sizeof ( value_type ) ) );
+            d.m.capacity = size;
         }
+        if ( construct and size > d.m.size )
+            value_initialize ( b + d.m.size, b + size );
+        d.m.size = size;
+        d.m.end  = b + size;
     }
 
     PUBLIC
@@ -1624,98 +1591,118 @@ class podder {
     // Swap function, function (possibly) invalidates any references, pointers, or
     // iterators referring to the elements of the containers being swapped.
     void swap ( podder & p ) noexcept {
-        // the small case treated 'as if' medium.
-        std::swap ( d.m.size, p.d.m.size );
-        std::swap ( d.m.capacity, p.d.m.capacity );
-        std::swap ( d.m.end, p.d.m.end );
+        // bytewise (as the move), reading a small podder 'as if' medium breaks strict aliasing, the values just
+        // written into the svo buffer might not have been stored yet.
+        podder_data t;
+        std::memcpy ( ( void * ) &t, ( void * ) &d, sizeof ( d ) );
+        std::memcpy ( ( void * ) &d, ( void * ) &p.d, sizeof ( d ) );
+        std::memcpy ( ( void * ) &p.d, ( void * ) &t, sizeof ( d ) );
     }
 
-    // comparison.
+    // ownership transfer, without copying the values (but for small sizes).
 
-    template<typename Container, contiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator== ( Container & rhs ) const noexcept {
-        bool value = false;
+    // takes the block p (from pdr::malloc and friends) of capacity values (and TailPadding bytes), holding size values,
+    // sizes that fit the svo buffer are copied into it (and p is freed).
+    void adopt ( pointer p, size_type const size, size_type const capacity ) noexcept {
+        assert ( size <= capacity and not( capacity & offset_flag ( ) ) );
+        clear_to_small ( );
         if constexpr ( svo ( ) ) {
-            if ( d.b.high ) {
-                if ( d.s.size == rhs.size ( ) )
-                    value =
-                        std::memcmp ( ( void * ) d.s.buffer, ( void * ) rhs.data ( ), rhs.size ( ) * sizeof ( value_type ) ) == 0;
+            if ( size <= buff_size ( ) ) {
+                if ( size ) // p is nullptr for an empty buffer (what an empty podder releases).
+                    std::memcpy ( ( void * ) d.s.buffer, ( void * ) p, size * sizeof ( value_type ) );
+                set_small_size ( size );
+                block_free ( p );
+                return;
             }
-            else {
-                if ( d.m.size == rhs.size ( ) )
-                    value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.data ( ),
-                                          rhs.size ( ) * sizeof ( value_type ) ) == 0;
+        }
+        if ( capacity )
+            new ( &d.m ) medium{ size, capacity, p + size };
+        else
+            block_free ( p );
+    }
+    void adopt ( pdr::buffer<value_type> const b ) noexcept {
+        assert ( b.capacity <= std::numeric_limits<size_type>::max ( ) );
+        adopt ( b.data, static_cast<size_type> ( b.size ), static_cast<size_type> ( b.capacity ) );
+    }
+
+    // hands over the block (free it with pdr::free) and leaves the podder empty, the values of a small podder are
+    // copied into a new block (of capacity size). An empty podder releases { nullptr, 0, 0 }.
+    [[nodiscard]] pdr::buffer<value_type> release ( ) noexcept {
+        pdr::buffer<value_type> b;
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small ) {
+                if ( d.s.size ) {
+                    b.size = b.capacity = d.s.size;
+                    b.data              = static_cast<pointer> ( block_malloc ( b.size * sizeof ( value_type ) ) );
+                    std::memcpy ( ( void * ) b.data, ( void * ) d.s.buffer, b.size * sizeof ( value_type ) );
+                }
+                small_clear ( );
+                return b;
             }
         }
+        if ( holds_block ( ) ) {
+            normalize ( );
+            b = { d.m.end - d.m.size, d.m.size, d.m.capacity };
+        }
+        small_clear ( );
+        return b;
+    }
+
+    // conversions from podders of other size types and growth policies, O ( 1 ), the block changes hands (if the
+    // alignments and paddings are the same, the values are copied otherwise).
+    template<typename S, typename G, std::size_t A, std::size_t P,
+             typename = std::enable_if_t<not std::is_same<podder<Type, S, G, A, P>, podder>::value>>
+    explicit podder ( podder<Type, S, G, A, P> && p ) noexcept : podder ( ) {
+        operator= ( std::move ( p ) );
+    }
+    template<typename S, typename G, std::size_t A, std::size_t P,
+             typename = std::enable_if_t<not std::is_same<podder<Type, S, G, A, P>, podder>::value>>
+    podder & operator= ( podder<Type, S, G, A, P> && p ) noexcept {
+        if ( A == Alignment and P == TailPadding and p.holds_block ( ) ) {
+            adopt ( p.release ( ) );
+        }
         else {
-            if ( d.m.size == rhs.size ( ) )
-                value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.data ( ),
-                                      rhs.size ( ) * sizeof ( value_type ) ) == 0;
+            assign ( p.data ( ), static_cast<size_type> ( p.size ( ) ) );
+            p.clear ( );
         }
-        return value;
+        return *this;
     }
 
+    // comparison, lexicographical, by the < of value_type (see pdr::compare).
+
     template<typename Container, contiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator!= ( Container & rhs ) const noexcept {
+    [[nodiscard]] bool operator== ( Container const & rhs ) const noexcept {
+        return pdr::equal ( data ( ), static_cast<std::size_t> ( size ( ) ), std::data ( rhs ),
+                            static_cast<std::size_t> ( std::size ( rhs ) ) );
+    }
+
+    template<typename Container, contiguous_container_t<Container> * = nullptr>
+    [[nodiscard]] bool operator!= ( Container const & rhs ) const noexcept {
         return not operator== ( rhs );
     }
 
     template<typename Container, contiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator< ( Container & rhs ) const noexcept {
-        using container_size_type = typename Container::size_type;
-        bool value                = false;
-        if constexpr ( svo ( ) ) {
-            if ( d.b.high )
-                value = std::memcmp ( ( void * ) d.s.buffer, ( void * ) rhs.data ( ),
-                                      std::min ( static_cast<container_size_type> ( d.s.size ), rhs.size ( ) ) *
-                                          sizeof ( value_type ) ) < 0;
-            else
-                value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.data ( ),
-                                      std::min ( static_cast<container_size_type> ( d.m.size ), rhs.size ( ) ) *
-                                          sizeof ( value_type ) ) < 0;
-        }
-        else {
-            value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.data ( ),
-                                  std::min ( static_cast<container_size_type> ( d.m.size ), rhs.size ( ) ) *
-                                      sizeof ( value_type ) ) < 0;
-        }
-        return value;
+    [[nodiscard]] bool operator< ( Container const & rhs ) const noexcept {
+        return compare ( rhs ) < 0;
     }
 
     template<typename Container, contiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator> ( Container & rhs ) const noexcept {
-        using container_size_type = typename Container::size_type;
-        bool value                = false;
-        if constexpr ( svo ( ) ) {
-            if ( d.b.high )
-                value = std::memcmp ( ( void * ) d.s.buffer, ( void * ) rhs.data ( ),
-                                      std::min ( static_cast<container_size_type> ( d.s.size ), rhs.size ( ) ) *
-                                          sizeof ( value_type ) ) > 0;
-            else
-                value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.data ( ),
-                                      std::min ( static_cast<container_size_type> ( d.m.size ), rhs.size ( ) ) *
-                                          sizeof ( value_type ) ) > 0;
-        }
-        else {
-            value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.data ( ),
-                                  std::min ( static_cast<container_size_type> ( d.m.size ), rhs.size ( ) ) *
-                                      sizeof ( value_type ) ) > 0;
-        }
-        return value;
+    [[nodiscard]] bool operator> ( Container const & rhs ) const noexcept {
+        return compare ( rhs ) > 0;
     }
 
     template<typename Container, contiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator<= ( Container & rhs ) const noexcept {
-        return not operator> ( rhs );
+    [[nodiscard]] bool operator<= ( Container const & rhs ) const noexcept {
+        return compare ( rhs ) <= 0;
     }
 
     template<typename Container, contiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator>= ( Container & rhs ) const noexcept {
-        return not operator< ( rhs );
+    [[nodiscard]] bool operator>= ( Container const & rhs ) const noexcept {
+        return compare ( rhs ) >= 0;
     }
 
     template<typename Container, discontiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator== ( Container & rhs ) const noexcept {
+    [[nodiscard]] bool operator== ( Container const & rhs ) const noexcept {
         if ( size ( ) != rhs.size ( ) ) {
             return false;
         }
@@ -1723,128 +1710,67 @@ class podder {
     }
 
     template<typename Container, discontiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator!= ( Container & rhs ) const noexcept {
+    [[nodiscard]] bool operator!= ( Container const & rhs ) const noexcept {
         return not operator== ( rhs );
     }
 
     template<typename Container, discontiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator< ( Container & rhs ) const noexcept {
-        return std::lexicographical_compare ( begin ( ), end ( ), std::begin ( rhs ), std::end ( rhs ), std::less<value_type> ( ) );
+    [[nodiscard]] bool operator< ( Container const & rhs ) const noexcept {
+        return std::lexicographical_compare ( begin ( ), end ( ), std::begin ( rhs ), std::end ( rhs ) );
     }
 
     template<typename Container, discontiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator> ( Container & rhs ) const noexcept {
-        return std::lexicographical_compare ( begin ( ), end ( ), std::begin ( rhs ), std::end ( rhs ),
-                                              std::greater<value_type> ( ) );
+    [[nodiscard]] bool operator> ( Container const & rhs ) const noexcept {
+        return std::lexicographical_compare ( std::begin ( rhs ), std::end ( rhs ), begin ( ), end ( ) );
     }
 
     template<typename Container, discontiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator<= ( Container & rhs ) const noexcept {
+    [[nodiscard]] bool operator<= ( Container const & rhs ) const noexcept {
         return not operator> ( rhs );
     }
 
     template<typename Container, discontiguous_container_t<Container> * = nullptr>
-    [[nodiscard]] bool operator>= ( Container & rhs ) const noexcept {
+    [[nodiscard]] bool operator>= ( Container const & rhs ) const noexcept {
         return not operator< ( rhs );
     }
 
-    [[nodiscard]] bool operator== ( podder & rhs ) const noexcept {
-        bool value = false;
-        if constexpr ( svo ( ) ) {
-            if ( d.b.high ) {
-                if ( rhs.d.b.high ) { // small - small.
-                    if ( d.b.high == rhs.d.b.high )
-                        value =
-                            std::memcmp ( ( void * ) d.s.buffer, ( void * ) rhs.d.s.buffer, d.s.size * sizeof ( value_type ) ) == 0;
-                }
-                else // small - medium.
-                    if ( d.s.size == rhs.d.m.size )
-                    value = std::memcmp ( ( void * ) d.s.buffer, ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                          rhs.d.m.size * sizeof ( value_type ) ) == 0;
-            }
-            else {
-                if ( not rhs.d.b.high ) { // medium - medium.
-                    if ( d.m.size == rhs.d.m.size )
-                        value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                              d.m.size * sizeof ( value_type ) ) == 0;
-                }
-                else // medium - small.
-                    if ( d.m.size == rhs.d.s.size )
-                    value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.d.s.buffer,
-                                          d.m.size * sizeof ( value_type ) ) == 0;
-            }
-        }
-        else {
-            if ( d.m.size == rhs.d.m.size ) // medium - medium.
-                value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                      d.m.size * sizeof ( value_type ) ) == 0;
-        }
-        return value;
+    [[nodiscard]] bool operator== ( podder const & rhs ) const noexcept {
+        return pdr::equal ( data ( ), static_cast<std::size_t> ( size ( ) ), rhs.data ( ), static_cast<std::size_t> ( rhs.size ( ) ) );
     }
+    [[nodiscard]] bool operator!= ( podder const & rhs ) const noexcept { return not operator== ( rhs ); }
 
-    [[nodiscard]] bool operator!= ( podder & rhs ) const noexcept { return not operator== ( rhs ); }
+    [[nodiscard]] bool operator< ( podder const & rhs ) const noexcept { return compare ( rhs ) < 0; }
+    [[nodiscard]] bool operator> ( podder const & rhs ) const noexcept { return compare ( rhs ) > 0; }
+    [[nodiscard]] bool operator<= ( podder const & rhs ) const noexcept { return compare ( rhs ) <= 0; }
+    [[nodiscard]] bool operator>= ( podder const & rhs ) const noexcept { return compare ( rhs ) >= 0; }
 
-    [[nodiscard]] bool operator< ( podder & rhs ) const noexcept {
-        bool value = false;
-        if constexpr ( svo ( ) ) {
-            if ( d.b.high ) {
-                if ( rhs.d.b.high ) // small - small.
-                    value = std::memcmp ( ( void * ) d.s.buffer, ( void * ) rhs.d.s.buffer,
-                                          std::min ( d.s.size, rhs.d.s.size ) * sizeof ( value_type ) ) < 0;
-                else // small - medium.
-                    value =
-                        std::memcmp ( ( void * ) d.s.buffer, ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                      std::min ( static_cast<size_type> ( d.s.size ), rhs.d.m.size ) * sizeof ( value_type ) ) < 0;
-            }
-            else {
-                if ( not rhs.d.b.high ) // medium - medium.
-                    value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                          std::min ( d.m.size, rhs.d.m.size ) * sizeof ( value_type ) ) < 0;
-                else // medium - small.
-                    value =
-                        std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.d.s.buffer,
-                                      std::min ( d.m.size, static_cast<size_type> ( rhs.d.s.size ) ) * sizeof ( value_type ) ) < 0;
-            }
-        }
-        else {
-            value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                  std::min ( d.m.size, rhs.d.m.size ) * sizeof ( value_type ) ) < 0;
-        }
-        return value;
+    // three-way, < 0, 0 or > 0, elements compare by the < of proj ( element ), f.e. to order podders of structs
+    // by a member.
+    template<typename Container, typename Proj = pdr::identity, contiguous_container_t<Container> * = nullptr>
+    [[nodiscard]] int compare ( Container const & rhs, Proj proj = { } ) const noexcept {
+        return pdr::compare ( data ( ), static_cast<std::size_t> ( size ( ) ), std::data ( rhs ),
+                              static_cast<std::size_t> ( std::size ( rhs ) ), proj );
     }
 
-    [[nodiscard]] bool operator> ( podder & rhs ) const noexcept {
-        bool value = false;
-        if constexpr ( svo ( ) ) {
-            if ( d.b.high ) {
-                if ( rhs.d.b.high ) // small - small.
-                    value = std::memcmp ( ( void * ) d.s.buffer, ( void * ) rhs.d.s.buffer,
-                                          std::min ( d.s.size, rhs.d.s.size ) * sizeof ( value_type ) ) > 0;
-                else // small - medium.
-                    value =
-                        std::memcmp ( ( void * ) d.s.buffer, ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                      std::min ( static_cast<size_type> ( d.s.size ), rhs.d.m.size ) * sizeof ( value_type ) ) > 0;
-            }
-            else {
-                if ( not rhs.d.b.high ) // medium - medium.
-                    value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                          std::min ( d.m.size, rhs.d.m.size ) * sizeof ( value_type ) ) > 0;
-                else // medium - small.
-                    value =
-                        std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) rhs.d.s.buffer,
-                                      std::min ( d.m.size, static_cast<size_type> ( rhs.d.s.size ) ) * sizeof ( value_type ) ) > 0;
+    // hashing, of the contents, stable across runs (see pdr::hash_bytes). Equal podders hash equal, also for
+    // floating point types (-0.0 hashes as 0.0).
+
+    [[nodiscard]] std::uint64_t hash ( std::uint64_t const seed = 0u ) const noexcept {
+        if constexpr ( std::is_floating_point<value_type>::value ) {
+            if ( std::any_of ( begin ( ), end ( ), [] ( value_type const v ) { return v == value_type{ 0 } and std::signbit ( v ); } ) ) {
+                podder p ( *this );
+                for ( value_type & v : p )
+                    v += value_type{ 0 }; // -0.0 + 0.0 == 0.0.
+                return p.hash ( seed );
             }
         }
-        else {
-            value = std::memcmp ( ( void * ) ( d.m.end - d.m.size ), ( void * ) ( rhs.d.m.end - rhs.d.m.size ),
-                                  std::min ( d.m.size, rhs.d.m.size ) * sizeof ( value_type ) ) > 0;
+        if constexpr ( svo ( ) ) {
+            if ( d.b.high ) // in registers.
+                return pdr::hash_short ( d.s.buffer, d.s.size * sizeof ( value_type ), seed );
         }
-        return value;
+        return pdr::hash_bytes ( d.m.end - d.m.size, d.m.size * sizeof ( value_type ), seed );
     }
 
-    [[nodiscard]] bool operator<= ( podder & rhs ) const noexcept { return not operator> ( rhs ); }
-    [[nodiscard]] bool operator>= ( podder & rhs ) const noexcept { return not operator< ( rhs ); }
-
     // size/capacity in bytes.
 
     [[nodiscard]] constexpr size_type size_in_bytes ( ) const noexcept { return size ( ) * size_type{ sizeof ( value_type ) }; }
@@ -1898,7 +1824,7 @@ class podder {
 
         [[nodiscard]] static constexpr bool
         svo ( ) noexcept {
-        return static_cast<bool> ( ( sizeof ( medium_s ) - std::size_t{ 1 } ) / sizeof ( value_type ) );
+        return not TailPadding and static_cast<bool> ( ( sizeof ( medium_s ) - std::size_t{ 1 } ) / sizeof ( value_type ) );
     }
 
     [[nodiscard]] svo_type svo_model ( ) const noexcept {
@@ -1918,6 +1844,17 @@ class podder {
         }
     }
 
+    // the alignment of the (medium) block, data ( ) is aligned on it, unless small or in the offset mode (after the
+    // front operations).
+    [[nodiscard]] static constexpr std::size_t alignment ( ) noexcept {
+        return Alignment ? Alignment : alignof ( std::max_align_t );
+    }
+    // the svo buffer is a member and aligned as the podder object is, Alignment does not apply to it (align the podder,
+    // f.e. alignas ( 32 ) podder<float, std::size_t, visual_studio_growth_policy<>, 32> p;, if small podders matter).
+    [[nodiscard]] static constexpr std::size_t svo_alignment ( ) noexcept { return alignof ( podder_data ); }
+    // the readable bytes past capacity ( ) (of a medium podder, a padded podder is never small).
+    [[nodiscard]] static constexpr std::size_t tail_padding ( ) noexcept { return TailPadding; }
+
     PRIVATE
 
         [[nodiscard]] static constexpr std::size_t
@@ -1956,26 +1893,31 @@ class podder {
         pointer end;
     };
 
-    template<int PaddSize>
+    // The padding and the tag-byte are declared as std::uint8_t's (and not as value_type's), bit-fields
+    // of class type are not allowed, this keeps the layout identical for integral and class value_type's.
+    template<int PaddSize, typename = void>
     struct small_s {
         value_type buffer[ buff_size ( ) ];
-        value_type : PaddSize * 8;
-        value_type size : 5;
-        value_type is_small : 1;
-        value_type : 2;
+        std::uint8_t _[ PaddSize ];
+        std::uint8_t size : 5;
+        std::uint8_t is_small : 1;
+        std::uint8_t : 2;
     };
 
-    template<>
-    struct small_s<0> { // for std::uint8_t size value_type's, fend of padding [ 0 ] warnings.
+    template<typename Dummy>
+    struct small_s<0, Dummy> { // for std::uint8_t size value_type's, fend of padding [ 0 ] warnings.
         value_type buffer[ buff_size ( ) ];
-        value_type size : 5;
-        value_type is_small : 1;
-        value_type : 2;
+        std::uint8_t size : 5;
+        std::uint8_t is_small : 1;
+        std::uint8_t : 2;
     };
 
-    template<>
-    struct small_s<-1> { // dummy type to deal whith objects that don't fit in the buffer.
-        std::uint8_t _[ sizeof ( medium_s ) ];
+    template<typename Dummy>
+    struct small_s<-1, Dummy> { // dummy type to deal whith objects that don't fit in the buffer, is_small is always false.
+        std::uint8_t _[ sizeof ( medium_s ) - 1 ];
+        std::uint8_t size : 5;
+        std::uint8_t is_small : 1;
+        std::uint8_t : 2;
     };
 
     struct byte_view_s {
@@ -2000,25 +1942,234 @@ class podder {
 
     using podder_data = podder_data_u;
 
-    void medium_clear ( ) noexcept {
-        d.m.end -= d.m.size;
+    // The offset mode (of medium podders), entered by the front operations, makes push_front and pop_front
+    // O ( 1 ), the values start head ( ) values into the block. The top bit of capacity flags the mode, capacity
+    // (without the flag) is the capacity of the block and head is stored in the gap in front of the values,
+    // so in the offset mode head is at least min_head ( ). begin = end - size holds in both modes, the
+    // operations that relocate or (might) use the room in front return to the plain mode first (normalize).
+
+    [[nodiscard]] static constexpr size_type offset_flag ( ) noexcept {
+        return size_type{ 1 } << ( std::numeric_limits<size_type>::digits - 1 );
+    }
+    [[nodiscard]] static constexpr size_type min_head ( ) noexcept {
+        return static_cast<size_type> ( ( sizeof ( size_type ) + sizeof ( value_type ) - 1 ) / sizeof ( value_type ) );
+    }
+
+    [[nodiscard]] bool is_offset ( ) const noexcept {
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small )
+                return false;
+        }
+        return d.m.capacity & offset_flag ( );
+    }
+
+    // the head (medium, offset mode).
+    [[nodiscard]] size_type head ( ) const noexcept {
+        size_type h;
+        std::memcpy ( ( void * ) &h, ( void * ) ( reinterpret_cast<char const *> ( d.m.end - d.m.size ) - sizeof ( size_type ) ),
+                      sizeof ( size_type ) );
+        return h;
+    }
+    void store_head ( size_type const h ) noexcept {
+        std::memcpy ( ( void * ) ( reinterpret_cast<char *> ( d.m.end - d.m.size ) - sizeof ( size_type ) ), ( void * ) &h,
+                      sizeof ( size_type ) );
+    }
+
+    // the block (medium).
+    [[nodiscard]] pointer block_pointer ( ) const noexcept {
+        return ( d.m.end - d.m.size ) - ( d.m.capacity & offset_flag ( ) ? head ( ) : size_type{ 0 } );
+    }
+    [[nodiscard]] size_type block_capacity ( ) const noexcept { return d.m.capacity & ~offset_flag ( ); }
+
+    // moves the values to h values into the block (medium, allocated), h is 0 (plain mode) or at least min_head ( ).
+    void recenter ( size_type const h ) noexcept {
+        pointer const b   = block_pointer ( );
+        size_type const c = block_capacity ( );
+        assert ( not h or h >= min_head ( ) );
+        assert ( h + d.m.size <= c );
+        std::memmove ( ( void * ) ( b + h ), ( void * ) ( d.m.end - d.m.size ), d.m.size * sizeof ( value_type ) );
+        d.m.end      = b + h + d.m.size;
+        d.m.capacity = h ? c | offset_flag ( ) : c;
+        if ( h )
+            store_head ( h );
+    }
+
+    void normalize ( ) noexcept {
+        if ( is_offset ( ) )
+            recenter ( 0 );
+    }
+    [[nodiscard]] const_iterator normalize ( const_iterator pos ) noexcept { // keeps pos pointing at the same value.
+        if ( not is_offset ( ) )
+            return pos;
+        size_type const idx = static_cast<size_type> ( pos - begin_pointer ( ) );
+        recenter ( 0 );
+        return begin_pointer ( ) + idx;
+    }
+
+    // makes room in front, proportional to size, growing if required, leaves the podder in the offset mode (medium).
+    void make_front_room ( ) noexcept {
+        size_type const s = d.m.size, r = s / 2 + min_head ( ) + 1;
+        size_type c       = block_capacity ( );
+        if ( c - s < r ) {
+            size_type n = c;
+            do
+                n = growth_policy::grow_capacity_from ( n );
+            while ( n - s < r );
+            normalize ( );
+            profile_relocation ( );
+            d.m.end      = static_cast<pointer> ( block_realloc ( d.m.end - s, n * sizeof ( value_type ) ) ) + s;
+            d.m.capacity = c = n;
+        }
+        recenter ( std::max ( static_cast<size_type> ( ( c - s + 1 ) / 2 ), static_cast<size_type> ( min_head ( ) + 1 ) ) );
+    }
+
+    // makes room at the back, if required (medium, offset mode), by moving the values to the front of the block if there is
+    // (proportionally) enough room in front, or by returning to the plain mode, after which emplace_back grows as usual.
+    void make_back_room ( ) noexcept {
+        size_type const h = head ( );
+        if ( h + d.m.size < block_capacity ( ) )
+            return;
+        recenter ( h >= min_head ( ) + d.m.size / 4 + 1 ? min_head ( ) : size_type{ 0 } );
+    }
+
+    void medium_clear ( ) noexcept { // also leaves the offset mode.
+        d.m.end      = block_pointer ( );
+        d.m.capacity = block_capacity ( );
+        d.m.size     = 0;
         if constexpr ( is_debug::value ) {
             std::memset ( ( void * ) d.m.end, 0, d.m.capacity * sizeof ( value_type ) );
         }
+    }
+    void small_clear ( ) noexcept {
+        if constexpr ( svo ( ) ) {
+            if constexpr ( is_debug::value ) {
+                std::memset ( ( void * ) &d, 0, sizeof ( d ) - 1 );
+            }
+            d.b.high = 0b0010'0000;
+        }
+        else { // no_svo types are cleared to the (unallocated) medium state.
+            std::memset ( ( void * ) &d, 0, sizeof ( d ) );
+        }
+    }
+
+    // the block allocation, aligned on Alignment (if not 0), TailPadding bytes on top of the size.
+    [[nodiscard]] static void * block_malloc ( std::size_t const size ) noexcept {
+        if constexpr ( Alignment )
+            return pdr::aligned_malloc ( Alignment, size + TailPadding );
+        else
+            return pdr::malloc ( size + TailPadding );
+    }
+    [[nodiscard]] static void * block_calloc ( std::size_t const num, std::size_t const size ) noexcept {
+        if constexpr ( Alignment )
+            return pdr::aligned_calloc ( Alignment, 1u, num * size + TailPadding );
+        else if constexpr ( TailPadding )
+            return pdr::calloc ( 1u, num * size + TailPadding );
+        else
+            return pdr::calloc ( num, size );
+    }
+    [[nodiscard]] static void * block_realloc ( void * const ptr, std::size_t const new_size ) noexcept {
+        if constexpr ( Alignment )
+            return pdr::aligned_realloc ( ptr, Alignment, new_size + TailPadding );
+        else
+            return pdr::realloc ( ptr, new_size + TailPadding );
+    }
+    static void block_free ( void * const ptr ) noexcept {
+        if constexpr ( Alignment )
+            pdr::aligned_free ( ptr );
+        else
+            pdr::free ( ptr );
+    }
+
+    // value-initializes [ p, e ), by memset if that's all zero bits.
+    static void value_initialize ( pointer p, const_pointer const e ) noexcept {
+        if constexpr ( pdr::is_zero_initialized<value_type>::value ) {
+            std::memset ( ( void * ) p, 0, static_cast<std::size_t> ( e - p ) * sizeof ( value_type ) );
+        }
         else {
-            d.m.size = 0;
+            while ( p != e )
+                new ( p++ ) value_type{};
         }
     }
-    void small_clear ( ) noexcept {
-        if constexpr ( is_debug::value ) {
-            std::memset ( ( void * ) this, 0, sizeof ( podder ) - 1 );
+    // a new block of count value-initialized values, calloc'ed if that's all zero bits, i.e. the pages are not
+    // touched until used (as for large blocks they come straight from the os).
+    [[nodiscard]] static pointer value_initialized_block ( size_type const count ) noexcept {
+        if constexpr ( pdr::is_zero_initialized<value_type>::value ) {
+            return static_cast<pointer> ( block_calloc ( count, sizeof ( value_type ) ) );
+        }
+        else {
+            pointer const p = static_cast<pointer> ( block_malloc ( count * sizeof ( value_type ) ) );
+            value_initialize ( p, p + count );
+            return p;
+        }
+    }
+
+    // makes room for count values at pos (normalized), returns the gap, the podder has its new size. The values only
+    // move once, a spill copies the svo buffer around the gap into the new block, a relocation reallocs and moves the
+    // tail if the tail is the smaller part (the block might grow in place), and copies around the gap into a new block
+    // otherwise.
+    [[nodiscard]] pointer open_gap ( const_iterator const pos, size_type const count ) noexcept {
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small ) {
+                // (the min tells the compiler pos is in the buffer, it doesn't see that, -Wstringop-overread)
+                size_type const s0 = d.s.size, s1 = s0 + count,
+                                i0 = std::min ( static_cast<size_type> ( pos - d.s.buffer ), s0 ), i1 = s0 - i0;
+                if ( s1 <= buff_size ( ) ) {
+                    pointer const p = d.s.buffer + i0;
+                    std::memmove ( ( void * ) ( p + count ), ( void * ) p, i1 * sizeof ( value_type ) );
+                    d.s.size += count;
+                    return p;
+                }
+                size_type const c = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
+                pdr::stats::on_spill ( s0 * sizeof ( value_type ) );
+                pointer const b = static_cast<pointer> ( block_malloc ( c * sizeof ( value_type ) ) );
+                std::memcpy ( ( void * ) b, ( void * ) d.s.buffer, i0 * sizeof ( value_type ) );
+                std::memcpy ( ( void * ) ( b + i0 + count ), ( void * ) ( d.s.buffer + i0 ), i1 * sizeof ( value_type ) );
+                new ( &d.m ) medium{ s1, c, b + s1 };
+                return b + i0;
+            }
+        }
+        size_type const s0 = d.m.size, s1 = s0 + count;
+        pointer b          = d.m.end - s0;
+        size_type const i0 = static_cast<size_type> ( pos - b ), i1 = s0 - i0;
+        if ( s1 > d.m.capacity ) { // relocation.
+            size_type const c = static_cast<size_type> ( growth_policy::grow_capacity_from ( s1 ) );
+            profile_relocation ( );
+            if ( i1 <= i0 ) {
+                b = static_cast<pointer> ( block_realloc ( b, c * sizeof ( value_type ) ) );
+                std::memmove ( ( void * ) ( b + i0 + count ), ( void * ) ( b + i0 ), i1 * sizeof ( value_type ) );
+            }
+            else {
+                pointer const n = static_cast<pointer> ( block_malloc ( c * sizeof ( value_type ) ) );
+                std::memcpy ( ( void * ) n, ( void * ) b, i0 * sizeof ( value_type ) );
+                std::memcpy ( ( void * ) ( n + i0 + count ), ( void * ) ( b + i0 ), i1 * sizeof ( value_type ) );
+                block_free ( b );
+                b = n;
+            }
+            d.m.capacity = c;
+        }
+        else {
+            std::memmove ( ( void * ) ( b + i0 + count ), ( void * ) ( b + i0 ), i1 * sizeof ( value_type ) );
         }
-        d.b.high = 0b0010'0000;
+        d.m.size = s1;
+        d.m.end  = b + s1;
+        return b + i0;
     }
 
+    // whether there's an allocated block (medium).
+    [[nodiscard]] bool holds_block ( ) const noexcept {
+        if constexpr ( svo ( ) ) {
+            if ( d.s.is_small )
+                return false;
+        }
+        return block_capacity ( );
+    }
+
+    template<typename, typename, typename, std::size_t, std::size_t>
+    friend class podder;
+
     void clear_to_small ( ) noexcept {
         if ( not( d.s.is_small ) ) {
-            pdr::free ( d.m.end - d.m.size );
+            block_free ( block_pointer ( ) );
         }
         small_clear ( );
     }
@@ -2028,25 +2179,6 @@ class podder {
         d.b.high = static_cast<std::uint8_t> ( s ) | 0b0010'0000;
     }
 
-    void print_svo ( ) const noexcept {
-        if ( d.s.is_small ) {
-            std::cout << "svo      : small" << nl;
-            std::cout << "size     : " << ( int ) d.s.size << nl;
-            std::cout << "capacity : " << buff_size ( ) << nl;
-            std::cout << "data     : ";
-            std::printf ( "%p", ( void * ) d.s.buffer );
-            std::cout << nl;
-        }
-        else {
-            std::cout << "svo      : medium" << nl;
-            std::cout << "size     : " << d.m.size << nl;
-            std::cout << "capacity : " << d.m.capacity << nl;
-            std::cout << "data     : ";
-            std::printf ( "%p", ( void * ) ( d.m.end - d.m.size ) );
-            std::cout << nl;
-        }
-    }
-
     podder_data d;
 };
 
@@ -2056,25 +2188,20 @@ class podder {
 
 // swap function, function (possibly) invalidates any references, pointers, or
 // iterators referring to the elements of the containers being swapped.
-template<typename Type, typename SizeType = std::size_t, typename GrowthPolicy = visual_studio_growth_policy<SizeType>>
-void swap ( podder<Type, SizeType, GrowthPolicy> & a, podder<Type, SizeType, GrowthPolicy> & b ) noexcept {
+template<typename Type, typename SizeType = std::size_t, typename GrowthPolicy = visual_studio_growth_policy<SizeType>,
+         std::size_t Alignment = 0u, std::size_t TailPadding = 0u>
+void swap ( podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding> & a,
+            podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding> & b ) noexcept {
     a.swap ( b );
 }
 
-template<typename T>
-void print ( podder<T> & p ) noexcept {
-    p.print_svo ( );
-    std::cout << "values   : ";
-    for ( auto value : p )
-        std::cout << ( std::int64_t ) value << ' ';
-    std::cout << nl;
-}
-
 namespace std {
 
 template<typename Type = std::uint8_t, typename SizeType = std::size_t,
-         typename GrowthPolicy = visual_studio_growth_policy<SizeType>>
-void swap ( podder<Type, SizeType, GrowthPolicy> &, podder<Type, SizeType, GrowthPolicy> & ) {
+         typename GrowthPolicy = visual_studio_growth_policy<SizeType>, std::size_t Alignment = 0u,
+         std::size_t TailPadding = 0u>
+void swap ( podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding> &,
+            podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding> & ) {
     throw std::domain_error (
         std::string ( "podder is not std-compliant, and std::swap ( podder & a, podder & b ) has not" ) + std::string ( "\n" ) +
         std::string ( "been implemented. However, a pdr::swap ( podder & a, podder & b ) is provided," ) + std::string ( "\n" ) +
@@ -2082,6 +2209,14 @@ void swap ( podder<Type, SizeType, GrowthPolicy> &, podder<Type, SizeType, Growt
         std::string ( "swapped." ) + std::string ( "\n" ) );
 }
 
+template<typename Type, typename SizeType, typename GrowthPolicy, std::size_t Alignment, std::size_t TailPadding>
+struct hash<podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding>> {
+    [[nodiscard]] std::size_t
+    operator( ) ( podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding> const & p ) const noexcept {
+        return static_cast<std::size_t> ( p.hash ( ) );
+    }
+};
+
 } // namespace std
 
 #undef PRIVATE
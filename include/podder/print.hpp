@@ -0,0 +1,53 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <iostream>
+
+#include "podder.hpp"
+
+// debug printing, kept out of podder.hpp, so <iostream> is only pulled in where it's used.
+
+template<typename Type, typename SizeType, typename GrowthPolicy, std::size_t Alignment, std::size_t TailPadding>
+void print_svo ( podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding> const & p ) noexcept {
+    using podder_type = podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding>;
+    bool const small  = p.svo_model ( ) == podder_type::svo_type::small;
+    std::cout << "svo      : " << ( small ? "small" : "medium" ) << '\n';
+    std::cout << "size     : " << p.size ( ) << '\n';
+    std::cout << "capacity : " << p.capacity ( ) << '\n';
+    std::cout << "data     : " << static_cast<void const *> ( p.data ( ) ) << '\n';
+}
+
+template<typename Type, typename SizeType, typename GrowthPolicy, std::size_t Alignment, std::size_t TailPadding>
+void print ( podder<Type, SizeType, GrowthPolicy, Alignment, TailPadding> const & p ) noexcept {
+    print_svo ( p );
+    std::cout << "values   : ";
+    for ( auto value : p )
+        std::cout << ( std::int64_t ) value << ' ';
+    std::cout << '\n';
+}
@@ -0,0 +1,290 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// costumization point, define PODDER_PROFILE true (before including podder.hpp) to record
+// the final sizes of podders (at destruction and at clear ( )) and the number of relocations
+// emplace_back took to get there, per value_type size and per call-site tag. The profile can
+// be dumped, replayed by the benchmark suite, and used to recommend an svo capacity and growth
+// ratio (see profile_report.hpp). When false (the default), podder's tracker is an empty base,
+// all hooks are empty, and this header includes next to nothing.
+// When true, the tracker (tag, relocations) grows podder, f.e. sizeof ( podder<int> ) from 24
+// to 40 bytes. Recording is noexcept, each thread records into its own histograms (allocated on
+// its first record, and per 16 new groups of ( tag, value_type size )), entries ( ) merges them.
+#ifndef PODDER_PROFILE
+#    define PODDER_PROFILE false
+#endif
+
+#if PODDER_PROFILE
+#    include <array>
+#    include <atomic>
+#    include <mutex>
+#    include <new>
+#    include <thread>
+#endif
+
+namespace pdr::profile {
+
+[[nodiscard]] constexpr bool enabled ( ) noexcept { return PODDER_PROFILE; }
+
+// the recorder.
+
+#if PODDER_PROFILE
+// histograms, exact up to 63, log2-bucketed from 64 up.
+
+struct histogram {
+
+    static constexpr int exact   = 64;
+    static constexpr int buckets = exact + 58;
+
+    std::array<std::uint64_t, buckets> counts{ };
+
+    [[nodiscard]] static int bucket ( std::uint64_t const v ) noexcept {
+        if ( v < exact )
+            return static_cast<int> ( v );
+        int l = 0;
+        for ( std::uint64_t x = v; x >>= 1; )
+            ++l;
+        return exact + l - 6;
+    }
+
+    // the exact value, or the midpoint of a log2-bucket.
+    [[nodiscard]] static std::uint64_t representative ( int const b ) noexcept {
+        if ( b < exact )
+            return static_cast<std::uint64_t> ( b );
+        std::uint64_t const lo = std::uint64_t{ 1 } << ( b - exact + 6 );
+        return lo + lo / 2;
+    }
+
+    void add ( std::uint64_t const v, std::uint64_t const n = 1 ) noexcept { counts[ bucket ( v ) ] += n; }
+};
+
+namespace detail {
+
+inline thread_local char const * current_tag = "untagged";
+
+// noexcept (std::mutex::lock is not), only contended while entries ( ) or reset ( ) run.
+class spin_lock {
+    std::atomic_flag flag = ATOMIC_FLAG_INIT;
+
+    public:
+    void lock ( ) noexcept {
+        while ( flag.test_and_set ( std::memory_order_acquire ) )
+            std::this_thread::yield ( );
+    }
+    void unlock ( ) noexcept { flag.clear ( std::memory_order_release ); }
+};
+
+struct group {
+    char const * tag         = nullptr;
+    std::size_t value_size   = 0;
+    std::size_t svo_capacity = 0;
+    histogram sizes, relocations;
+};
+
+// the groups keyed by ( tag pointer, value size ), open addressed, another table is chained when one fills up.
+struct table {
+    static constexpr std::size_t capacity = 16;
+
+    std::array<group, capacity> groups{ };
+    table * next = nullptr;
+
+    table ( ) noexcept = default;
+    table ( table const & ) = delete;
+    table & operator= ( table const & ) = delete;
+    ~table ( ) noexcept { delete next; }
+
+    // nullptr if the group is new and there's no memory for another table (the sample is dropped).
+    [[nodiscard]] group * find ( char const * tag, std::size_t const value_size ) noexcept {
+        std::size_t const h = ( reinterpret_cast<std::uintptr_t> ( tag ) >> 3 ) ^ ( value_size * 0x9E3779B97F4A7C15ull );
+        for ( table * t = this; t; t = t->next ) {
+            for ( std::size_t i = 0; i < capacity; ++i ) {
+                group & g = t->groups[ ( h + i ) % capacity ];
+                if ( not g.tag ) {
+                    g.tag        = tag;
+                    g.value_size = value_size;
+                    return &g;
+                }
+                if ( g.tag == tag and g.value_size == value_size )
+                    return &g;
+            }
+            if ( not t->next )
+                t->next = new ( std::nothrow ) table;
+        }
+        return nullptr;
+    }
+
+    void merge ( table const & other ) noexcept {
+        for ( table const * t = &other; t; t = t->next )
+            for ( group const & o : t->groups )
+                if ( o.tag ) {
+                    if ( group * const g = find ( o.tag, o.value_size ) ) {
+                        g->svo_capacity = o.svo_capacity;
+                        for ( int b = 0; b < histogram::buckets; ++b ) {
+                            g->sizes.counts[ b ] += o.sizes.counts[ b ];
+                            g->relocations.counts[ b ] += o.relocations.counts[ b ];
+                        }
+                    }
+                }
+    }
+
+    void clear ( ) noexcept {
+        groups.fill ( group{ } );
+        delete next;
+        next = nullptr;
+    }
+};
+
+// a thread's histograms, its lock is taken by its thread (recording) and by entries ( ) and reset ( ).
+struct shard {
+    spin_lock lock;
+    table groups;
+    shard * prev = nullptr;
+    shard * next = nullptr;
+};
+
+// the shards of the running threads, and the groups of the exited ones.
+struct registry {
+    spin_lock lock;
+    shard * shards = nullptr;
+    table retired;
+
+    static registry & instance ( ) noexcept {
+        static registry r;
+        return r;
+    }
+};
+
+// the shard of this thread, registered on first use, merged into the retired groups when the thread exits.
+class shard_owner {
+    shard * s = nullptr;
+
+    public:
+    shard_owner ( ) noexcept = default;
+    shard_owner ( shard_owner const & ) = delete;
+    shard_owner & operator= ( shard_owner const & ) = delete;
+    ~shard_owner ( ) noexcept {
+        if ( not s )
+            return;
+        {
+            registry & r = registry::instance ( );
+            std::lock_guard<spin_lock> const lock ( r.lock );
+            r.retired.merge ( s->groups );
+            ( s->prev ? s->prev->next : r.shards ) = s->next;
+            if ( s->next )
+                s->next->prev = s->prev;
+        }
+        delete s;
+    }
+
+    [[nodiscard]] shard * get ( ) noexcept {
+        if ( not s and ( s = new ( std::nothrow ) shard ) ) {
+            registry & r = registry::instance ( );
+            std::lock_guard<spin_lock> const lock ( r.lock );
+            if ( ( s->next = r.shards ) )
+                s->next->prev = s;
+            r.shards = s;
+        }
+        return s;
+    }
+};
+
+inline thread_local shard_owner this_thread_shard;
+
+inline void record ( char const * tag, std::size_t const value_size, std::size_t const svo_capacity, std::uint64_t const size,
+                     std::uint64_t const relocations ) noexcept {
+    shard * const s = this_thread_shard.get ( );
+    if ( not s )
+        return;
+    std::lock_guard<spin_lock> const lock ( s->lock );
+    if ( group * const g = s->groups.find ( tag, value_size ) ) {
+        g->svo_capacity = svo_capacity;
+        g->sizes.add ( size );
+        g->relocations.add ( relocations );
+    }
+}
+
+} // namespace detail
+#endif
+
+// tags the podders constructed on this thread, while the scope is alive (the tag should outlive the podders).
+class scope {
+#if PODDER_PROFILE
+    char const * previous;
+
+    public:
+    explicit scope ( char const * tag ) noexcept : previous ( detail::current_tag ) { detail::current_tag = tag; }
+    ~scope ( ) noexcept { detail::current_tag = previous; }
+#else
+    public:
+    explicit scope ( char const * ) noexcept {}
+#endif
+    scope ( scope const & ) = delete;
+    scope & operator= ( scope const & ) = delete;
+};
+
+// the per-podder state, podder derives (privately) from tracker<>.
+
+template<bool Enabled = enabled ( )>
+struct tracker {
+    void profile_relocation ( ) noexcept {}
+    void profile_move ( tracker & ) noexcept {}
+    void profile_clear ( std::size_t, std::size_t, std::uint64_t ) noexcept {}
+    void profile_exit ( std::size_t, std::size_t, std::uint64_t ) noexcept {}
+};
+
+#if PODDER_PROFILE
+template<>
+struct tracker<true> {
+
+    char const * tag          = detail::current_tag;
+    std::uint32_t relocations = 0;
+    bool moved_from           = false;
+
+    void profile_relocation ( ) noexcept { ++relocations; }
+    void profile_move ( tracker & other ) noexcept {
+        tag               = other.tag;
+        relocations       = other.relocations;
+        moved_from        = false;
+        other.relocations = 0;
+        other.moved_from  = true;
+    }
+    void profile_clear ( std::size_t const value_size, std::size_t const svo_capacity, std::uint64_t const size ) noexcept {
+        if ( size )
+            profile_exit ( value_size, svo_capacity, size );
+    }
+    // an empty, moved-from podder is not recorded.
+    void profile_exit ( std::size_t const value_size, std::size_t const svo_capacity, std::uint64_t const size ) noexcept {
+        if ( size or not moved_from )
+            detail::record ( tag, value_size, svo_capacity, size, relocations );
+        relocations = 0;
+        moved_from  = false;
+    }
+};
+#endif
+
+} // namespace pdr::profile
@@ -0,0 +1,264 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "profile.hpp"
+
+// the profile reports, what was recorded (entries ( ), with PODDER_PROFILE true), dumped and read back, and the
+// recommendations made from them.
+
+namespace pdr::profile {
+
+// a profile is a list of entries, one per ( tag, value_type size ).
+
+struct entry {
+    std::string tag;
+    std::size_t value_size   = 0;
+    std::size_t svo_capacity = 0;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> sizes;       // ( size, count ).
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> relocations; // ( relocations, count ).
+
+    [[nodiscard]] std::uint64_t samples ( ) const noexcept {
+        std::uint64_t n = 0;
+        for ( auto const & [ s, c ] : sizes )
+            n += c;
+        return n;
+    }
+};
+
+// dump and read, the format is line based:
+//
+//   podder-profile 1
+//   <tag> <value size> <svo capacity> sizes <n> <size>:<count> ... relocations <m> <relocations>:<count> ...
+//
+// log2-bucketed sizes are written as the midpoint of their bucket.
+
+inline void dump ( std::ostream & out, std::vector<entry> const & entries ) {
+    out << "podder-profile 1" << '\n';
+    for ( entry const & e : entries ) {
+        std::string tag = e.tag.empty ( ) ? std::string ( "untagged" ) : e.tag;
+        std::replace_if (
+            tag.begin ( ), tag.end ( ), [] ( char c ) { return c == ' ' or c == '\t' or c == '\n' or c == ':'; }, '_' );
+        out << tag << ' ' << e.value_size << ' ' << e.svo_capacity << " sizes " << e.sizes.size ( );
+        for ( auto const & [ s, c ] : e.sizes )
+            out << ' ' << s << ':' << c;
+        out << " relocations " << e.relocations.size ( );
+        for ( auto const & [ r, c ] : e.relocations )
+            out << ' ' << r << ':' << c;
+        out << '\n';
+    }
+}
+
+[[nodiscard]] inline std::vector<entry> read ( std::istream & in ) {
+    std::vector<entry> entries;
+    std::string line;
+    if ( not std::getline ( in, line ) or line.rfind ( "podder-profile 1", 0 ) != 0 )
+        return entries;
+    auto read_pairs = [] ( std::istringstream & is, std::vector<std::pair<std::uint64_t, std::uint64_t>> & pairs ) {
+        std::string word;
+        std::size_t n = 0;
+        is >> word >> n;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            std::uint64_t v = 0, c = 0;
+            char colon      = 0;
+            if ( is >> v >> colon >> c )
+                pairs.emplace_back ( v, c );
+        }
+    };
+    while ( std::getline ( in, line ) ) {
+        std::istringstream is ( line );
+        entry e;
+        if ( not( is >> e.tag >> e.value_size >> e.svo_capacity ) )
+            continue;
+        read_pairs ( is, e.sizes );
+        read_pairs ( is, e.relocations );
+        entries.push_back ( std::move ( e ) );
+    }
+    return entries;
+}
+
+// recommendations.
+
+struct recommendation {
+    std::string tag;
+    std::size_t value_size         = 0;
+    std::uint64_t samples          = 0;
+    std::size_t svo_capacity       = 0;   // current, in value_type's.
+    double svo_hit_rate            = 0.0; // current, fraction of final sizes that fit the svo buffer.
+    double mean_relocations        = 0.0; // current, emplace_back relocations per podder.
+    std::size_t inline_capacity    = 0;   // recommended, in value_type's, covers coverage of the final sizes.
+    std::size_t inline_bytes       = 0;   // recommended, inline_capacity * value_size.
+    double growth_ratio            = 1.5; // recommended.
+};
+
+namespace detail {
+
+// elements copied by relocations plus elements of slack at the end, growing from svo_capacity to size.
+[[nodiscard]] inline double growth_cost ( double const ratio, std::uint64_t const svo_capacity, std::uint64_t const size ) noexcept {
+    if ( size <= svo_capacity )
+        return 0.0;
+    std::uint64_t capacity = svo_capacity, copied = 0;
+    while ( capacity < size ) {
+        copied += capacity;
+        capacity = std::max ( std::max ( capacity + 1, std::uint64_t{ 2 } ),
+                              static_cast<std::uint64_t> ( std::floor ( static_cast<double> ( capacity ) * ratio ) ) );
+    }
+    return static_cast<double> ( copied + ( capacity - size ) );
+}
+
+} // namespace detail
+
+[[nodiscard]] inline recommendation recommend ( entry const & e, double const coverage = 0.9 ) {
+    recommendation r;
+    r.tag          = e.tag;
+    r.value_size   = e.value_size;
+    r.svo_capacity = e.svo_capacity;
+    r.samples      = e.samples ( );
+    if ( not r.samples )
+        return r;
+    auto sizes = e.sizes;
+    std::sort ( sizes.begin ( ), sizes.end ( ) );
+    std::uint64_t hits = 0, seen = 0;
+    bool covered       = false;
+    for ( auto const & [ s, c ] : sizes ) {
+        if ( s <= e.svo_capacity )
+            hits += c;
+        seen += c;
+        if ( not covered and static_cast<double> ( seen ) >= coverage * static_cast<double> ( r.samples ) ) {
+            r.inline_capacity = static_cast<std::size_t> ( s );
+            covered           = true;
+        }
+    }
+    r.svo_hit_rate = static_cast<double> ( hits ) / static_cast<double> ( r.samples );
+    r.inline_bytes = r.inline_capacity * r.value_size;
+    std::uint64_t relocations = 0, podders = 0;
+    for ( auto const & [ v, c ] : e.relocations ) {
+        relocations += v * c;
+        podders += c;
+    }
+    r.mean_relocations = podders ? static_cast<double> ( relocations ) / static_cast<double> ( podders ) : 0.0;
+    // the ratio that minimizes copying plus slack over the recorded sizes (with the current svo capacity).
+    double best = -1.0;
+    for ( double const ratio : { 1.25, 1.5, 1.618, 2.0 } ) {
+        double cost = 0.0;
+        for ( auto const & [ s, c ] : sizes )
+            cost += static_cast<double> ( c ) * detail::growth_cost ( ratio, e.svo_capacity, s );
+        if ( best < 0.0 or cost < best ) {
+            best            = cost;
+            r.growth_ratio  = ratio;
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] inline std::vector<recommendation> recommend ( std::vector<entry> const & entries, double const coverage = 0.9 ) {
+    std::vector<recommendation> rs;
+    for ( entry const & e : entries )
+        rs.push_back ( recommend ( e, coverage ) );
+    return rs;
+}
+
+inline void print ( std::ostream & out, std::vector<recommendation> const & rs ) {
+    for ( recommendation const & r : rs )
+        out << ( r.tag.empty ( ) ? "untagged" : r.tag.c_str ( ) ) << " (" << r.value_size << " byte values, " << r.samples
+            << " samples): svo capacity " << r.svo_capacity << " hits " << r.svo_hit_rate * 100.0 << "%, "
+            << r.mean_relocations << " relocations per podder, recommended inline capacity " << r.inline_capacity << " ("
+            << r.inline_bytes << " bytes), growth ratio " << r.growth_ratio << '\n';
+}
+
+// the profile recorded so far (by all threads), groups with equal tags (by value, f.e. the same literal in different
+// translation units) are merged.
+[[nodiscard]] inline std::vector<entry> entries ( ) {
+    std::vector<entry> es;
+#if PODDER_PROFILE
+    struct merged {
+        std::size_t svo_capacity = 0;
+        histogram sizes, relocations;
+    };
+    std::map<std::pair<std::string, std::size_t>, merged> groups;
+    auto add = [ &groups ] ( detail::table const & table ) {
+        for ( detail::table const * t = &table; t; t = t->next )
+            for ( detail::group const & g : t->groups )
+                if ( g.tag ) {
+                    merged & m     = groups[ { std::string ( g.tag ), g.value_size } ];
+                    m.svo_capacity = g.svo_capacity;
+                    for ( int b = 0; b < histogram::buckets; ++b ) {
+                        m.sizes.counts[ b ] += g.sizes.counts[ b ];
+                        m.relocations.counts[ b ] += g.relocations.counts[ b ];
+                    }
+                }
+    };
+    {
+        detail::registry & r = detail::registry::instance ( );
+        std::lock_guard<detail::spin_lock> const lock ( r.lock );
+        add ( r.retired );
+        for ( detail::shard * s = r.shards; s; s = s->next ) {
+            std::lock_guard<detail::spin_lock> const shard_lock ( s->lock );
+            add ( s->groups );
+        }
+    }
+    for ( auto const & [ key, g ] : groups ) {
+        entry e;
+        e.tag          = key.first;
+        e.value_size   = key.second;
+        e.svo_capacity = g.svo_capacity;
+        for ( int b = 0; b < histogram::buckets; ++b ) {
+            if ( g.sizes.counts[ b ] )
+                e.sizes.emplace_back ( histogram::representative ( b ), g.sizes.counts[ b ] );
+            if ( g.relocations.counts[ b ] )
+                e.relocations.emplace_back ( histogram::representative ( b ), g.relocations.counts[ b ] );
+        }
+        es.push_back ( std::move ( e ) );
+    }
+#endif
+    return es;
+}
+
+inline void reset ( ) noexcept {
+#if PODDER_PROFILE
+    detail::registry & r = detail::registry::instance ( );
+    std::lock_guard<detail::spin_lock> const lock ( r.lock );
+    r.retired.clear ( );
+    for ( detail::shard * s = r.shards; s; s = s->next ) {
+        std::lock_guard<detail::spin_lock> const shard_lock ( s->lock );
+        s->groups.clear ( );
+    }
+#endif
+}
+
+} // namespace pdr::profile
@@ -0,0 +1,249 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <functional>
+#include <iosfwd>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "podder.hpp"
+#include "search.hpp"
+
+namespace pdr {
+
+// A string on podder<Char>, i.e. 23 chars inline (as against 15 for libstdc++ and 22 for libc++), a copy of a short
+// string is a copy of 24 bytes. The contents are not zero-terminated (there's no c_str), the interop is through
+// std::string_view, both ways, without a copy. The searches are vectorized (see podder/search.hpp).
+template<typename Char = char, typename SizeType = std::size_t, typename GrowthPolicy = visual_studio_growth_policy<SizeType>>
+class basic_pstring {
+
+    static_assert ( sizeof ( Char ) == 1u, "Char must be a byte-sized character type!" );
+
+    public:
+    using podder_type      = podder<Char, SizeType, GrowthPolicy>;
+    using value_type       = Char;
+    using size_type        = std::size_t;
+    using pointer          = value_type *;
+    using const_pointer    = value_type const *;
+    using reference        = value_type &;
+    using const_reference  = value_type const &;
+    using iterator         = pointer;
+    using const_iterator   = const_pointer;
+    using string_view_type = std::basic_string_view<Char>;
+
+    static constexpr size_type npos = string_view_type::npos;
+
+    private:
+    podder_type s;
+
+    [[nodiscard]] static size_type found ( size_type const i, size_type const size ) noexcept { return i == size ? npos : i; }
+
+    public:
+    basic_pstring ( ) noexcept = default;
+    basic_pstring ( string_view_type const sv ) noexcept :
+        s ( sv.data ( ), static_cast<typename podder_type::size_type> ( sv.size ( ) ) ) {}
+    basic_pstring ( const_pointer const cstr ) noexcept : basic_pstring ( string_view_type ( cstr ) ) {}
+    basic_pstring ( const_pointer const p, size_type const count ) noexcept :
+        s ( p, static_cast<typename podder_type::size_type> ( count ) ) {}
+    basic_pstring ( size_type const count, value_type const c ) noexcept :
+        s ( static_cast<typename podder_type::size_type> ( count ), c ) {}
+
+    // takes the podder (no copy).
+    [[nodiscard]] static basic_pstring from ( podder_type p ) noexcept {
+        basic_pstring r;
+        r.s.swap ( p );
+        return r;
+    }
+
+    // access.
+
+    [[nodiscard]] string_view_type view ( ) const noexcept { return { s.data ( ), s.size ( ) }; }
+    [[nodiscard]] operator string_view_type ( ) const noexcept { return view ( ); }
+    [[nodiscard]] std::basic_string<Char> str ( ) const { return std::basic_string<Char> ( s.data ( ), s.size ( ) ); }
+    [[nodiscard]] podder_type const & get ( ) const noexcept { return s; }
+
+    [[nodiscard]] pointer data ( ) noexcept { return s.data ( ); }
+    [[nodiscard]] const_pointer data ( ) const noexcept { return s.data ( ); }
+    [[nodiscard]] size_type size ( ) const noexcept { return s.size ( ); }
+    [[nodiscard]] size_type length ( ) const noexcept { return s.size ( ); }
+    [[nodiscard]] bool empty ( ) const noexcept { return s.empty ( ); }
+    [[nodiscard]] size_type capacity ( ) const noexcept { return s.capacity ( ); }
+    [[nodiscard]] static constexpr size_type sso_capacity ( ) noexcept { return podder_type::svo_capacity ( ); }
+
+    [[nodiscard]] iterator begin ( ) noexcept { return s.begin ( ); }
+    [[nodiscard]] const_iterator begin ( ) const noexcept { return s.begin ( ); }
+    [[nodiscard]] iterator end ( ) noexcept { return s.end ( ); }
+    [[nodiscard]] const_iterator end ( ) const noexcept { return s.end ( ); }
+
+    [[nodiscard]] reference operator[] ( size_type const i ) noexcept { return data ( )[ i ]; }
+    [[nodiscard]] const_reference operator[] ( size_type const i ) const noexcept { return data ( )[ i ]; }
+    [[nodiscard]] reference front ( ) noexcept { return s.front ( ); }
+    [[nodiscard]] const_reference front ( ) const noexcept { return s.front ( ); }
+    [[nodiscard]] reference back ( ) noexcept { return s.back ( ); }
+    [[nodiscard]] const_reference back ( ) const noexcept { return s.back ( ); }
+
+    // a view on [ pos, pos + count ), clamped.
+    [[nodiscard]] string_view_type substr ( size_type const pos, size_type const count = npos ) const noexcept {
+        return view ( ).substr ( std::min ( pos, size ( ) ), count );
+    }
+
+    // modifiers.
+
+    basic_pstring & append ( const_pointer const p, size_type const count ) noexcept {
+        s.insert ( s.end ( ), p, static_cast<typename podder_type::size_type> ( count ) );
+        return *this;
+    }
+    basic_pstring & append ( string_view_type const sv ) noexcept { return append ( sv.data ( ), sv.size ( ) ); }
+    basic_pstring & append ( size_type const count, value_type const c ) noexcept {
+        s.insert ( s.end ( ), static_cast<typename podder_type::size_type> ( count ), c );
+        return *this;
+    }
+    basic_pstring & operator+= ( string_view_type const sv ) noexcept { return append ( sv ); }
+    basic_pstring & operator+= ( value_type const c ) noexcept {
+        push_back ( c );
+        return *this;
+    }
+    void push_back ( value_type const c ) noexcept { s.emplace_back ( c ); }
+    void pop_back ( ) noexcept { s.pop_back ( ); }
+
+    void clear ( ) noexcept { s.clear ( ); }
+    void reserve ( size_type const count ) noexcept { s.reserve ( static_cast<typename podder_type::size_type> ( count ) ); }
+    void resize ( size_type const count, value_type const c = value_type{ } ) noexcept {
+        size_type const n = size ( );
+        if ( count > n )
+            append ( count - n, c );
+        else
+            s.resize ( static_cast<typename podder_type::size_type> ( count ) );
+    }
+    void swap ( basic_pstring & rhs ) noexcept { s.swap ( rhs.s ); }
+
+    // searches, npos if not found.
+
+    [[nodiscard]] size_type find ( value_type const c, size_type const pos = 0 ) const noexcept {
+        if ( pos >= size ( ) )
+            return npos;
+        size_type const i = find_byte ( data ( ) + pos, size ( ) - pos, static_cast<unsigned char> ( c ) );
+        return found ( pos + i, size ( ) );
+    }
+    [[nodiscard]] size_type find ( string_view_type const sv, size_type const pos = 0 ) const noexcept {
+        if ( pos > size ( ) )
+            return npos;
+        if ( sv.empty ( ) )
+            return pos;
+        size_type const i = find_bytes ( data ( ) + pos, size ( ) - pos, sv.data ( ), sv.size ( ) );
+        return found ( pos + i, size ( ) );
+    }
+    [[nodiscard]] size_type rfind ( value_type const c, size_type const pos = npos ) const noexcept {
+        size_type const n = pos < size ( ) ? pos + 1u : size ( ); // search [ 0, n ).
+        return found ( rfind_byte ( data ( ), n, static_cast<unsigned char> ( c ) ), n );
+    }
+    [[nodiscard]] size_type rfind ( string_view_type const sv, size_type const pos = npos ) const noexcept {
+        if ( sv.size ( ) > size ( ) )
+            return npos;
+        size_type const start = std::min ( pos, size ( ) - sv.size ( ) ); // the last candidate.
+        if ( sv.empty ( ) )
+            return start;
+        size_type const n = start + sv.size ( ); // search [ 0, n ).
+        return found ( rfind_bytes ( data ( ), n, sv.data ( ), sv.size ( ) ), n );
+    }
+
+    [[nodiscard]] bool starts_with ( string_view_type const sv ) const noexcept {
+        return sv.size ( ) <= size ( ) and std::memcmp ( data ( ), sv.data ( ), sv.size ( ) ) == 0;
+    }
+    [[nodiscard]] bool starts_with ( value_type const c ) const noexcept { return not empty ( ) and front ( ) == c; }
+    [[nodiscard]] bool ends_with ( string_view_type const sv ) const noexcept {
+        return sv.size ( ) <= size ( ) and std::memcmp ( data ( ) + size ( ) - sv.size ( ), sv.data ( ), sv.size ( ) ) == 0;
+    }
+    [[nodiscard]] bool ends_with ( value_type const c ) const noexcept { return not empty ( ) and back ( ) == c; }
+    [[nodiscard]] bool contains ( string_view_type const sv ) const noexcept { return find ( sv ) != npos; }
+    [[nodiscard]] bool contains ( value_type const c ) const noexcept { return find ( c ) != npos; }
+
+    // calls f ( string_view_type ) for each field separated by delimiter (empty fields included), without
+    // allocating. The views point into this string.
+    template<typename F>
+    void split ( value_type const delimiter, F && f ) const {
+        const_pointer p = data ( ), e = p + size ( );
+        for ( ;; ) {
+            size_type const i = find_byte ( p, static_cast<size_type> ( e - p ), static_cast<unsigned char> ( delimiter ) );
+            f ( string_view_type ( p, i ) );
+            if ( p + i == e )
+                return;
+            p += i + 1u;
+        }
+    }
+    // the fields, as views into this string.
+    [[nodiscard]] podder<string_view_type> split ( value_type const delimiter ) const noexcept {
+        podder<string_view_type> fields;
+        split ( delimiter, [ &fields ] ( string_view_type const sv ) { fields.emplace_back ( sv ); } );
+        return fields;
+    }
+
+    // comparison, like std::string.
+
+    [[nodiscard]] int compare ( string_view_type const sv ) const noexcept { return view ( ).compare ( sv ); }
+
+    [[nodiscard]] friend bool operator== ( basic_pstring const & a, basic_pstring const & b ) noexcept { return a.s == b.s; }
+    [[nodiscard]] friend bool operator!= ( basic_pstring const & a, basic_pstring const & b ) noexcept { return not( a == b ); }
+    [[nodiscard]] friend bool operator< ( basic_pstring const & a, basic_pstring const & b ) noexcept {
+        return a.view ( ) < b.view ( );
+    }
+    [[nodiscard]] friend bool operator> ( basic_pstring const & a, basic_pstring const & b ) noexcept { return b < a; }
+    [[nodiscard]] friend bool operator<= ( basic_pstring const & a, basic_pstring const & b ) noexcept { return not( b < a ); }
+    [[nodiscard]] friend bool operator>= ( basic_pstring const & a, basic_pstring const & b ) noexcept { return not( a < b ); }
+
+    [[nodiscard]] friend bool operator== ( basic_pstring const & a, string_view_type const b ) noexcept { return a.view ( ) == b; }
+    [[nodiscard]] friend bool operator!= ( basic_pstring const & a, string_view_type const b ) noexcept { return a.view ( ) != b; }
+
+    [[nodiscard]] friend basic_pstring operator+ ( basic_pstring a, string_view_type const b ) noexcept {
+        a.append ( b );
+        return a;
+    }
+
+    [[nodiscard]] std::uint64_t hash ( std::uint64_t const seed = 0u ) const noexcept { return s.hash ( seed ); }
+
+    friend std::basic_ostream<Char> & operator<< ( std::basic_ostream<Char> & out, basic_pstring const & p ) {
+        return out << p.view ( );
+    }
+};
+
+using pstring = basic_pstring<char>;
+
+} // namespace pdr
+
+namespace std {
+template<typename Char, typename SizeType, typename GrowthPolicy>
+struct hash<pdr::basic_pstring<Char, SizeType, GrowthPolicy>> {
+    [[nodiscard]] std::size_t operator( ) ( pdr::basic_pstring<Char, SizeType, GrowthPolicy> const & p ) const noexcept {
+        return static_cast<std::size_t> ( p.hash ( ) );
+    }
+};
+} // namespace std
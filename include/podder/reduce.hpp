@@ -0,0 +1,293 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined( __AVX2__ ) or defined( __SSE2__ ) or defined( _M_X64 )
+#    include <immintrin.h>
+#endif
+
+#include "fill.hpp" // detail::vector_width.
+
+// reductions over arithmetic values, sum, min, max, minmax, argmin, argmax and dot, of [ p, p + size ) or of a
+// container (anything with std::data and std::size). The kernels keep 4 vectors worth of independent accumulators (to
+// hide the latency of the adds) and combine them pairwise at the end, always in the same order, i.e. the floating point
+// results don't change from run to run (or with the alignment of p), they do differ from a left to right loop. Integer
+// sums and dot products widen to 64 bits (8 and 16 bit values are summed in 32 bit blocks first, that can't overflow).
+
+namespace pdr {
+
+namespace detail {
+
+// the result of sum and dot.
+template<typename Type>
+using sum_type = std::conditional_t<std::is_floating_point<Type>::value, Type,
+                                    std::conditional_t<std::is_signed<Type>::value, std::int64_t, std::uint64_t>>;
+
+template<typename Acc>
+inline constexpr std::size_t lanes = std::max ( std::size_t{ 8 }, 4u * vector_width / sizeof ( Acc ) );
+
+// acc[ 0 ] = op ( acc[ 0 ], ..., acc[ lanes - 1 ] ), pairwise.
+template<typename Acc, typename Op>
+[[nodiscard]] Acc combine ( Acc * const acc, Op const op ) noexcept {
+    for ( std::size_t w = lanes<Acc> / 2u; w; w /= 2u )
+        for ( std::size_t k = 0; k < w; ++k )
+            acc[ k ] = op ( acc[ k ], acc[ k + w ] );
+    return acc[ 0 ];
+}
+
+// the sum of term ( i ) over [ i, n ).
+template<typename Acc, typename Term>
+[[nodiscard]] Acc accumulate ( std::size_t i, std::size_t const n, Term const term ) noexcept {
+    Acc acc[ lanes<Acc> ] = { };
+    for ( ; i + lanes<Acc> <= n; i += lanes<Acc> )
+        for ( std::size_t k = 0; k < lanes<Acc>; ++k )
+            acc[ k ] += term ( i + k );
+    Acc tail = 0; // kept apart, indexing acc by a variable spills it to the stack.
+    for ( ; i < n; ++i )
+        tail += term ( i );
+    return static_cast<Acc> ( combine ( acc, []( Acc const a, Acc const b ) noexcept { return static_cast<Acc> ( a + b ); } ) + tail );
+}
+
+// the sum of term ( i ) over [ 0, n ), in Block's of block values (the block sums can't overflow), widened to Acc.
+template<typename Acc, typename Block, std::size_t block, typename Term>
+[[nodiscard]] Acc widening_accumulate ( std::size_t const n, Term const term ) noexcept {
+    Acc s = 0;
+    for ( std::size_t i = 0; i < n; i += block )
+        s += static_cast<Acc> ( accumulate<Block> ( i, std::min ( n, i + block ), term ) );
+    return s;
+}
+
+// the sum of the bytes, by sad ( bytes, 0 ), 4 64 bit sums per 32 bytes.
+[[nodiscard]] inline std::uint64_t sum_bytes ( unsigned char const * const p, std::size_t const n ) noexcept {
+    std::size_t i   = 0;
+    std::uint64_t s = 0;
+#if defined( __AVX2__ )
+    __m256i const zero = _mm256_setzero_si256 ( );
+    __m256i a0 = zero, a1 = zero;
+    for ( ; i + 64u <= n; i += 64u ) {
+        a0 = _mm256_add_epi64 ( a0, _mm256_sad_epu8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( p + i ) ), zero ) );
+        a1 = _mm256_add_epi64 (
+            a1, _mm256_sad_epu8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( p + i + 32u ) ), zero ) );
+    }
+    __m256i const a = _mm256_add_epi64 ( a0, a1 );
+    std::uint64_t h[ 2 ];
+    _mm_storeu_si128 ( reinterpret_cast<__m128i *> ( h ),
+                       _mm_add_epi64 ( _mm256_castsi256_si128 ( a ), _mm256_extracti128_si256 ( a, 1 ) ) );
+    s += h[ 0 ] + h[ 1 ];
+#elif defined( __SSE2__ ) or defined( _M_X64 )
+    __m128i const zero = _mm_setzero_si128 ( );
+    __m128i a0 = zero, a1 = zero;
+    for ( ; i + 32u <= n; i += 32u ) {
+        a0 = _mm_add_epi64 ( a0, _mm_sad_epu8 ( _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( p + i ) ), zero ) );
+        a1 = _mm_add_epi64 ( a1, _mm_sad_epu8 ( _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( p + i + 16u ) ), zero ) );
+    }
+    std::uint64_t h[ 2 ];
+    _mm_storeu_si128 ( reinterpret_cast<__m128i *> ( h ), _mm_add_epi64 ( a0, a1 ) );
+    s += h[ 0 ] + h[ 1 ];
+#endif
+    for ( ; i < n; ++i )
+        s += p[ i ];
+    return s;
+}
+
+struct minimum {
+    template<typename Type>
+    [[nodiscard]] Type operator( ) ( Type const a, Type const b ) const noexcept {
+        return b < a ? b : a;
+    }
+};
+struct maximum {
+    template<typename Type>
+    [[nodiscard]] Type operator( ) ( Type const a, Type const b ) const noexcept {
+        return a < b ? b : a;
+    }
+};
+
+// op ( ... op ( p[ 0 ], p[ 1 ] ) ... ), in lanes, p is not empty.
+template<typename Type, typename Op>
+[[nodiscard]] Type select ( Type const * const p, std::size_t const n, Op const op ) noexcept {
+    assert ( n );
+    Type acc[ lanes<Type> ];
+    for ( std::size_t k = 0; k < lanes<Type>; ++k )
+        acc[ k ] = p[ 0 ];
+    std::size_t i = 0;
+    for ( ; i + lanes<Type> <= n; i += lanes<Type> )
+        for ( std::size_t k = 0; k < lanes<Type>; ++k )
+            acc[ k ] = op ( acc[ k ], p[ i + k ] );
+    Type tail = p[ 0 ];
+    for ( ; i < n; ++i )
+        tail = op ( tail, p[ i ] );
+    return op ( combine ( acc, op ), tail );
+}
+
+// the index of the first v in [ p, p + n ), n if there's none.
+template<typename Type>
+[[nodiscard]] std::size_t find_value ( Type const * const p, std::size_t const n, Type const v ) noexcept {
+    constexpr std::size_t block = 256u; // a vectorized test per block, the search in the block that has it.
+    for ( std::size_t i = 0; i < n; i += block ) {
+        std::size_t const e = std::min ( n, i + block );
+        bool found          = false;
+        for ( std::size_t j = i; j < e; ++j )
+            found |= p[ j ] == v;
+        if ( found )
+            for ( std::size_t j = i; j < e; ++j )
+                if ( p[ j ] == v )
+                    return j;
+    }
+    return n;
+}
+
+template<typename Type>
+using if_arithmetic_t = std::enable_if_t<std::is_arithmetic<Type>::value, int>;
+
+template<typename Container>
+using value_type_t = std::remove_cv_t<std::remove_reference_t<decltype ( *std::data ( std::declval<Container const &> ( ) ) )>>;
+
+} // namespace detail
+
+template<typename Type, detail::if_arithmetic_t<Type> = 0>
+[[nodiscard]] detail::sum_type<Type> sum ( Type const * const p, std::size_t const n ) noexcept {
+    using acc_type = detail::sum_type<Type>;
+    if constexpr ( sizeof ( Type ) == 1u and not std::is_signed<Type>::value ) { // unsigned char (and bool).
+        return detail::sum_bytes ( reinterpret_cast<unsigned char const *> ( p ), n );
+    }
+    else if constexpr ( std::is_integral<Type>::value and sizeof ( Type ) <= 2u ) {
+        using block_type = std::conditional_t<std::is_signed<Type>::value, std::int32_t, std::uint32_t>;
+        return detail::widening_accumulate<acc_type, block_type, sizeof ( Type ) == 1u ? ( 1u << 22 ) : ( 1u << 15 )> (
+            n, [p]( std::size_t const i ) noexcept { return static_cast<block_type> ( p[ i ] ); } );
+    }
+    else {
+        return detail::accumulate<acc_type> ( 0u, n, [p]( std::size_t const i ) noexcept { return static_cast<acc_type> ( p[ i ] ); } );
+    }
+}
+
+// the sum of a[ i ] * b[ i ].
+template<typename Type, detail::if_arithmetic_t<Type> = 0>
+[[nodiscard]] detail::sum_type<Type> dot ( Type const * const a, Type const * const b, std::size_t const n ) noexcept {
+    using acc_type = detail::sum_type<Type>;
+    if constexpr ( std::is_integral<Type>::value and sizeof ( Type ) == 1u ) {
+        using block_type = std::conditional_t<std::is_signed<Type>::value, std::int32_t, std::uint32_t>;
+        return detail::widening_accumulate<acc_type, block_type, ( 1u << 16 )> ( n, [a, b]( std::size_t const i ) noexcept {
+            return static_cast<block_type> ( static_cast<block_type> ( a[ i ] ) * static_cast<block_type> ( b[ i ] ) );
+        } );
+    }
+    else if constexpr ( std::is_integral<Type>::value and sizeof ( Type ) == 2u ) { // 32 bit products, widened.
+        using product_type = std::conditional_t<std::is_signed<Type>::value, std::int32_t, std::uint32_t>;
+        return detail::accumulate<acc_type> ( 0u, n, [a, b]( std::size_t const i ) noexcept {
+            return static_cast<acc_type> ( static_cast<product_type> ( a[ i ] ) * static_cast<product_type> ( b[ i ] ) );
+        } );
+    }
+    else {
+        return detail::accumulate<acc_type> ( 0u, n, [a, b]( std::size_t const i ) noexcept {
+            return static_cast<acc_type> ( static_cast<acc_type> ( a[ i ] ) * static_cast<acc_type> ( b[ i ] ) );
+        } );
+    }
+}
+
+// p is not empty (for min, max and minmax), for floating point values the result with NaNs depends on where they are
+// (as with std::min_element), the same from run to run.
+template<typename Type, detail::if_arithmetic_t<Type> = 0>
+[[nodiscard]] Type min ( Type const * const p, std::size_t const n ) noexcept {
+    return detail::select ( p, n, detail::minimum{ } );
+}
+template<typename Type, detail::if_arithmetic_t<Type> = 0>
+[[nodiscard]] Type max ( Type const * const p, std::size_t const n ) noexcept {
+    return detail::select ( p, n, detail::maximum{ } );
+}
+// in one pass.
+template<typename Type, detail::if_arithmetic_t<Type> = 0>
+[[nodiscard]] std::pair<Type, Type> minmax ( Type const * const p, std::size_t const n ) noexcept {
+    assert ( n );
+    constexpr std::size_t l = detail::lanes<Type>;
+    Type lo[ l ], hi[ l ];
+    for ( std::size_t k = 0; k < l; ++k )
+        lo[ k ] = hi[ k ] = p[ 0 ];
+    std::size_t i = 0;
+    for ( ; i + l <= n; i += l )
+        for ( std::size_t k = 0; k < l; ++k ) {
+            lo[ k ] = detail::minimum{ }( lo[ k ], p[ i + k ] );
+            hi[ k ] = detail::maximum{ }( hi[ k ], p[ i + k ] );
+        }
+    Type tail_lo = p[ 0 ], tail_hi = p[ 0 ];
+    for ( ; i < n; ++i ) {
+        tail_lo = detail::minimum{ }( tail_lo, p[ i ] );
+        tail_hi = detail::maximum{ }( tail_hi, p[ i ] );
+    }
+    return { detail::minimum{ }( detail::combine ( lo, detail::minimum{ } ), tail_lo ),
+             detail::maximum{ }( detail::combine ( hi, detail::maximum{ } ), tail_hi ) };
+}
+// the index of the first smallest (largest) value, by min (max) and a (vectorized) search for it, n if p is empty (or
+// for NaNs that make the min (max) NaN).
+template<typename Type, detail::if_arithmetic_t<Type> = 0>
+[[nodiscard]] std::size_t argmin ( Type const * const p, std::size_t const n ) noexcept {
+    return n ? detail::find_value ( p, n, min ( p, n ) ) : n;
+}
+template<typename Type, detail::if_arithmetic_t<Type> = 0>
+[[nodiscard]] std::size_t argmax ( Type const * const p, std::size_t const n ) noexcept {
+    return n ? detail::find_value ( p, n, max ( p, n ) ) : n;
+}
+
+// containers.
+
+template<typename Container, detail::if_arithmetic_t<detail::value_type_t<Container>> = 0>
+[[nodiscard]] auto sum ( Container const & c ) noexcept {
+    return sum ( std::data ( c ), static_cast<std::size_t> ( std::size ( c ) ) );
+}
+template<typename Container, detail::if_arithmetic_t<detail::value_type_t<Container>> = 0>
+[[nodiscard]] auto dot ( Container const & a, Container const & b ) noexcept {
+    assert ( std::size ( a ) == std::size ( b ) );
+    return dot ( std::data ( a ), std::data ( b ), static_cast<std::size_t> ( std::size ( a ) ) );
+}
+template<typename Container, detail::if_arithmetic_t<detail::value_type_t<Container>> = 0>
+[[nodiscard]] auto min ( Container const & c ) noexcept {
+    return min ( std::data ( c ), static_cast<std::size_t> ( std::size ( c ) ) );
+}
+template<typename Container, detail::if_arithmetic_t<detail::value_type_t<Container>> = 0>
+[[nodiscard]] auto max ( Container const & c ) noexcept {
+    return max ( std::data ( c ), static_cast<std::size_t> ( std::size ( c ) ) );
+}
+template<typename Container, detail::if_arithmetic_t<detail::value_type_t<Container>> = 0>
+[[nodiscard]] auto minmax ( Container const & c ) noexcept {
+    return minmax ( std::data ( c ), static_cast<std::size_t> ( std::size ( c ) ) );
+}
+template<typename Container, detail::if_arithmetic_t<detail::value_type_t<Container>> = 0>
+[[nodiscard]] std::size_t argmin ( Container const & c ) noexcept {
+    return argmin ( std::data ( c ), static_cast<std::size_t> ( std::size ( c ) ) );
+}
+template<typename Container, detail::if_arithmetic_t<detail::value_type_t<Container>> = 0>
+[[nodiscard]] std::size_t argmax ( Container const & c ) noexcept {
+    return argmax ( std::data ( c ), static_cast<std::size_t> ( std::size ( c ) ) );
+}
+
+} // namespace pdr
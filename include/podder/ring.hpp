@@ -0,0 +1,223 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "podder.hpp"
+
+namespace pdr {
+
+// the (assumed) size of a cache line, std::hardware_destructive_interference_size is not (yet) widely available.
+inline constexpr std::size_t cache_line_size = 64u;
+
+enum class producers : std::uint8_t { single, multiple };
+
+// A bounded, lock-free, single consumer ring buffer of trivially copyable values, with a power-of-two capacity
+// (allocated through pdr::malloc). With producers::single (SPSC) pushing and popping are wait-free. With
+// producers::multiple (MPSC) producers reserve slots with a CAS and publish each slot by stamping its sequence
+// number (as in Vyukov's bounded queue), no producer waits on another. A producer that gets preempted between
+// reserving and stamping only keeps the consumer from popping past its slots (the ring is FIFO).
+//
+// head and tail are free running counters, each side caches the other side's counter to keep the (contended)
+// cache lines from bouncing, and head, tail and the read-only data are on separate cache lines.
+template<typename Type, typename SizeType = std::size_t, producers Producers = producers::single>
+class ring {
+
+    static_assert ( std::is_trivially_copyable<Type>::value, "Type must be trivially copyable!" );
+    static_assert ( std::is_unsigned<SizeType>::value and std::numeric_limits<SizeType>::digits >= 32,
+                    "SizeType must be an unsigned 32- or 64-bit integer type!" );
+
+    public:
+    using value_type          = Type;
+    using optional_value_type = std::optional<value_type>;
+    using pointer             = value_type *;
+    using const_pointer       = value_type const *;
+    using reference           = value_type &;
+    using const_reference     = value_type const &;
+    using size_type           = SizeType;
+
+    [[nodiscard]] static constexpr bool multiple_producers ( ) noexcept { return Producers == producers::multiple; }
+
+    // capacity is rounded up to a power of two.
+    explicit ring ( size_type const capacity_ ) noexcept :
+        buffer ( static_cast<pointer> ( pdr::malloc ( round_up ( capacity_ ) * sizeof ( value_type ) ) ) ),
+        stamps ( make_stamps ( round_up ( capacity_ ) ) ), mask ( round_up ( capacity_ ) - 1u ) {}
+
+    ring ( ring const & ) = delete;
+    ring ( ring && )      = delete;
+    ring & operator= ( ring const & ) = delete;
+    ring & operator= ( ring && ) = delete;
+
+    ~ring ( ) noexcept {
+        pdr::free ( buffer );
+        pdr::free ( stamps ); // std::atomic<size_type> is trivially destructible.
+    }
+
+    // producers.
+
+    [[nodiscard]] bool try_push ( const_reference value ) noexcept { return push_n ( &value, 1u ); }
+    template<typename... Args>
+    [[nodiscard]] bool try_emplace ( Args &&... args ) noexcept {
+        value_type const value{ std::forward<Args> ( args )... };
+        return push_n ( &value, 1u );
+    }
+
+    // pushes up to count values (as many as fit), returns the number of values pushed.
+    [[maybe_unused]] size_type push_n ( const_pointer values, size_type count ) noexcept {
+        if constexpr ( multiple_producers ( ) ) {
+            size_type t = prod.tail.load ( std::memory_order_relaxed );
+            size_type n;
+            do {
+                n = std::min ( count, capacity ( ) - ( t - cons.head.load ( std::memory_order_acquire ) ) );
+                if ( not n )
+                    return 0u;
+            } while ( not prod.tail.compare_exchange_weak ( t, t + n, std::memory_order_relaxed, std::memory_order_relaxed ) );
+            write ( t, values, n );
+            for ( size_type i = t; i != t + n; ++i ) // publish per slot.
+                stamps[ i & mask ].store ( i + 1u, std::memory_order_release );
+            return n;
+        }
+        else {
+            size_type const t = prod.tail.load ( std::memory_order_relaxed );
+            if ( capacity ( ) - ( t - prod.head_cache ) < count )
+                prod.head_cache = cons.head.load ( std::memory_order_acquire );
+            size_type const n = std::min ( count, capacity ( ) - ( t - prod.head_cache ) );
+            if ( n ) {
+                write ( t, values, n );
+                prod.tail.store ( t + n, std::memory_order_release );
+            }
+            return n;
+        }
+    }
+
+    // the consumer.
+
+    [[nodiscard]] optional_value_type try_pop ( ) noexcept {
+        value_type value;
+        if ( pop_n ( &value, 1u ) )
+            return optional_value_type{ value };
+        return optional_value_type{};
+    }
+
+    // pops up to count values (as many as available), returns the number of values popped.
+    [[maybe_unused]] size_type pop_n ( pointer values, size_type count ) noexcept {
+        size_type const h = cons.head.load ( std::memory_order_relaxed );
+        size_type n       = 0u;
+        if constexpr ( multiple_producers ( ) ) { // the run of published slots at the head.
+            while ( n != count and stamps[ ( h + n ) & mask ].load ( std::memory_order_acquire ) == h + n + 1u )
+                ++n;
+        }
+        else {
+            if ( cons.tail_cache - h < count )
+                cons.tail_cache = prod.tail.load ( std::memory_order_acquire );
+            n = std::min ( count, static_cast<size_type> ( cons.tail_cache - h ) );
+        }
+        if ( n ) {
+            read ( h, values, n );
+            cons.head.store ( h + n, std::memory_order_release );
+        }
+        return n;
+    }
+
+    // observers, approximate while other threads push or pop (with multiple producers the reserved values,
+    // including the ones that are still being written, are counted).
+
+    [[nodiscard]] size_type capacity ( ) const noexcept { return mask + 1u; }
+    [[nodiscard]] size_type size ( ) const noexcept {
+        size_type const h = cons.head.load ( std::memory_order_acquire );
+        return static_cast<size_type> ( prod.tail.load ( std::memory_order_acquire ) - h );
+    }
+    [[nodiscard]] bool empty ( ) const noexcept { return not size ( ); }
+
+    private:
+    [[nodiscard]] static size_type round_up ( size_type const c ) noexcept {
+        assert ( c <= ( size_type{ 1 } << ( std::numeric_limits<size_type>::digits - 1 ) ) );
+        size_type p = 1u;
+        while ( p < c )
+            p <<= 1;
+        return p;
+    }
+
+    // the values [ i, i + n ) of the ring, in (at most) two contiguous spans.
+    void write ( size_type const i, const_pointer values, size_type const n ) noexcept {
+        size_type const b = i & mask, first = std::min ( n, static_cast<size_type> ( capacity ( ) - b ) );
+        std::memcpy ( ( void * ) ( buffer + b ), ( void * ) values, first * sizeof ( value_type ) );
+        std::memcpy ( ( void * ) buffer, ( void * ) ( values + first ), ( n - first ) * sizeof ( value_type ) );
+    }
+    void read ( size_type const i, pointer values, size_type const n ) const noexcept {
+        size_type const b = i & mask, first = std::min ( n, static_cast<size_type> ( capacity ( ) - b ) );
+        std::memcpy ( ( void * ) values, ( void * ) ( buffer + b ), first * sizeof ( value_type ) );
+        std::memcpy ( ( void * ) ( values + first ), ( void * ) buffer, ( n - first ) * sizeof ( value_type ) );
+    }
+
+    // the slot sequence numbers (multiple producers only), slot i & mask holds index i when it's stamped i + 1.
+    [[nodiscard]] static std::atomic<size_type> * make_stamps ( size_type const c ) noexcept {
+        if constexpr ( multiple_producers ( ) ) {
+            auto * const s = static_cast<std::atomic<size_type> *> ( pdr::malloc ( c * sizeof ( std::atomic<size_type> ) ) );
+            for ( size_type i = 0u; i != c; ++i )
+                new ( s + i ) std::atomic<size_type>{ 0u };
+            return s;
+        }
+        else {
+            return nullptr;
+        }
+    }
+
+    struct single_producer_s {
+        alignas ( cache_line_size ) std::atomic<size_type> tail{ 0u };
+        size_type head_cache = 0u;
+    };
+    struct multiple_producer_s {
+        alignas ( cache_line_size ) std::atomic<size_type> tail{ 0u }; // reserved.
+    };
+    struct consumer_s {
+        alignas ( cache_line_size ) std::atomic<size_type> head{ 0u };
+        size_type tail_cache = 0u;
+    };
+
+    pointer const buffer;
+    std::atomic<size_type> * const stamps;
+    size_type const mask;
+    std::conditional_t<multiple_producers ( ), multiple_producer_s, single_producer_s> prod;
+    consumer_s cons;
+};
+
+template<typename Type, typename SizeType = std::size_t>
+using spsc_ring = ring<Type, SizeType, producers::single>;
+template<typename Type, typename SizeType = std::size_t>
+using mpsc_ring = ring<Type, SizeType, producers::multiple>;
+
+} // namespace pdr
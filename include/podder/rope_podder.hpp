@@ -0,0 +1,638 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "podder.hpp"
+
+namespace pdr {
+
+// A B+-tree of fixed size leaves, for huge sequences with inserts and erases at random positions. Insert, erase,
+// indexed access, split and concat are O ( log n ), the leaves hold up to leaf_capacity values in one block of
+// LeafBytes (a page by default, the size field included) and the inner nodes keep the counts of their subtrees
+// (fanout of them, a multiple of the cache line). A leaf that overflows splits in two, a node that runs low (under a
+// quarter full) after an erase, a split or a concat merges with a neighbour if the two fit in one and takes half of the
+// neighbour's otherwise, i.e. all nodes but the root stay at least a quarter full and the depth stays logarithmic.
+// flatten ( ) copies the whole thing back into a podder, leaf by leaf.
+template<typename Type, typename SizeType = std::size_t, std::size_t LeafBytes = 4'096u>
+class rope_podder {
+
+    static_assert ( std::is_trivially_copyable<Type>::value, "Type must be trivially copyable!" );
+    static_assert ( alignof ( Type ) <= alignof ( std::max_align_t ), "Type can't be over-aligned (the leaves come from malloc)!" );
+
+    public:
+    using value_type      = Type;
+    using size_type       = SizeType;
+    using pointer         = value_type *;
+    using const_pointer   = value_type const *;
+    using reference       = value_type &;
+    using const_reference = value_type const &;
+    using podder_type     = podder<Type, SizeType>;
+
+    private:
+    static constexpr std::size_t leaf_header = std::max ( sizeof ( std::uint32_t ), alignof ( Type ) );
+
+    public:
+    static constexpr std::uint32_t leaf_capacity = static_cast<std::uint32_t> ( ( LeafBytes - leaf_header ) / sizeof ( Type ) );
+    static constexpr std::uint32_t fanout        = 64u;
+
+    static_assert ( leaf_capacity >= 4u, "LeafBytes is too small for Type!" );
+
+    private:
+    struct leaf {
+        std::uint32_t n;
+
+        [[nodiscard]] pointer values ( ) noexcept {
+            return reinterpret_cast<pointer> ( reinterpret_cast<char *> ( this ) + leaf_header );
+        }
+    };
+
+    struct inner {
+        std::uint32_t n;
+        size_type counts[ fanout ];
+        void * children[ fanout ];
+    };
+
+    // a (sub)tree and its count.
+    struct piece {
+        void * p    = nullptr;
+        size_type c = 0;
+    };
+    // what became of a (sub)tree after an edit, the second one (if any) goes right of the first.
+    struct pieces {
+        piece first, second;
+    };
+
+    void * root      = nullptr;
+    size_type height = 0; // the leaves are at height 0.
+    size_type count  = 0;
+
+    [[nodiscard]] static leaf * as_leaf ( void * p ) noexcept { return static_cast<leaf *> ( p ); }
+    [[nodiscard]] static inner * as_inner ( void * p ) noexcept { return static_cast<inner *> ( p ); }
+
+    [[nodiscard]] static leaf * make_leaf ( ) noexcept {
+        leaf * const l = static_cast<leaf *> ( pdr::malloc ( leaf_header + leaf_capacity * sizeof ( value_type ) ) );
+        l->n           = 0;
+        return l;
+    }
+    [[nodiscard]] static inner * make_inner ( ) noexcept {
+        inner * const x = static_cast<inner *> ( pdr::malloc ( sizeof ( inner ) ) );
+        x->n            = 0;
+        return x;
+    }
+
+    [[nodiscard]] static constexpr std::uint32_t node_capacity ( size_type const h ) noexcept {
+        return h ? fanout : leaf_capacity;
+    }
+    [[nodiscard]] static std::uint32_t node_size ( void * p, size_type const h ) noexcept {
+        return h ? as_inner ( p )->n : as_leaf ( p )->n;
+    }
+    // the least a node (but the root) holds.
+    [[nodiscard]] static constexpr std::uint32_t node_minimum ( size_type const h ) noexcept {
+        return node_capacity ( h ) / 4u;
+    }
+
+    static void destroy ( void * p, size_type const h ) noexcept {
+        if ( h ) {
+            inner * const x = as_inner ( p );
+            for ( std::uint32_t k = 0; k < x->n; ++k )
+                destroy ( x->children[ k ], h - 1 );
+        }
+        pdr::free ( p );
+    }
+
+    [[nodiscard]] static void * clone ( void * p, size_type const h ) noexcept {
+        if ( not h ) {
+            std::size_t const b = leaf_header + as_leaf ( p )->n * sizeof ( value_type );
+            leaf * const l      = make_leaf ( );
+            std::memcpy ( ( void * ) l, p, b );
+            return l;
+        }
+        inner * const x = make_inner ( );
+        std::memcpy ( ( void * ) x, p, sizeof ( inner ) );
+        for ( std::uint32_t k = 0; k < x->n; ++k )
+            x->children[ k ] = clone ( x->children[ k ], h - 1 );
+        return x;
+    }
+
+    // child k of x, moves down by the values left of it.
+    [[nodiscard]] static std::uint32_t child_at ( inner const * const x, size_type & i ) noexcept {
+        std::uint32_t k = 0;
+        while ( i >= x->counts[ k ] )
+            i -= x->counts[ k++ ];
+        return k;
+    }
+
+    static void insert_at ( inner * const x, std::uint32_t const k, piece const e ) noexcept {
+        std::memmove ( x->children + k + 1, x->children + k, ( x->n - k ) * sizeof ( void * ) );
+        std::memmove ( x->counts + k + 1, x->counts + k, ( x->n - k ) * sizeof ( size_type ) );
+        x->children[ k ] = e.p;
+        x->counts[ k ]   = e.c;
+        ++x->n;
+    }
+    static void remove_at ( inner * const x, std::uint32_t const k ) noexcept {
+        --x->n;
+        std::memmove ( x->children + k, x->children + k + 1, ( x->n - k ) * sizeof ( void * ) );
+        std::memmove ( x->counts + k, x->counts + k + 1, ( x->n - k ) * sizeof ( size_type ) );
+    }
+
+    // moves the upper half of p into a new node.
+    [[nodiscard]] static piece split_half ( void * p, size_type const h ) noexcept {
+        if ( not h ) {
+            leaf * const l = as_leaf ( p ), *const m = make_leaf ( );
+            std::uint32_t const half = l->n / 2u;
+            m->n                     = l->n - half;
+            std::memcpy ( ( void * ) m->values ( ), ( void * ) ( l->values ( ) + half ), m->n * sizeof ( value_type ) );
+            l->n = half;
+            return { m, m->n };
+        }
+        inner * const x = as_inner ( p ), *const y = make_inner ( );
+        std::uint32_t const half = x->n / 2u;
+        y->n                     = x->n - half;
+        std::memcpy ( y->children, x->children + half, y->n * sizeof ( void * ) );
+        std::memcpy ( y->counts, x->counts + half, y->n * sizeof ( size_type ) );
+        x->n = half;
+        size_type c = 0;
+        for ( std::uint32_t k = 0; k < y->n; ++k )
+            c += y->counts[ k ];
+        return { y, c };
+    }
+
+    // appends (the contents of) q to p (they fit), q is freed.
+    static void merge ( void * p, void * q, size_type const h ) noexcept {
+        if ( not h ) {
+            leaf * const l = as_leaf ( p ), *const m = as_leaf ( q );
+            std::memcpy ( ( void * ) ( l->values ( ) + l->n ), ( void * ) m->values ( ), m->n * sizeof ( value_type ) );
+            l->n += m->n;
+        }
+        else {
+            inner * const x = as_inner ( p ), *const y = as_inner ( q );
+            std::memcpy ( x->children + x->n, y->children, y->n * sizeof ( void * ) );
+            std::memcpy ( x->counts + x->n, y->counts, y->n * sizeof ( size_type ) );
+            x->n += y->n;
+        }
+        pdr::free ( q );
+    }
+
+    // moves the first m of the nb entries of b to the back of a (of na), or the last m of a to the front of b.
+    template<typename T>
+    static void move_front ( T * const a, std::uint32_t const na, T * const b, std::uint32_t const nb, std::uint32_t const m ) noexcept {
+        std::memcpy ( ( void * ) ( a + na ), ( void * ) b, m * sizeof ( T ) );
+        std::memmove ( ( void * ) b, ( void * ) ( b + m ), ( nb - m ) * sizeof ( T ) );
+    }
+    template<typename T>
+    static void move_back ( T * const a, std::uint32_t const na, T * const b, std::uint32_t const nb, std::uint32_t const m ) noexcept {
+        std::memmove ( ( void * ) ( b + m ), ( void * ) b, nb * sizeof ( T ) );
+        std::memcpy ( ( void * ) b, ( void * ) ( a + na - m ), m * sizeof ( T ) );
+    }
+
+    // evens out the neighbours l and r (of counts cl and cr).
+    static void balance ( void * const l, size_type & cl, void * const r, size_type & cr, size_type const h ) noexcept {
+        std::uint32_t const nl = node_size ( l, h ), nr = node_size ( r, h ), half = ( nl + nr ) / 2u;
+        if ( nl == half )
+            return;
+        if ( not h ) {
+            leaf * const a = as_leaf ( l ), *const b = as_leaf ( r );
+            if ( nl < half ) {
+                std::uint32_t const m = half - nl;
+                move_front ( a->values ( ), nl, b->values ( ), nr, m );
+                a->n += m, b->n -= m, cl += m, cr -= m;
+            }
+            else {
+                std::uint32_t const m = nl - half;
+                move_back ( a->values ( ), nl, b->values ( ), nr, m );
+                a->n -= m, b->n += m, cl -= m, cr += m;
+            }
+            return;
+        }
+        inner * const x = as_inner ( l ), *const y = as_inner ( r );
+        size_type c     = 0;
+        if ( nl < half ) {
+            std::uint32_t const m = half - nl;
+            for ( std::uint32_t k = 0; k < m; ++k )
+                c += y->counts[ k ];
+            move_front ( x->children, nl, y->children, nr, m );
+            move_front ( x->counts, nl, y->counts, nr, m );
+            x->n += m, y->n -= m, cl += c, cr -= c;
+        }
+        else {
+            std::uint32_t const m = nl - half;
+            for ( std::uint32_t k = nl - m; k < nl; ++k )
+                c += x->counts[ k ];
+            move_back ( x->children, nl, y->children, nr, m );
+            move_back ( x->counts, nl, y->counts, nr, m );
+            x->n -= m, y->n += m, cl -= c, cr += c;
+        }
+    }
+
+    // inserts e at k in x (of count c, e included), splits x if full.
+    [[nodiscard]] static pieces insert_child ( inner * const x, size_type const c, std::uint32_t const k, piece const e ) noexcept {
+        if ( x->n < fanout ) {
+            insert_at ( x, k, e );
+            return { { x, c }, {} };
+        }
+        piece y = split_half ( x, 1 );
+        if ( k <= x->n ) {
+            insert_at ( x, k, e );
+        }
+        else {
+            insert_at ( as_inner ( y.p ), k - x->n, e );
+            y.c += e.c;
+        }
+        return { { x, c - y.c }, y };
+    }
+
+    [[nodiscard]] static pieces insert_into ( void * p, size_type const h, size_type const c, size_type i,
+                                              const_reference v ) noexcept {
+        if ( not h ) {
+            leaf * l = as_leaf ( p );
+            piece r;
+            if ( l->n == leaf_capacity ) {
+                r = split_half ( p, 0 );
+                if ( i > l->n ) {
+                    i -= l->n;
+                    l = as_leaf ( r.p );
+                    ++r.c;
+                }
+            }
+            std::memmove ( ( void * ) ( l->values ( ) + i + 1 ), ( void * ) ( l->values ( ) + i ), ( l->n - i ) * sizeof ( value_type ) );
+            l->values ( )[ i ] = v;
+            ++l->n;
+            return { { p, c + 1 - r.c }, r };
+        }
+        inner * const x = as_inner ( p );
+        std::uint32_t k = 0;
+        while ( k + 1 < x->n and i > x->counts[ k ] ) // at the end of a child rather than at the start of the next.
+            i -= x->counts[ k++ ];
+        pieces const r   = insert_into ( x->children[ k ], h - 1, x->counts[ k ], i, v );
+        x->children[ k ] = r.first.p;
+        x->counts[ k ]   = r.first.c;
+        if ( r.second.p )
+            return insert_child ( x, c + 1, k + 1, r.second );
+        return { { p, c + 1 }, {} };
+    }
+
+    // merges child k of x with a neighbour if it ran low and the two fit in one node, evens them out otherwise.
+    static void rebalance ( inner * const x, size_type const h, std::uint32_t const k ) noexcept {
+        if ( x->n < 2u or node_size ( x->children[ k ], h - 1 ) >= node_minimum ( h - 1 ) )
+            return;
+        std::uint32_t const j = k + 1 < x->n ? k : k - 1; // j and j + 1.
+        if ( node_size ( x->children[ j ], h - 1 ) + node_size ( x->children[ j + 1 ], h - 1 ) <= node_capacity ( h - 1 ) ) {
+            merge ( x->children[ j ], x->children[ j + 1 ], h - 1 );
+            x->counts[ j ] += x->counts[ j + 1 ];
+            remove_at ( x, j + 1 );
+        }
+        else {
+            balance ( x->children[ j ], x->counts[ j ], x->children[ j + 1 ], x->counts[ j + 1 ], h - 1 );
+        }
+    }
+
+    static void erase_from ( void * p, size_type const h, size_type i ) noexcept {
+        if ( not h ) {
+            leaf * const l = as_leaf ( p );
+            --l->n;
+            std::memmove ( ( void * ) ( l->values ( ) + i ), ( void * ) ( l->values ( ) + i + 1 ), ( l->n - i ) * sizeof ( value_type ) );
+            return;
+        }
+        inner * const x       = as_inner ( p );
+        std::uint32_t const k = child_at ( x, i );
+        erase_from ( x->children[ k ], h - 1, i );
+        if ( --x->counts[ k ] ) {
+            rebalance ( x, h, k );
+        }
+        else {
+            pdr::free ( x->children[ k ] );
+            remove_at ( x, k );
+        }
+    }
+
+    // splits p at i, 0 < i < count of p, neither side ends up empty, but the nodes along the cut can be left low (see
+    // repair).
+    [[nodiscard]] static std::pair<void *, void *> split_node ( void * p, size_type const h, size_type i ) noexcept {
+        if ( not h ) {
+            leaf * const l = as_leaf ( p ), *const m = make_leaf ( );
+            m->n = static_cast<std::uint32_t> ( l->n - i );
+            std::memcpy ( ( void * ) m->values ( ), ( void * ) ( l->values ( ) + i ), m->n * sizeof ( value_type ) );
+            l->n = static_cast<std::uint32_t> ( i );
+            return { l, m };
+        }
+        inner * const x = as_inner ( p ), *const y = make_inner ( );
+        std::uint32_t k = child_at ( x, i ), b = k;
+        if ( i ) {
+            auto const [ cl, cr ] = split_node ( x->children[ k ], h - 1, i );
+            y->children[ 0 ]      = cr;
+            y->counts[ 0 ]        = x->counts[ k ] - i;
+            y->n                  = 1;
+            x->children[ k ]      = cl;
+            x->counts[ k ]        = i;
+            b                     = ++k;
+        }
+        std::memcpy ( y->children + y->n, x->children + k, ( x->n - k ) * sizeof ( void * ) );
+        std::memcpy ( y->counts + y->n, x->counts + k, ( x->n - k ) * sizeof ( size_type ) );
+        y->n += x->n - k;
+        x->n = b;
+        return { x, y };
+    }
+
+    // joins y onto the right (left) edge of x, y is not higher than x. y (a root) meets the node of its height on the
+    // edge of x, the two merge if they fit in one node and are evened out otherwise (before the second one goes into
+    // the parent, or under a new root).
+    [[nodiscard]] static pieces join ( void * x, size_type const hx, size_type const cx, void * y, size_type const hy,
+                                       size_type const cy, bool const right ) noexcept {
+        if ( hx == hy ) {
+            piece l{ x, cx }, r{ y, cy };
+            if ( not right )
+                std::swap ( l, r );
+            if ( node_size ( l.p, hx ) + node_size ( r.p, hx ) <= node_capacity ( hx ) ) {
+                merge ( l.p, r.p, hx );
+                return { { l.p, cx + cy }, {} };
+            }
+            balance ( l.p, l.c, r.p, r.c, hx );
+            return { l, r };
+        }
+        inner * const n       = as_inner ( x );
+        std::uint32_t const k = right ? n->n - 1 : 0u;
+        pieces const r        = join ( n->children[ k ], hx - 1, n->counts[ k ], y, hy, cy, right );
+        n->children[ k ]      = r.first.p;
+        n->counts[ k ]        = r.first.c;
+        if ( r.second.p )
+            return insert_child ( n, cx + cy, k + 1, r.second );
+        return { { x, cx + cy }, {} };
+    }
+
+    // a new root on top of the pieces, if there are 2 of them.
+    void grow ( pieces const & r ) noexcept {
+        root = r.first.p;
+        if ( r.second.p ) {
+            inner * const x = make_inner ( );
+            insert_at ( x, 0, r.first );
+            insert_at ( x, 1, r.second );
+            root = x;
+            ++height;
+        }
+    }
+    // drops roots with a single child.
+    void shrink ( ) noexcept {
+        while ( height and as_inner ( root )->n == 1u ) {
+            void * const c = as_inner ( root )->children[ 0 ];
+            pdr::free ( root );
+            root = c;
+            --height;
+        }
+    }
+    // tops up the nodes along the right (left) edge, after a split cut through them, top down, one rebalance per
+    // level. Only the root can be left with a single child (the edge node below got topped up), it's dropped.
+    void repair ( bool const right ) noexcept {
+        shrink ( );
+        void * p    = root;
+        size_type h = height;
+        while ( h ) {
+            inner * const x = as_inner ( p );
+            rebalance ( x, h, right ? x->n - 1u : 0u );
+            if ( x->n == 1u ) {
+                assert ( p == root );
+                shrink ( );
+                p = root;
+                h = height;
+                continue;
+            }
+            p = x->children[ right ? x->n - 1u : 0u ];
+            --h;
+        }
+    }
+
+    template<typename Function>
+    static void for_each_leaf ( void * p, size_type const h, Function & f ) {
+        if ( not h ) {
+            f ( const_cast<const_pointer> ( as_leaf ( p )->values ( ) ), static_cast<size_type> ( as_leaf ( p )->n ) );
+            return;
+        }
+        inner * const x = as_inner ( p );
+        for ( std::uint32_t k = 0; k < x->n; ++k )
+            for_each_leaf ( x->children[ k ], h - 1, f );
+    }
+
+    // bulk load, full leaves.
+    void build ( const_pointer const first, size_type const n ) noexcept {
+        if ( not n )
+            return;
+        podder<piece> level;
+        for ( size_type i = 0; i < n; i += leaf_capacity ) {
+            leaf * const l = make_leaf ( );
+            l->n           = static_cast<std::uint32_t> ( std::min<size_type> ( leaf_capacity, n - i ) );
+            std::memcpy ( ( void * ) l->values ( ), ( void * ) ( first + i ), l->n * sizeof ( value_type ) );
+            level.push_back ( piece{ l, l->n } );
+        }
+        while ( level.size ( ) > 1u ) {
+            podder<piece> up;
+            for ( std::size_t i = 0; i < level.size ( ); i += fanout ) {
+                inner * const x = make_inner ( );
+                size_type c     = 0;
+                for ( std::size_t j = i, e = std::min<std::size_t> ( i + fanout, level.size ( ) ); j < e; ++j ) {
+                    insert_at ( x, x->n, level[ j ] );
+                    c += level[ j ].c;
+                }
+                up.push_back ( piece{ x, c } );
+            }
+            level.swap ( up );
+            ++height;
+        }
+        root  = level[ 0 ].p;
+        count = n;
+    }
+
+    public:
+    rope_podder ( ) noexcept = default;
+    rope_podder ( const_pointer const first, size_type const n ) noexcept { build ( first, n ); }
+    rope_podder ( std::initializer_list<value_type> il ) noexcept :
+        rope_podder ( il.begin ( ), static_cast<size_type> ( il.size ( ) ) ) {}
+    rope_podder ( rope_podder const & r ) noexcept :
+        root ( r.root ? clone ( r.root, r.height ) : nullptr ), height ( r.height ), count ( r.count ) {}
+    rope_podder ( rope_podder && r ) noexcept :
+        root ( std::exchange ( r.root, nullptr ) ), height ( std::exchange ( r.height, 0 ) ),
+        count ( std::exchange ( r.count, 0 ) ) {}
+    ~rope_podder ( ) noexcept { clear ( ); }
+
+    rope_podder & operator= ( rope_podder const & r ) noexcept {
+        if ( this != &r ) {
+            rope_podder t ( r );
+            swap ( t );
+        }
+        return *this;
+    }
+    rope_podder & operator= ( rope_podder && r ) noexcept {
+        rope_podder t ( std::move ( r ) );
+        swap ( t );
+        return *this;
+    }
+
+    void swap ( rope_podder & r ) noexcept {
+        std::swap ( root, r.root );
+        std::swap ( height, r.height );
+        std::swap ( count, r.count );
+    }
+
+    [[nodiscard]] size_type size ( ) const noexcept { return count; }
+    [[nodiscard]] bool empty ( ) const noexcept { return not count; }
+    [[nodiscard]] size_type depth ( ) const noexcept { return root ? height + 1 : 0; }
+
+    void clear ( ) noexcept {
+        if ( root )
+            destroy ( root, height );
+        root   = nullptr;
+        height = count = 0;
+    }
+
+    // element access, O ( log n ).
+
+    [[nodiscard]] reference operator[] ( size_type i ) noexcept {
+        assert ( i < count );
+        void * p = root;
+        for ( size_type h = height; h; --h ) {
+            inner * const x = as_inner ( p );
+            p               = x->children[ child_at ( x, i ) ];
+        }
+        return as_leaf ( p )->values ( )[ i ];
+    }
+    [[nodiscard]] const_reference operator[] ( size_type const i ) const noexcept {
+        return const_cast<rope_podder *> ( this )->operator[] ( i );
+    }
+    [[nodiscard]] reference front ( ) noexcept { return ( *this )[ 0 ]; }
+    [[nodiscard]] const_reference front ( ) const noexcept { return ( *this )[ 0 ]; }
+    [[nodiscard]] reference back ( ) noexcept { return ( *this )[ count - 1 ]; }
+    [[nodiscard]] const_reference back ( ) const noexcept { return ( *this )[ count - 1 ]; }
+
+    // modifiers, O ( log n ).
+
+    void insert ( size_type const i, const_reference value ) noexcept {
+        assert ( i <= count );
+        value_type const v = value; // value might refer into the rope.
+        if ( not root ) {
+            root = make_leaf ( );
+        }
+        grow ( insert_into ( root, height, count, i, v ) );
+        ++count;
+    }
+    void push_back ( const_reference value ) noexcept { insert ( count, value ); }
+    void push_front ( const_reference value ) noexcept { insert ( 0, value ); }
+
+    void erase ( size_type const i ) noexcept {
+        assert ( i < count );
+        if ( not --count ) {
+            clear ( );
+            return;
+        }
+        erase_from ( root, height, i );
+        shrink ( );
+    }
+    // erases [ i, i + n ), by 2 splits and a concat.
+    void erase ( size_type const i, size_type const n ) noexcept {
+        assert ( i + n <= count );
+        if ( n ) {
+            rope_podder tail = split ( i + n );
+            static_cast<void> ( split ( i ) ); // [ i, i + n ), discarded.
+            append ( std::move ( tail ) );
+        }
+    }
+
+    // keeps [ 0, i ), returns [ i, size ( ) ).
+    [[nodiscard]] rope_podder split ( size_type const i ) noexcept {
+        assert ( i <= count );
+        rope_podder r;
+        if ( not i ) {
+            swap ( r );
+        }
+        else if ( i < count ) {
+            auto const [ l, rr ] = split_node ( root, height, i );
+            root                 = l;
+            r.root               = rr;
+            r.height             = height;
+            r.count              = count - i;
+            count                = i;
+            repair ( true );
+            r.repair ( false );
+        }
+        return r;
+    }
+
+    // appends (the contents of) r, r ends up empty.
+    void append ( rope_podder && r ) noexcept {
+        if ( not r.root )
+            return;
+        if ( not root ) {
+            swap ( r );
+            return;
+        }
+        if ( height >= r.height ) {
+            grow ( join ( root, height, count, r.root, r.height, r.count, true ) );
+        }
+        else {
+            pieces const p = join ( r.root, r.height, r.count, root, height, count, false );
+            height         = r.height;
+            grow ( p );
+        }
+        count += r.count;
+        r.root   = nullptr;
+        r.height = r.count = 0;
+    }
+
+    // iteration, leaf by leaf, f ( const_pointer values, size_type n ).
+
+    template<typename Function>
+    void for_each_leaf ( Function f ) const {
+        if ( root )
+            for_each_leaf ( root, height, f );
+    }
+    template<typename Function>
+    void for_each ( Function f ) const {
+        for_each_leaf ( [ &f ] ( const_pointer p, size_type const n ) {
+            for ( const_pointer const e = p + n; p != e; ++p )
+                f ( *p );
+        } );
+    }
+
+    // a contiguous copy.
+    [[nodiscard]] podder_type flatten ( ) const noexcept {
+        podder_type p;
+        p.resize_reserve_only ( count );
+        pointer d = p.data ( );
+        for_each_leaf ( [ &d ] ( const_pointer const v, size_type const n ) {
+            std::memcpy ( ( void * ) d, ( void * ) v, n * sizeof ( value_type ) );
+            d += n;
+        } );
+        return p;
+    }
+};
+
+} // namespace pdr
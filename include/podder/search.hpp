@@ -0,0 +1,174 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "compare.hpp" // detail::count_trailing_zeros.
+
+#if defined( __AVX2__ ) or defined( __SSE2__ ) or defined( _M_X64 )
+#    include <immintrin.h>
+#endif
+
+// byte searches, SSE2/AVX2 compare + movemask, all return size ( npos ) if not found.
+
+namespace pdr {
+
+namespace detail {
+[[nodiscard]] inline std::size_t count_leading_zeros ( std::uint32_t const m ) noexcept {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+    unsigned long i;
+    _BitScanReverse ( &i, m );
+    return 31u - i;
+#else
+    return static_cast<std::size_t> ( __builtin_clz ( m ) );
+#endif
+}
+} // namespace detail
+
+// the index of the first c in [ p, p + size ).
+[[nodiscard]] inline std::size_t find_byte ( void const * p, std::size_t const size, unsigned char const c ) noexcept {
+    unsigned char const * s = static_cast<unsigned char const *> ( p );
+    std::size_t i           = 0;
+#if defined( __AVX2__ )
+    __m256i const v32 = _mm256_set1_epi8 ( static_cast<char> ( c ) );
+    for ( ; i + 32u <= size; i += 32u ) {
+        std::uint32_t const m = static_cast<std::uint32_t> (
+            _mm256_movemask_epi8 ( _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s + i ) ), v32 ) ) );
+        if ( m )
+            return i + detail::count_trailing_zeros ( m );
+    }
+#endif
+#if defined( __SSE2__ ) or defined( _M_X64 )
+    __m128i const v16 = _mm_set1_epi8 ( static_cast<char> ( c ) );
+    for ( ; i + 16u <= size; i += 16u ) {
+        std::uint32_t const m = static_cast<std::uint32_t> (
+            _mm_movemask_epi8 ( _mm_cmpeq_epi8 ( _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( s + i ) ), v16 ) ) );
+        if ( m )
+            return i + detail::count_trailing_zeros ( m );
+    }
+#endif
+    for ( ; i < size; ++i )
+        if ( s[ i ] == c )
+            return i;
+    return size;
+}
+
+// the index of the last c in [ p, p + size ).
+[[nodiscard]] inline std::size_t rfind_byte ( void const * p, std::size_t const size, unsigned char const c ) noexcept {
+    unsigned char const * s = static_cast<unsigned char const *> ( p );
+    std::size_t i           = size; // [ 0, i ) remains.
+#if defined( __AVX2__ )
+    __m256i const v32 = _mm256_set1_epi8 ( static_cast<char> ( c ) );
+    for ( ; i >= 32u; i -= 32u ) {
+        std::uint32_t const m = static_cast<std::uint32_t> ( _mm256_movemask_epi8 (
+            _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s + i - 32u ) ), v32 ) ) );
+        if ( m )
+            return i - 1u - detail::count_leading_zeros ( m );
+    }
+#endif
+#if defined( __SSE2__ ) or defined( _M_X64 )
+    __m128i const v16 = _mm_set1_epi8 ( static_cast<char> ( c ) );
+    for ( ; i >= 16u; i -= 16u ) {
+        std::uint32_t const m = static_cast<std::uint32_t> (
+            _mm_movemask_epi8 ( _mm_cmpeq_epi8 ( _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( s + i - 16u ) ), v16 ) ) );
+        if ( m )
+            return i - 16u + 31u - detail::count_leading_zeros ( m );
+    }
+#endif
+    while ( i-- )
+        if ( s[ i ] == c )
+            return i;
+    return size;
+}
+
+// the index of the first occurrence of the needle [ n, n + n_size ) in [ p, p + size ). Candidates are the positions
+// where both the first and the last byte of the needle match (one vector compare each), the rest of the needle is
+// only compared at those.
+[[nodiscard]] inline std::size_t find_bytes ( void const * p, std::size_t const size, void const * n,
+                                              std::size_t const n_size ) noexcept {
+    unsigned char const * s  = static_cast<unsigned char const *> ( p );
+    unsigned char const * nd = static_cast<unsigned char const *> ( n );
+    if ( not n_size )
+        return 0u;
+    if ( n_size > size )
+        return size;
+    if ( n_size == 1u )
+        return find_byte ( s, size, nd[ 0 ] );
+    std::size_t const last = n_size - 1u, end = size - last; // candidates are in [ 0, end ).
+    std::size_t i          = 0;
+#if defined( __AVX2__ )
+    __m256i const f32 = _mm256_set1_epi8 ( static_cast<char> ( nd[ 0 ] ) );
+    __m256i const l32 = _mm256_set1_epi8 ( static_cast<char> ( nd[ last ] ) );
+    for ( ; i + 32u <= end; i += 32u ) {
+        __m256i const a = _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s + i ) ), f32 );
+        __m256i const b = _mm256_cmpeq_epi8 ( _mm256_loadu_si256 ( reinterpret_cast<__m256i const *> ( s + i + last ) ), l32 );
+        for ( std::uint32_t m = static_cast<std::uint32_t> ( _mm256_movemask_epi8 ( _mm256_and_si256 ( a, b ) ) ); m; m &= m - 1u ) {
+            std::size_t const j = i + detail::count_trailing_zeros ( m );
+            if ( std::memcmp ( s + j + 1u, nd + 1u, last - 1u ) == 0 )
+                return j;
+        }
+    }
+#endif
+#if defined( __SSE2__ ) or defined( _M_X64 )
+    __m128i const f16 = _mm_set1_epi8 ( static_cast<char> ( nd[ 0 ] ) );
+    __m128i const l16 = _mm_set1_epi8 ( static_cast<char> ( nd[ last ] ) );
+    for ( ; i + 16u <= end; i += 16u ) {
+        __m128i const a = _mm_cmpeq_epi8 ( _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( s + i ) ), f16 );
+        __m128i const b = _mm_cmpeq_epi8 ( _mm_loadu_si128 ( reinterpret_cast<__m128i const *> ( s + i + last ) ), l16 );
+        for ( std::uint32_t m = static_cast<std::uint32_t> ( _mm_movemask_epi8 ( _mm_and_si128 ( a, b ) ) ); m; m &= m - 1u ) {
+            std::size_t const j = i + detail::count_trailing_zeros ( m );
+            if ( std::memcmp ( s + j + 1u, nd + 1u, last - 1u ) == 0 )
+                return j;
+        }
+    }
+#endif
+    for ( ; i < end; ++i )
+        if ( s[ i ] == nd[ 0 ] and s[ i + last ] == nd[ last ] and std::memcmp ( s + i + 1u, nd + 1u, last - 1u ) == 0 )
+            return i;
+    return size;
+}
+
+// the index of the last occurrence of the needle in [ p, p + size ), size if not found or the needle is empty.
+[[nodiscard]] inline std::size_t rfind_bytes ( void const * p, std::size_t const size, void const * n,
+                                               std::size_t const n_size ) noexcept {
+    unsigned char const * s  = static_cast<unsigned char const *> ( p );
+    unsigned char const * nd = static_cast<unsigned char const *> ( n );
+    if ( not n_size or n_size > size )
+        return size;
+    for ( std::size_t bound = size - n_size + 1u; bound; ) { // candidates are in [ 0, bound ).
+        std::size_t const i = rfind_byte ( s, bound, nd[ 0 ] );
+        if ( i == bound )
+            break;
+        if ( std::memcmp ( s + i, nd, n_size ) == 0 )
+            return i;
+        bound = i;
+    }
+    return size;
+}
+
+} // namespace pdr
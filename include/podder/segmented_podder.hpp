@@ -0,0 +1,266 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#if defined( _MSC_VER ) and not defined( __clang__ )
+#    include <intrin.h>
+#endif
+#if defined( __unix__ ) or defined( __APPLE__ )
+#    include <sys/uio.h>
+#endif
+
+#include "podder.hpp"
+
+namespace pdr {
+
+namespace detail {
+// the index of the highest set bit, w != 0.
+[[nodiscard]] inline unsigned floor_log2 ( std::uint64_t const w ) noexcept {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+    unsigned long i;
+    _BitScanReverse64 ( &i, w );
+    return static_cast<unsigned> ( i );
+#else
+    return 63u - static_cast<unsigned> ( __builtin_clzll ( w ) );
+#endif
+}
+[[nodiscard]] constexpr unsigned floor_log2_constexpr ( std::uint64_t const w ) noexcept {
+    return w > 1u ? 1u + floor_log2_constexpr ( w >> 1 ) : 0u;
+}
+} // namespace detail
+
+// An append-only sequence in geometrically sized segments, segment k holds FirstSize * 2^k values, i.e. value i lives
+// in segment floor_log2 ( i + FirstSize ) - log2 ( FirstSize ), one bit-scan away. Segments are allocated as the
+// sequence grows and are never relocated, so emplace_back never copies existing values, references stay valid, and
+// growing takes no more than the new segment on top of what's there (as against up to 2.5 times the size for a
+// realloc that has to move). The segments can go out as an iovec list, or be flattened into a podder.
+template<typename Type, typename SizeType = std::size_t, std::size_t FirstSize = 16u>
+class segmented_podder {
+
+    static_assert ( std::is_trivially_copyable<Type>::value, "Type must be trivially copyable!" );
+    static_assert ( FirstSize and not( FirstSize & ( FirstSize - 1u ) ), "FirstSize must be a power of 2!" );
+
+    public:
+    using value_type      = Type;
+    using size_type       = SizeType;
+    using pointer         = value_type *;
+    using const_pointer   = value_type const *;
+    using reference       = value_type &;
+    using const_reference = value_type const &;
+    using podder_type     = podder<Type, SizeType>;
+
+    static constexpr unsigned first_log2       = detail::floor_log2_constexpr ( FirstSize );
+    static constexpr std::size_t max_segments = 64u - first_log2;
+
+    private:
+    std::array<pointer, max_segments> segments{ };
+    unsigned allocated = 0; // segments [ 0, allocated ) are allocated.
+    size_type n        = 0;
+    pointer tail = nullptr, limit = nullptr; // the next value goes at tail, limit is the end of its segment.
+
+    [[nodiscard]] static constexpr std::size_t segment_size ( unsigned const k ) noexcept { return FirstSize << k; }
+    [[nodiscard]] static constexpr std::size_t segment_begin ( unsigned const k ) noexcept {
+        return ( FirstSize << k ) - FirstSize; // the index of its first value.
+    }
+
+    // the segment and the offset in it of value i.
+    [[nodiscard]] static std::pair<unsigned, std::size_t> locate ( std::size_t const i ) noexcept {
+        unsigned const k = detail::floor_log2 ( i + FirstSize ) - first_log2;
+        return { k, i - segment_begin ( k ) };
+    }
+
+    // tail and limit for value n (or the end of the last allocated segment, if n lies past it).
+    void seek ( ) noexcept {
+        auto const [ k, o ] = locate ( n );
+        if ( k < allocated ) {
+            tail  = segments[ k ] + o;
+            limit = segments[ k ] + segment_size ( k );
+        }
+        else {
+            tail = limit = nullptr;
+        }
+    }
+
+    void allocate ( unsigned const k ) noexcept {
+        assert ( k == allocated and k < max_segments );
+        segments[ k ] = static_cast<pointer> ( pdr::malloc ( segment_size ( k ) * sizeof ( value_type ) ) );
+        ++allocated;
+    }
+
+    // the value at n goes into a new segment.
+    void next_segment ( ) noexcept {
+        unsigned const k = locate ( n ).first;
+        if ( k == allocated )
+            allocate ( k );
+        tail  = segments[ k ];
+        limit = tail + segment_size ( k );
+    }
+
+    public:
+    segmented_podder ( ) noexcept = default;
+    segmented_podder ( segmented_podder const & s ) noexcept {
+        reserve ( s.n );
+        s.for_each_segment ( [ this ] ( const_pointer const p, size_type const m ) {
+            std::memcpy ( ( void * ) segments[ locate ( n ).first ], ( void * ) p, m * sizeof ( value_type ) );
+            n += m;
+        } );
+        seek ( );
+    }
+    segmented_podder ( segmented_podder && s ) noexcept :
+        segments ( std::exchange ( s.segments, { } ) ), allocated ( std::exchange ( s.allocated, 0u ) ),
+        n ( std::exchange ( s.n, 0 ) ), tail ( std::exchange ( s.tail, nullptr ) ), limit ( std::exchange ( s.limit, nullptr ) ) {}
+    ~segmented_podder ( ) noexcept {
+        for ( unsigned k = 0; k < allocated; ++k )
+            pdr::free ( segments[ k ] );
+    }
+
+    segmented_podder & operator= ( segmented_podder const & s ) noexcept {
+        if ( this != &s ) {
+            segmented_podder t ( s );
+            swap ( t );
+        }
+        return *this;
+    }
+    segmented_podder & operator= ( segmented_podder && s ) noexcept {
+        segmented_podder t ( std::move ( s ) );
+        swap ( t );
+        return *this;
+    }
+
+    void swap ( segmented_podder & s ) noexcept {
+        std::swap ( segments, s.segments );
+        std::swap ( allocated, s.allocated );
+        std::swap ( n, s.n );
+        std::swap ( tail, s.tail );
+        std::swap ( limit, s.limit );
+    }
+
+    // size/capacity.
+
+    [[nodiscard]] size_type size ( ) const noexcept { return n; }
+    [[nodiscard]] bool empty ( ) const noexcept { return not n; }
+    [[nodiscard]] size_type capacity ( ) const noexcept { return static_cast<size_type> ( segment_begin ( allocated ) ); }
+    [[nodiscard]] unsigned segment_count ( ) const noexcept { return n ? locate ( n - 1 ).first + 1u : 0u; }
+
+    void reserve ( size_type const count ) noexcept {
+        while ( capacity ( ) < count )
+            allocate ( allocated );
+        seek ( );
+    }
+    // frees the segments past the one holding the last value.
+    void shrink_to_fit ( ) noexcept {
+        unsigned const keep = segment_count ( );
+        while ( allocated > keep )
+            pdr::free ( segments[ --allocated ] );
+        seek ( );
+    }
+    // keeps the segments.
+    void clear ( ) noexcept {
+        n = 0;
+        seek ( );
+    }
+
+    // element access, O ( 1 ).
+
+    [[nodiscard]] reference operator[] ( size_type const i ) noexcept {
+        assert ( i < n );
+        auto const [ k, o ] = locate ( i );
+        return segments[ k ][ o ];
+    }
+    [[nodiscard]] const_reference operator[] ( size_type const i ) const noexcept {
+        return const_cast<segmented_podder *> ( this )->operator[] ( i );
+    }
+    [[nodiscard]] reference front ( ) noexcept { return ( *this )[ 0 ]; }
+    [[nodiscard]] const_reference front ( ) const noexcept { return ( *this )[ 0 ]; }
+    [[nodiscard]] reference back ( ) noexcept { return ( *this )[ n - 1 ]; }
+    [[nodiscard]] const_reference back ( ) const noexcept { return ( *this )[ n - 1 ]; }
+
+    // modifiers, existing values never move.
+
+    template<typename... Args>
+    reference emplace_back ( Args &&... args ) noexcept {
+        if ( tail == limit ) {
+            value_type const v{ std::forward<Args> ( args )... }; // args might refer into the last segment.
+            next_segment ( );
+            ++n;
+            return *new ( tail++ ) value_type{ v };
+        }
+        ++n;
+        return *new ( tail++ ) value_type{ std::forward<Args> ( args )... };
+    }
+    void push_back ( const_reference value ) noexcept { emplace_back ( value ); }
+
+    void pop_back ( ) noexcept {
+        assert ( n );
+        --n;
+        seek ( ); // only the first value of a segment needs it, but it's cheap.
+    }
+
+    // the segments in use, in order, f ( const_pointer values, size_type count ).
+
+    template<typename Function>
+    void for_each_segment ( Function f ) const {
+        std::size_t left = n;
+        for ( unsigned k = 0; left; ++k ) {
+            std::size_t const m = std::min ( left, segment_size ( k ) );
+            f ( const_cast<const_pointer> ( segments[ k ] ), static_cast<size_type> ( m ) );
+            left -= m;
+        }
+    }
+
+#if defined( __unix__ ) or defined( __APPLE__ )
+    // the segments in use, for writev ( ) and friends.
+    [[nodiscard]] podder<::iovec> iovecs ( ) const noexcept {
+        podder<::iovec> v;
+        for_each_segment ( [ &v ] ( const_pointer const p, size_type const m ) {
+            v.push_back ( ::iovec{ const_cast<pointer> ( p ), m * sizeof ( value_type ) } );
+        } );
+        return v;
+    }
+#endif
+
+    // a contiguous copy.
+    [[nodiscard]] podder_type flatten ( ) const noexcept {
+        podder_type p;
+        p.resize_reserve_only ( n );
+        pointer d = p.data ( );
+        for_each_segment ( [ &d ] ( const_pointer const v, size_type const m ) {
+            std::memcpy ( ( void * ) d, ( void * ) v, m * sizeof ( value_type ) );
+            d += m;
+        } );
+        return p;
+    }
+};
+
+} // namespace pdr
@@ -0,0 +1,221 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "podder.hpp"
+#include "span.hpp"
+
+namespace pdr {
+
+// A structure of arrays, the columns Ts... share one allocation, one size and one capacity, i.e. appending a record
+// takes one growth decision and (at most) one realloc. Column I lives at offset ( I, capacity ) in the block, each
+// column starts on a 64 byte boundary (relative to the block), so column scans vectorize.
+template<typename SizeType, typename GrowthPolicy, typename... Ts>
+class basic_soa_podder {
+
+    static_assert ( sizeof...( Ts ) > 0u, "A soa_podder needs at least one column!" );
+    static_assert ( std::conjunction<std::is_trivially_copyable<Ts>...>::value, "The Ts must be trivially copyable!" );
+    static_assert ( std::conjunction<std::bool_constant<( alignof ( Ts ) <= alignof ( std::max_align_t ) )>...>::value,
+                    "The Ts can't be over-aligned (the block comes from malloc)!" );
+
+    public:
+    using size_type     = SizeType;
+    using growth_policy = GrowthPolicy;
+    using value_type    = std::tuple<Ts...>;
+    using reference     = std::tuple<Ts &...>;
+
+    template<std::size_t I>
+    using column_type = std::tuple_element_t<I, value_type>;
+
+    static constexpr std::size_t columns   = sizeof...( Ts );
+    static constexpr std::size_t alignment = 64u;
+
+    private:
+    static constexpr std::array<std::size_t, columns> sizes{ sizeof ( Ts )... };
+
+    char * block = nullptr;
+    size_type n  = 0;
+    size_type c  = 0;
+
+    [[nodiscard]] static constexpr std::size_t align ( std::size_t const o ) noexcept {
+        return ( o + ( alignment - 1u ) ) & ~( alignment - 1u );
+    }
+    [[nodiscard]] static constexpr std::size_t offset ( std::size_t const column, std::size_t const capacity ) noexcept {
+        std::size_t o = 0;
+        for ( std::size_t i = 0; i < column; ++i )
+            o = align ( o + capacity * sizes[ i ] );
+        return o;
+    }
+    [[nodiscard]] static constexpr std::size_t bytes ( std::size_t const capacity ) noexcept {
+        return offset ( columns - 1u, capacity ) + capacity * sizes[ columns - 1u ];
+    }
+
+    // moves the columns to the layout of capacity c1, in place (the columns move up on growth, down on shrinking).
+    void relocate ( size_type const c1 ) noexcept {
+        if ( c1 > c ) {
+            block = static_cast<char *> ( pdr::realloc ( block, bytes ( c1 ) ) );
+            for ( std::size_t i = columns - 1u; i; --i )
+                std::memmove ( block + offset ( i, c1 ), block + offset ( i, c ), n * sizes[ i ] );
+        }
+        else if ( c1 ) {
+            for ( std::size_t i = 1u; i < columns; ++i )
+                std::memmove ( block + offset ( i, c1 ), block + offset ( i, c ), n * sizes[ i ] );
+            block = static_cast<char *> ( pdr::realloc ( block, bytes ( c1 ) ) );
+        }
+        else {
+            pdr::free ( block );
+            block = nullptr;
+        }
+        c = c1;
+    }
+
+    template<std::size_t... I>
+    void put ( size_type const i, std::index_sequence<I...>, Ts const &... values ) noexcept {
+        ( ( column<I> ( )[ i ] = values ), ... );
+    }
+
+    template<std::size_t... I>
+    [[nodiscard]] reference get ( size_type const i, std::index_sequence<I...> ) noexcept {
+        return reference{ column<I> ( )[ i ]... };
+    }
+
+    public:
+    basic_soa_podder ( ) noexcept = default;
+    explicit basic_soa_podder ( size_type const count ) noexcept { resize ( count ); }
+    basic_soa_podder ( basic_soa_podder const & s ) noexcept : n ( s.n ), c ( s.n ) {
+        if ( c ) {
+            block = static_cast<char *> ( pdr::malloc ( bytes ( c ) ) );
+            for ( std::size_t i = 0; i < columns; ++i )
+                std::memcpy ( block + offset ( i, c ), s.block + offset ( i, s.c ), n * sizes[ i ] );
+        }
+    }
+    basic_soa_podder ( basic_soa_podder && s ) noexcept :
+        block ( std::exchange ( s.block, nullptr ) ), n ( std::exchange ( s.n, 0 ) ), c ( std::exchange ( s.c, 0 ) ) {}
+    ~basic_soa_podder ( ) noexcept { pdr::free ( block ); }
+
+    basic_soa_podder & operator= ( basic_soa_podder const & s ) noexcept {
+        if ( this != &s ) {
+            basic_soa_podder t ( s );
+            swap ( t );
+        }
+        return *this;
+    }
+    basic_soa_podder & operator= ( basic_soa_podder && s ) noexcept {
+        basic_soa_podder t ( std::move ( s ) );
+        swap ( t );
+        return *this;
+    }
+
+    void swap ( basic_soa_podder & s ) noexcept {
+        std::swap ( block, s.block );
+        std::swap ( n, s.n );
+        std::swap ( c, s.c );
+    }
+
+    // size/capacity.
+
+    [[nodiscard]] size_type size ( ) const noexcept { return n; }
+    [[nodiscard]] size_type capacity ( ) const noexcept { return c; }
+    [[nodiscard]] bool empty ( ) const noexcept { return not n; }
+    [[nodiscard]] std::size_t capacity_in_bytes ( ) const noexcept { return c ? bytes ( c ) : 0u; }
+
+    void reserve ( size_type const count ) noexcept {
+        if ( count > c )
+            relocate ( count );
+    }
+    void shrink_to_fit ( ) noexcept {
+        if ( n < c )
+            relocate ( n );
+    }
+    // new records are value-initialized.
+    void resize ( size_type const count ) noexcept {
+        if ( count > c )
+            relocate ( count );
+        if ( count > n )
+            for ( std::size_t i = 0; i < columns; ++i )
+                std::memset ( block + offset ( i, c ) + n * sizes[ i ], 0, ( count - n ) * sizes[ i ] );
+        n = count;
+    }
+    void clear ( ) noexcept { n = 0; }
+
+    // records.
+
+    void emplace_back ( Ts const &... values ) noexcept {
+        if ( n == c ) // the one growth decision.
+            relocate ( static_cast<size_type> ( growth_policy::grow_capacity_from ( c ) ) );
+        put ( n++, std::index_sequence_for<Ts...>{ }, values... );
+    }
+    void push_back ( value_type const & record ) noexcept {
+        std::apply ( [ this ] ( Ts const &... values ) { emplace_back ( values... ); }, record );
+    }
+    void pop_back ( ) noexcept {
+        assert ( n );
+        --n;
+    }
+
+    // moves the last record to i, O ( 1 ).
+    void unordered_erase ( size_type const i ) noexcept {
+        assert ( i < n );
+        --n;
+        for ( std::size_t j = 0; j < columns; ++j )
+            std::memcpy ( block + offset ( j, c ) + i * sizes[ j ], block + offset ( j, c ) + n * sizes[ j ], sizes[ j ] );
+    }
+
+    // a tuple of references to the record at i.
+    [[nodiscard]] reference operator[] ( size_type const i ) noexcept {
+        assert ( i < n );
+        return get ( i, std::index_sequence_for<Ts...>{ } );
+    }
+    [[nodiscard]] value_type operator[] ( size_type const i ) const noexcept {
+        assert ( i < n );
+        return const_cast<basic_soa_podder *> ( this )->get ( i, std::index_sequence_for<Ts...>{ } );
+    }
+
+    // columns.
+
+    template<std::size_t I>
+    [[nodiscard]] span<column_type<I>> column ( ) noexcept {
+        return { reinterpret_cast<column_type<I> *> ( block + offset ( I, c ) ), n };
+    }
+    template<std::size_t I>
+    [[nodiscard]] span<column_type<I> const> column ( ) const noexcept {
+        return { reinterpret_cast<column_type<I> const *> ( block + offset ( I, c ) ), n };
+    }
+};
+
+template<typename... Ts>
+using soa_podder = basic_soa_podder<std::size_t, visual_studio_growth_policy<std::size_t>, Ts...>;
+
+} // namespace pdr
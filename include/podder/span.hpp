@@ -0,0 +1,68 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+namespace pdr {
+
+// a (non-owning) view on a contiguous sequence, the part of C++20's std::span the containers need.
+template<typename Type>
+class span {
+    Type * p      = nullptr;
+    std::size_t n = 0;
+
+    public:
+    using element_type = Type;
+    using pointer      = Type *;
+    using reference    = Type &;
+    using iterator     = Type *;
+    using size_type    = std::size_t;
+
+    constexpr span ( ) noexcept = default;
+    constexpr span ( pointer p_, size_type const n_ ) noexcept : p ( p_ ), n ( n_ ) {}
+    template<typename Other> // span<T> -> span<T const>.
+    constexpr span ( span<Other> const & s ) noexcept : p ( s.data ( ) ), n ( s.size ( ) ) {}
+
+    [[nodiscard]] constexpr pointer data ( ) const noexcept { return p; }
+    [[nodiscard]] constexpr size_type size ( ) const noexcept { return n; }
+    [[nodiscard]] constexpr size_type size_bytes ( ) const noexcept { return n * sizeof ( Type ); }
+    [[nodiscard]] constexpr bool empty ( ) const noexcept { return not n; }
+    [[nodiscard]] constexpr iterator begin ( ) const noexcept { return p; }
+    [[nodiscard]] constexpr iterator end ( ) const noexcept { return p + n; }
+    [[nodiscard]] constexpr reference operator[] ( size_type const i ) const noexcept {
+        assert ( i < n );
+        return p[ i ];
+    }
+    [[nodiscard]] constexpr reference front ( ) const noexcept { return p[ 0 ]; }
+    [[nodiscard]] constexpr reference back ( ) const noexcept { return p[ n - 1u ]; }
+    [[nodiscard]] constexpr span subspan ( size_type const offset, size_type const count ) const noexcept {
+        assert ( offset + count <= n );
+        return { p + offset, count };
+    }
+};
+
+} // namespace pdr
@@ -0,0 +1,164 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+
+// costumization point, define PODDER_STATS true (before including podder.hpp) to
+// collect (thread-local) allocation and growth statistics. When false (the default)
+// all hooks are empty and the whole thing costs nothing.
+#ifndef PODDER_STATS
+#    define PODDER_STATS false
+#endif
+
+namespace pdr::stats {
+
+[[nodiscard]] constexpr bool enabled ( ) noexcept { return PODDER_STATS; }
+
+// raw counters, per thread.
+struct counters {
+    std::uint64_t mallocs     = 0; // including zalloc/calloc and realloc's of nullptr.
+    std::uint64_t reallocs    = 0;
+    std::uint64_t relocations = 0; // reallocs that returned a different block.
+    std::uint64_t frees       = 0;
+    std::uint64_t spills      = 0; // small -> medium transitions.
+    std::uint64_t bytes_moved = 0; // copied by relocations and spills.
+
+    std::uint64_t peak_capacity = 0; // largest block requested, in bytes.
+
+    std::uint64_t small_exits   = 0; // non-empty podders destroyed while small.
+    std::uint64_t medium_exits  = 0; // allocated podders destroyed while medium.
+    std::uint64_t exit_size     = 0; // in bytes, summed over medium_exits.
+    std::uint64_t exit_capacity = 0; // in bytes, summed over medium_exits.
+};
+
+// derived figures.
+struct report {
+    // fraction of (non-empty or allocated) podders that were small when destroyed, i.e. not of the podders that
+    // never spilled: one that spilled and went back into the svo buffer (a copy, skrink_to_fit) counts as small.
+    double svo_hit_rate = 0.0;
+    std::uint64_t spills = 0, mallocs = 0, reallocs = 0, relocations = 0, frees = 0;
+    std::uint64_t bytes_moved   = 0;
+    std::uint64_t peak_capacity = 0;
+    double slack                = 0.0; // fraction of capacity unused, at destruction of medium podders.
+};
+
+#if PODDER_STATS
+namespace detail {
+inline thread_local counters local;
+} // namespace detail
+#endif
+
+// the counters of the calling thread.
+[[nodiscard]] inline counters get ( ) noexcept {
+#if PODDER_STATS
+    return detail::local;
+#else
+    return counters{};
+#endif
+}
+
+inline void reset ( ) noexcept {
+#if PODDER_STATS
+    detail::local = counters{};
+#endif
+}
+
+[[nodiscard]] inline report snapshot ( ) noexcept {
+    counters const c = get ( );
+    report r;
+    std::uint64_t const exits = c.small_exits + c.medium_exits;
+    r.svo_hit_rate            = exits ? static_cast<double> ( c.small_exits ) / static_cast<double> ( exits ) : 0.0;
+    r.spills                  = c.spills;
+    r.mallocs                 = c.mallocs;
+    r.reallocs                = c.reallocs;
+    r.relocations             = c.relocations;
+    r.frees                   = c.frees;
+    r.bytes_moved             = c.bytes_moved;
+    r.peak_capacity           = c.peak_capacity;
+    r.slack                   = c.exit_capacity ? static_cast<double> ( c.exit_capacity - c.exit_size ) /
+                                        static_cast<double> ( c.exit_capacity )
+                                  : 0.0;
+    return r;
+}
+
+// hooks, called by pdr::malloc and friends, and by podder.
+
+inline void on_malloc ( [[maybe_unused]] std::size_t const size ) noexcept {
+#if PODDER_STATS
+    ++detail::local.mallocs;
+    detail::local.peak_capacity = std::max ( detail::local.peak_capacity, static_cast<std::uint64_t> ( size ) );
+#endif
+}
+
+// moved is the number of bytes the allocator copies in case the block gets relocated.
+inline void on_realloc ( [[maybe_unused]] void const * old_ptr, [[maybe_unused]] void const * new_ptr,
+                         [[maybe_unused]] std::size_t const moved, [[maybe_unused]] std::size_t const size ) noexcept {
+#if PODDER_STATS
+    if ( not old_ptr ) {
+        on_malloc ( size );
+        return;
+    }
+    ++detail::local.reallocs;
+    if ( old_ptr != new_ptr ) {
+        ++detail::local.relocations;
+        detail::local.bytes_moved += moved;
+    }
+    detail::local.peak_capacity = std::max ( detail::local.peak_capacity, static_cast<std::uint64_t> ( size ) );
+#endif
+}
+
+inline void on_free ( [[maybe_unused]] void const * ptr ) noexcept {
+#if PODDER_STATS
+    if ( ptr )
+        ++detail::local.frees;
+#endif
+}
+
+inline void on_spill ( [[maybe_unused]] std::size_t const moved ) noexcept {
+#if PODDER_STATS
+    ++detail::local.spills;
+    detail::local.bytes_moved += moved;
+#endif
+}
+
+inline void on_destroy ( [[maybe_unused]] bool const is_small, [[maybe_unused]] std::size_t const size,
+                         [[maybe_unused]] std::size_t const capacity ) noexcept {
+#if PODDER_STATS
+    if ( is_small ) {
+        if ( size )
+            ++detail::local.small_exits;
+    }
+    else if ( capacity ) {
+        ++detail::local.medium_exits;
+        detail::local.exit_size += size;
+        detail::local.exit_capacity += capacity;
+    }
+#endif
+}
+
+} // namespace pdr::stats
@@ -23,10 +23,11 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstdint>
 
 #include <limits>
-#include <sax/iostream.hpp>
+#include <type_traits>
 
 template<typename ValueType>
 struct tagged_pointer {
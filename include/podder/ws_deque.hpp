@@ -0,0 +1,181 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <limits>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+#include "podder.hpp"
+#include "ring.hpp" // cache_line_size.
+
+namespace pdr {
+
+// A Chase-Lev work-stealing deque (following "Correct and Efficient Work-Stealing for Weak Memory Models",
+// Lê, Pop, Cohen and Zappa Nardelli, 2013). The owner pushes and pops at the bottom, lock-free (wait-free but for
+// the last value), any thread can steal from the top with a CAS. The values live in a power-of-two circular array,
+// which grows (doubles) when full, the old arrays are retired, and reclaimed when the deque is destroyed (thieves
+// might still be reading from them).
+template<typename Type, typename SizeType = std::size_t>
+class ws_deque {
+
+    static_assert ( std::is_trivially_copyable<Type>::value, "Type must be trivially copyable!" );
+    static_assert ( std::atomic<Type>::is_always_lock_free, "Type must fit a lock-free std::atomic!" );
+    static_assert ( std::is_unsigned<SizeType>::value and std::numeric_limits<SizeType>::digits >= 32,
+                    "SizeType must be an unsigned 32- or 64-bit integer type!" );
+
+    public:
+    using value_type          = Type;
+    using optional_value_type = std::optional<value_type>;
+    using const_reference     = value_type const &;
+    using size_type           = SizeType;
+    using signed_size_type    = typename std::make_signed<size_type>::type;
+
+    private:
+    struct array {
+        signed_size_type mask;
+
+        [[nodiscard]] std::atomic<value_type> * values ( ) noexcept { return reinterpret_cast<std::atomic<value_type> *> ( this + 1 ); }
+        [[nodiscard]] signed_size_type capacity ( ) const noexcept { return mask + 1; }
+
+        [[nodiscard]] value_type get ( signed_size_type const i ) noexcept {
+            return values ( )[ i & mask ].load ( std::memory_order_relaxed );
+        }
+        void put ( signed_size_type const i, const_reference value ) noexcept {
+            values ( )[ i & mask ].store ( value, std::memory_order_relaxed );
+        }
+
+        [[nodiscard]] static array * make ( signed_size_type const capacity_ ) noexcept {
+            array * const a = new ( pdr::malloc ( sizeof ( array ) + capacity_ * sizeof ( std::atomic<value_type> ) ) ) array{ capacity_ - 1 };
+            for ( signed_size_type i = 0; i < capacity_; ++i )
+                new ( a->values ( ) + i ) std::atomic<value_type>;
+            return a;
+        }
+    };
+
+    static_assert ( sizeof ( array ) % alignof ( std::atomic<value_type> ) == 0 );
+
+    public:
+    // capacity is rounded up to a power of two.
+    explicit ws_deque ( size_type const capacity_ = 64u ) noexcept {
+        signed_size_type c = 2;
+        while ( c < static_cast<signed_size_type> ( capacity_ ) )
+            c <<= 1;
+        data.store ( array::make ( c ), std::memory_order_relaxed );
+    }
+
+    ws_deque ( ws_deque const & ) = delete;
+    ws_deque ( ws_deque && )      = delete;
+    ws_deque & operator= ( ws_deque const & ) = delete;
+    ws_deque & operator= ( ws_deque && ) = delete;
+
+    ~ws_deque ( ) noexcept {
+        pdr::free ( data.load ( std::memory_order_relaxed ) );
+        for ( array * a : retired )
+            pdr::free ( a );
+    }
+
+    // the owner.
+
+    void push ( const_reference value ) noexcept {
+        signed_size_type const b = bottom.load ( std::memory_order_relaxed );
+        signed_size_type const t = top.load ( std::memory_order_acquire );
+        array * a                = data.load ( std::memory_order_relaxed );
+        if ( b - t > a->mask )
+            a = grow ( a, t, b );
+        a->put ( b, value );
+        std::atomic_thread_fence ( std::memory_order_release );
+        bottom.store ( b + 1, std::memory_order_relaxed );
+    }
+
+    [[nodiscard]] optional_value_type pop ( ) noexcept {
+        signed_size_type const b = bottom.load ( std::memory_order_relaxed ) - 1;
+        array * const a          = data.load ( std::memory_order_relaxed );
+        bottom.store ( b, std::memory_order_relaxed );
+        std::atomic_thread_fence ( std::memory_order_seq_cst );
+        signed_size_type t = top.load ( std::memory_order_relaxed );
+        if ( t > b ) { // empty.
+            bottom.store ( b + 1, std::memory_order_relaxed );
+            return optional_value_type{};
+        }
+        value_type const value = a->get ( b );
+        if ( t == b ) { // the last value, race the thieves for it.
+            bool const won = top.compare_exchange_strong ( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+            bottom.store ( b + 1, std::memory_order_relaxed );
+            if ( not won )
+                return optional_value_type{};
+        }
+        return optional_value_type{ value };
+    }
+
+    // the thieves (and the owner).
+
+    // an empty optional when the deque is empty, or when another thief (or the owner) won the race for the top value.
+    [[nodiscard]] optional_value_type steal ( ) noexcept {
+        signed_size_type t = top.load ( std::memory_order_acquire );
+        std::atomic_thread_fence ( std::memory_order_seq_cst );
+        signed_size_type const b = bottom.load ( std::memory_order_acquire );
+        if ( t >= b )
+            return optional_value_type{};
+        value_type const value = data.load ( std::memory_order_acquire )->get ( t );
+        if ( not top.compare_exchange_strong ( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+            return optional_value_type{};
+        return optional_value_type{ value };
+    }
+
+    // observers, approximate while other threads push, pop or steal.
+
+    [[nodiscard]] size_type size ( ) const noexcept {
+        signed_size_type const b = bottom.load ( std::memory_order_relaxed ), t = top.load ( std::memory_order_relaxed );
+        return b > t ? static_cast<size_type> ( b - t ) : size_type{ 0 };
+    }
+    [[nodiscard]] bool empty ( ) const noexcept { return not size ( ); }
+    [[nodiscard]] size_type capacity ( ) const noexcept {
+        return static_cast<size_type> ( data.load ( std::memory_order_relaxed )->capacity ( ) );
+    }
+
+    private:
+    // doubles the array (owner only), the old one is retired, thieves might still be reading from it.
+    [[nodiscard]] array * grow ( array * const a, signed_size_type const t, signed_size_type const b ) noexcept {
+        array * const n = array::make ( 2 * a->capacity ( ) );
+        for ( signed_size_type i = t; i < b; ++i )
+            n->put ( i, a->get ( i ) );
+        retired.push_back ( a );
+        data.store ( n, std::memory_order_release );
+        return n;
+    }
+
+    alignas ( cache_line_size ) std::atomic<signed_size_type> top{ 0 };
+    alignas ( cache_line_size ) std::atomic<signed_size_type> bottom{ 0 };
+    std::atomic<array *> data{ nullptr };
+    podder<array *> retired; // owner only.
+};
+
+} // namespace pdr
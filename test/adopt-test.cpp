@@ -0,0 +1,166 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+
+// adopt and release against std::vector contents, medium blocks change hands without a copy (same data ( )), small
+// ones are copied. Leaks (a block not freed, or freed twice) show up under the address sanitizer.
+
+struct quad { // too big for an svo buffer, i.e. a no_svo podder.
+    std::uint64_t v[ 4 ];
+    [[nodiscard]] bool operator== ( quad const & o ) const noexcept { return std::equal ( v, v + 4, o.v ); }
+};
+
+template<typename Type>
+Type make ( std::uint64_t const i ) {
+    if constexpr ( std::is_same<Type, quad>::value )
+        return quad{ { i, i + 1u, i + 2u, i + 3u } };
+    else
+        return static_cast<Type> ( i );
+}
+
+template<typename Podder>
+bool same ( Podder const & p, std::vector<typename Podder::value_type> const & v ) {
+    return p.size ( ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+}
+
+template<typename Podder>
+bool same ( pdr::buffer<typename Podder::value_type> const & b, std::vector<typename Podder::value_type> const & v ) {
+    return b.size == v.size ( ) and b.size <= b.capacity and ( not b.size or std::equal ( v.begin ( ), v.end ( ), b.data ) );
+}
+
+template<typename Podder>
+bool release_adopt_test ( ) {
+    using value_type = typename Podder::value_type;
+    using size_type  = typename Podder::size_type;
+    bool ok          = true;
+    for ( std::size_t size : { 0u, 1u, 3u, 100u, 1'000u } ) {
+        std::vector<value_type> v;
+        Podder p;
+        for ( std::size_t i = 0; i < size; ++i )
+            v.push_back ( make<value_type> ( i ) ), p.push_back ( make<value_type> ( i ) );
+        bool const medium               = p.holds_block ( );
+        value_type const * const data   = p.data ( );
+        size_type const capacity        = p.capacity ( );
+        pdr::buffer<value_type> const b = p.release ( );
+        ok = ok and p.empty ( ) and not p.holds_block ( ) and same<Podder> ( b, v ) and ( not size ) == ( b.data == nullptr );
+        ok = ok and ( not medium or ( b.data == data and b.capacity == capacity ) );
+        p.push_back ( make<value_type> ( 7u ) ); // usable after release.
+        Podder q ( 5, make<value_type> ( 1u ) ); // adopt frees q's own block (if any).
+        q.adopt ( b );
+        ok = ok and same ( q, v ) and ( not medium or q.data ( ) == data );
+        q.push_back ( make<value_type> ( 9u ) ); // and grows from the adopted capacity.
+        v.push_back ( make<value_type> ( 9u ) );
+        ok = ok and same ( q, v );
+    }
+    return ok;
+}
+
+// a block from pdr::malloc, filled elsewhere, adopted.
+bool adopt_malloc_test ( ) {
+    bool ok = true;
+    for ( std::size_t size : { 0u, 2u, 50u } ) {
+        std::uint32_t * const p = static_cast<std::uint32_t *> ( pdr::malloc ( 64u * sizeof ( std::uint32_t ) ) );
+        std::vector<std::uint32_t> v ( size );
+        for ( std::size_t i = 0; i < size; ++i )
+            p[ i ] = v[ i ] = static_cast<std::uint32_t> ( i * i );
+        podder<std::uint32_t> q;
+        q.adopt ( p, size, 64u );
+        ok = ok and same ( q, v ) and ( size <= q.svo_capacity ( ) or ( q.data ( ) == p and q.capacity ( ) == 64u ) );
+    }
+    return ok;
+}
+
+// the offset mode (after pop_front's) releases the values from the start of the block.
+bool release_offset_test ( ) {
+    podder<std::uint16_t> p;
+    std::vector<std::uint16_t> v;
+    for ( std::uint16_t i = 0; i < 500u; ++i )
+        p.push_back ( i ), v.push_back ( i );
+    for ( int i = 0; i < 100; ++i )
+        p.pop_front ( ), v.erase ( v.begin ( ) );
+    pdr::buffer<std::uint16_t> const b = p.release ( );
+    bool const ok                      = same<podder<std::uint16_t>> ( b, v );
+    podder<std::uint16_t> q;
+    q.adopt ( b );
+    return ok and same ( q, v );
+}
+
+// conversions between podders of other size types, O ( 1 ) for medium podders.
+bool conversion_test ( ) {
+    podder<std::uint64_t> p;
+    std::vector<std::uint64_t> v;
+    for ( std::uint64_t i = 0; i < 300u; ++i )
+        p.push_back ( i * 7u ), v.push_back ( i * 7u );
+    std::uint64_t const * const data = p.data ( );
+    podder<std::uint64_t, std::uint32_t> q ( std::move ( p ) );
+    bool ok = p.empty ( ) and same ( q, v ) and q.data ( ) == data;
+    podder<std::uint64_t> r{ 1u, 2u };
+    podder<std::uint64_t, std::uint32_t> s ( std::move ( r ) ); // small, copied.
+    ok = ok and r.empty ( ) and same ( s, { 1u, 2u } );
+    podder<std::uint64_t, std::size_t, visual_studio_growth_policy<std::size_t>, 64u> t; // aligned, copied.
+    t = std::move ( q );
+    return ok and q.empty ( ) and same ( t, v ) and not( reinterpret_cast<std::uintptr_t> ( t.data ( ) ) % 64u );
+}
+
+// aligned podders hand out aligned blocks (free them with pdr::aligned_free).
+bool aligned_release_test ( ) {
+    using aligned_podder = podder<double, std::size_t, visual_studio_growth_policy<std::size_t>, 64u>;
+    aligned_podder p ( 1'000, 0.5 );
+    pdr::buffer<double> const b = p.release ( );
+    bool const ok = b.size == 1'000u and not( reinterpret_cast<std::uintptr_t> ( b.data ) % 64u ) and b.data[ 999 ] == 0.5;
+    aligned_podder q;
+    q.adopt ( b );
+    pdr::buffer<double> const c = q.release ( );
+    pdr::aligned_free ( c.data );
+    return ok and c.data == b.data and q.empty ( );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = release_adopt_test<podder<std::uint8_t>> ( ) and ok;
+    ok      = release_adopt_test<podder<std::uint32_t>> ( ) and ok;
+    ok      = release_adopt_test<podder<std::uint32_t, std::uint32_t>> ( ) and ok;
+    ok      = release_adopt_test<podder<quad>> ( ) and ok;
+    ok      = adopt_malloc_test ( ) and ok;
+    ok      = release_offset_test ( ) and ok;
+    ok      = conversion_test ( ) and ok;
+    ok      = aligned_release_test ( ) and ok;
+    std::printf ( "adopt: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,158 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+
+// aligned podders against std::vector, and data ( ) on the Alignment whenever there's a block (that's not in the
+// offset mode), over growth, realloc, reserve, shrink, copies, moves and the zeroing paths.
+
+struct quad { // too big for an svo buffer, i.e. a no_svo podder.
+    std::uint64_t v[ 4 ];
+    [[nodiscard]] bool operator== ( quad const & o ) const noexcept { return std::equal ( v, v + 4, o.v ); }
+    [[nodiscard]] bool operator!= ( quad const & o ) const noexcept { return not operator== ( o ); }
+};
+
+template<typename Type>
+Type make ( std::uint64_t const i ) {
+    if constexpr ( std::is_same<Type, quad>::value )
+        return quad{ { i, i + 1u, i + 2u, i + 3u } };
+    else
+        return static_cast<Type> ( i );
+}
+
+template<typename Podder, typename Type>
+bool same ( Podder const & p, std::vector<Type> const & v ) {
+    if ( p.size ( ) != v.size ( ) or not std::equal ( v.begin ( ), v.end ( ), p.begin ( ) ) )
+        return false;
+    if ( p.holds_block ( ) and not p.is_offset ( ) )
+        return reinterpret_cast<std::uintptr_t> ( p.data ( ) ) % Podder::alignment ( ) == 0u;
+    return true;
+}
+
+template<typename Type, std::size_t Alignment>
+bool alignment_random_test ( std::uint64_t const seed ) {
+    using podder_type = podder<Type, std::size_t, visual_studio_growth_policy<std::size_t>, Alignment>;
+    static_assert ( podder_type::alignment ( ) == Alignment );
+    std::mt19937_64 gen ( seed );
+    podder_type p;
+    std::vector<Type> v;
+    for ( int i = 0; i < 20'000; ++i ) {
+        std::size_t const n = gen ( ) % ( gen ( ) % 4u ? 100u : 20'000u );
+        Type const x        = make<Type> ( gen ( ) );
+        switch ( gen ( ) % 16u ) {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+                p.push_back ( x ), v.push_back ( x );
+                break;
+            case 4:
+                if ( v.size ( ) ) {
+                    std::size_t const at = gen ( ) % v.size ( );
+                    p.erase ( p.begin ( ) + at ), v.erase ( v.begin ( ) + at );
+                }
+                break;
+            case 5: {
+                std::vector<Type> values ( 1u + gen ( ) % 50u );
+                for ( Type & y : values )
+                    y = make<Type> ( gen ( ) );
+                std::size_t const at = gen ( ) % ( v.size ( ) + 1u );
+                p.insert ( p.begin ( ) + at, values.begin ( ), values.end ( ) );
+                v.insert ( v.begin ( ) + at, values.begin ( ), values.end ( ) );
+            } break;
+            case 6: // grows in place or reallocs.
+                p.resize ( n ), v.resize ( n );
+                break;
+            case 7:
+                p.reserve ( n );
+                if ( p.capacity ( ) < n )
+                    return false;
+                break;
+            case 8:
+                p.skrink_to_fit ( );
+                break;
+            case 9: { // copies, a new block.
+                podder_type const q = p;
+                if ( not same ( q, v ) )
+                    return false;
+                podder_type r;
+                r = q;
+                p = std::move ( r );
+            } break;
+            case 10: // fresh zeroed blocks.
+                if ( gen ( ) % 2u )
+                    p = podder_type ( n ), v.assign ( n, Type{ } );
+                else
+                    p.assign ( n, Type{ } ), v.assign ( n, Type{ } );
+                break;
+            case 11:
+                p.assign ( n, x ), v.assign ( n, x );
+                break;
+            case 12: // the offset mode, until the next relocation.
+                if ( v.size ( ) ) {
+                    p.pop_front ( ), v.erase ( v.begin ( ) );
+                }
+                break;
+            case 13: { // from and to an unaligned podder, the values are copied.
+                podder<Type> u ( p.data ( ), p.size ( ) );
+                p = podder_type ( std::move ( u ) );
+            } break;
+            case 14:
+                if ( gen ( ) % 32u == 0u )
+                    p.clear ( ), v.clear ( );
+                break;
+            default:
+                if ( v.size ( ) )
+                    p.pop_back ( ), v.pop_back ( );
+        }
+        if ( not same ( p, v ) )
+            return false;
+    }
+    return true;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = alignment_random_test<std::uint8_t, 32u> ( 1u ) and ok;
+    ok      = alignment_random_test<std::uint32_t, 64u> ( 2u ) and ok;
+    ok      = alignment_random_test<double, 128u> ( 3u ) and ok;
+    ok      = alignment_random_test<quad, 64u> ( 4u ) and ok;
+    ok      = alignment_random_test<std::uint16_t, 4'096u> ( 5u ) and ok;
+    std::printf ( "alignment: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
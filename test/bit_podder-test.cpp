@@ -0,0 +1,177 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <random>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/bit_podder.hpp"
+
+// bit_podder against std::vector<bool>, rank and select against counting loops.
+
+using bits_type = pdr::bit_podder<>;
+
+bool same ( bits_type const & b, std::vector<bool> const & v ) {
+    if ( b.size ( ) != v.size ( ) or b.size_in_bytes ( ) != ( v.size ( ) + 7u ) / 8u )
+        return false;
+    std::size_t count = 0;
+    for ( std::size_t i = 0; i < v.size ( ); ++i ) {
+        if ( b[ i ] != v[ i ] )
+            return false;
+        count += v[ i ];
+    }
+    // the bits past size ( ) are zero, i.e. the words hold exactly the set bits.
+    std::size_t words = 0;
+    for ( std::size_t w = 0; w < b.word_count ( ); ++w )
+        words += pdr::detail::popcount ( b.word ( w ) );
+    return b.count ( ) == count and words == count and b.any ( ) == ( count > 0u ) and b.none ( ) == not count and
+           b.all ( ) == ( count == v.size ( ) );
+}
+
+std::size_t reference_find_next ( std::vector<bool> const & v, std::size_t i ) {
+    for ( ; i < v.size ( ); ++i )
+        if ( v[ i ] )
+            return i;
+    return bits_type::npos;
+}
+
+bool bit_podder_random_test ( std::uint64_t const seed ) {
+    std::mt19937_64 gen ( seed );
+    bits_type b;
+    std::vector<bool> v;
+    for ( int i = 0; i < 20'000; ++i ) {
+        bool const x = gen ( ) % 2u;
+        switch ( gen ( ) % 10u ) {
+            case 0:
+            case 1: b.push_back ( x ), v.push_back ( x ); break;
+            case 2:
+                if ( v.size ( ) )
+                    b.pop_back ( ), v.pop_back ( );
+                break;
+            case 3: {
+                std::size_t const n = gen ( ) % 1'500u;
+                b.resize ( n, x ), v.resize ( n, x );
+            } break;
+            case 4:
+            case 5:
+                if ( v.size ( ) ) {
+                    std::size_t const j = gen ( ) % v.size ( );
+                    switch ( gen ( ) % 4u ) {
+                        case 0: b.set ( j ), v[ j ] = true; break;
+                        case 1: b.reset ( j ), v[ j ] = false; break;
+                        case 2: b.flip ( j ), v[ j ] = not v[ j ]; break;
+                        default: b.set ( j, x ), v[ j ] = x;
+                    }
+                }
+                break;
+            case 6:
+                switch ( gen ( ) % 8u ) {
+                    case 0: b.set ( ), v.assign ( v.size ( ), true ); break;
+                    case 1: b.reset ( ), v.assign ( v.size ( ), false ); break;
+                    case 2: b.flip ( ), v.flip ( ); break;
+                    case 3: b.clear ( ), v.clear ( ); break;
+                    default: break;
+                }
+                break;
+            default: {
+                std::size_t const j = gen ( ) % ( v.size ( ) + 2u );
+                if ( b.find_next ( j ) != reference_find_next ( v, j ) or b.find_first ( ) != reference_find_next ( v, 0u ) )
+                    return false;
+            }
+        }
+        if ( not same ( b, v ) )
+            return false;
+    }
+    return true;
+}
+
+bool bit_podder_bulk_test ( ) {
+    std::mt19937_64 gen ( 2u );
+    for ( std::size_t size : { 0u, 1u, 7u, 8u, 63u, 64u, 65u, 129u, 255u, 256u, 1'000u, 4'099u } ) {
+        bits_type a ( size ), b ( size );
+        std::vector<bool> va ( size ), vb ( size );
+        for ( std::size_t i = 0; i < size; ++i ) {
+            va[ i ] = gen ( ) % 2u, vb[ i ] = gen ( ) % 3u == 0u;
+            a.set ( i, va[ i ] ), b.set ( i, vb[ i ] );
+        }
+        std::vector<bool> r_and ( size ), r_or ( size ), r_xor ( size ), r_and_not ( size );
+        for ( std::size_t i = 0; i < size; ++i ) {
+            r_and[ i ]     = va[ i ] and vb[ i ];
+            r_or[ i ]      = va[ i ] or vb[ i ];
+            r_xor[ i ]     = va[ i ] != vb[ i ];
+            r_and_not[ i ] = va[ i ] and not vb[ i ];
+        }
+        bits_type c = a;
+        c.and_not ( b );
+        if ( not same ( a & b, r_and ) or not same ( a | b, r_or ) or not same ( a ^ b, r_xor ) or not same ( c, r_and_not ) or
+             ( a == b ) != ( va == vb ) or not( a == a ) )
+            return false;
+    }
+    return true;
+}
+
+bool rank_select_test ( ) {
+    std::mt19937_64 gen ( 3u );
+    for ( std::size_t size : { 0u, 1u, 64u, 511u, 512u, 513u, 3'000u, 10'000u } ) {
+        for ( unsigned density : { 2u, 7u, 97u } ) {
+            bits_type b;
+            std::vector<std::size_t> ones;
+            for ( std::size_t i = 0; i < size; ++i ) {
+                bool const x = gen ( ) % density == 0u;
+                b.push_back ( x );
+                if ( x )
+                    ones.push_back ( i );
+            }
+            pdr::rank_select<bits_type> const rs ( b );
+            std::size_t rank = 0;
+            for ( std::size_t i = 0; i <= size; ++i ) {
+                if ( rs.rank ( i ) != rank )
+                    return false;
+                rank += i < size and b[ i ];
+            }
+            for ( std::size_t k = 0; k < ones.size ( ); ++k )
+                if ( rs.select ( k ) != ones[ k ] )
+                    return false;
+            if ( rs.select ( ones.size ( ) ) != bits_type::npos )
+                return false;
+        }
+    }
+    return true;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = bit_podder_random_test ( 1u ) and ok;
+    ok      = bit_podder_bulk_test ( ) and ok;
+    ok      = rank_select_test ( ) and ok;
+    std::printf ( "bit_podder: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
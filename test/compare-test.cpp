@@ -0,0 +1,158 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+
+// the comparison operators against std::vector's (std::lexicographical_compare and std::equal), the mismatch kernel
+// against a byte loop.
+
+bool mismatch_test ( ) {
+    std::mt19937_64 gen ( 1u );
+    std::vector<unsigned char> a ( 300u ), b;
+    for ( unsigned char & c : a )
+        c = static_cast<unsigned char> ( gen ( ) );
+    for ( std::size_t size = 0; size < a.size ( ); ++size ) {
+        for ( std::size_t at = 0; at <= size; ++at ) {
+            b = a;
+            if ( at < size )
+                b[ at ] ^= static_cast<unsigned char> ( 1u << ( gen ( ) % 8u ) );
+            std::size_t const m = pdr::mismatch ( static_cast<void const *> ( a.data ( ) ), b.data ( ), size );
+            if ( m != at )
+                return false;
+        }
+    }
+    std::vector<std::uint32_t> const x{ 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u };
+    std::vector<std::uint32_t> const y{ 1u, 2u, 3u, 4u, 5u, 6u, 7u, 0x100u | 8u, 9u }; // differs in the second byte.
+    return pdr::mismatch ( x.data ( ), y.data ( ), x.size ( ) ) == 7u and
+           pdr::mismatch ( x.data ( ), x.data ( ), x.size ( ) ) == 9u;
+}
+
+// values from a small alphabet (many equal elements and common prefixes), for floats including -0.0 and nan.
+template<typename Type>
+Type draw ( std::mt19937_64 & gen ) {
+    std::uint64_t const r = gen ( ) % 6u;
+    if constexpr ( std::is_floating_point<Type>::value ) {
+        Type const values[ 6 ] = { Type{ 0 }, -Type{ 0 }, Type{ 1 }, -Type{ 1 }, std::numeric_limits<Type>::quiet_NaN ( ),
+                                   std::numeric_limits<Type>::infinity ( ) };
+        return values[ r ];
+    }
+    else if constexpr ( std::is_signed<Type>::value ) {
+        return static_cast<Type> ( static_cast<int> ( r ) - 3 );
+    }
+    else {
+        return static_cast<Type> ( r ? std::numeric_limits<Type>::max ( ) - r : 0u );
+    }
+}
+
+template<typename Type>
+bool operators_test ( std::uint64_t const seed ) {
+    std::mt19937_64 gen ( seed );
+    for ( int i = 0; i < 20'000; ++i ) {
+        std::vector<Type> v ( gen ( ) % 40u ), w;
+        for ( Type & x : v )
+            x = draw<Type> ( gen );
+        switch ( gen ( ) % 3u ) { // equal, a prefix or a change.
+            case 0: w = v; break;
+            case 1: w.assign ( v.begin ( ), v.begin ( ) + ( v.size ( ) ? gen ( ) % v.size ( ) : 0u ) ); break;
+            default:
+                w = v;
+                if ( w.size ( ) )
+                    w[ gen ( ) % w.size ( ) ] = draw<Type> ( gen );
+        }
+        if ( gen ( ) % 2u )
+            std::swap ( v, w );
+        podder<Type> const p ( v.data ( ), static_cast<typename podder<Type>::size_type> ( v.size ( ) ) );
+        podder<Type> const q ( w.data ( ), static_cast<typename podder<Type>::size_type> ( w.size ( ) ) );
+        bool const ok = ( p == q ) == ( v == w ) and ( p != q ) == ( v != w ) and ( p < q ) == ( v < w ) and
+                        ( p > q ) == ( v > w ) and ( p <= q ) == ( v <= w ) and ( p >= q ) == ( v >= w ) and
+                        ( p == w ) == ( v == w ) and ( p < w ) == ( v < w ) and ( p >= w ) == ( v >= w );
+        if ( not ok )
+            return false;
+    }
+    return true;
+}
+
+bool array_operators_test ( ) {
+    podder<std::int16_t> const p{ -1, 2, 3 };
+    std::array<std::int16_t, 3> const a{ -1, 2, 3 }, b{ -1, 2, 4 }, c{ -2, 2, 3 };
+    return p == a and p < b and p > c and p <= a and not( p < a );
+}
+
+// ordering structs by a member, against std::sort with the same projection.
+struct record {
+    std::int32_t key;
+    std::uint32_t payload;
+};
+
+bool projection_test ( ) {
+    std::mt19937_64 gen ( 7u );
+    auto const by_key = [] ( record const & r ) { return r.key; };
+    std::vector<podder<record>> ps ( 500 );
+    for ( podder<record> & p : ps )
+        for ( std::uint64_t i = gen ( ) % 6u; i; --i )
+            p.push_back ( record{ static_cast<std::int32_t> ( gen ( ) % 3u ) - 1, static_cast<std::uint32_t> ( gen ( ) ) } );
+    auto const reference_less = [] ( podder<record> const & a, podder<record> const & b ) {
+        return std::lexicographical_compare ( a.begin ( ), a.end ( ), b.begin ( ), b.end ( ),
+                                              [] ( record const & l, record const & r ) { return l.key < r.key; } );
+    };
+    pdr::key_less<decltype ( by_key )> const less{ by_key };
+    for ( std::size_t i = 0; i + 1u < ps.size ( ); ++i ) {
+        int const c = ps[ i ].compare ( ps[ i + 1u ], by_key );
+        if ( ( c < 0 ) != reference_less ( ps[ i ], ps[ i + 1u ] ) or ( c > 0 ) != reference_less ( ps[ i + 1u ], ps[ i ] ) or
+             less ( ps[ i ], ps[ i + 1u ] ) != ( c < 0 ) )
+            return false;
+    }
+    std::sort ( ps.begin ( ), ps.end ( ), less );
+    return std::is_sorted ( ps.begin ( ), ps.end ( ), reference_less );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = mismatch_test ( ) and ok;
+    ok      = operators_test<std::uint8_t> ( 1u ) and ok;
+    ok      = operators_test<std::int8_t> ( 2u ) and ok;
+    ok      = operators_test<std::uint16_t> ( 3u ) and ok;
+    ok      = operators_test<std::int32_t> ( 4u ) and ok;
+    ok      = operators_test<std::uint64_t> ( 5u ) and ok;
+    ok      = operators_test<float> ( 6u ) and ok;
+    ok      = operators_test<double> ( 7u ) and ok;
+    ok      = array_operators_test ( ) and ok;
+    ok      = projection_test ( ) and ok;
+    std::printf ( "compare: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
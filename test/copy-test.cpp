@@ -0,0 +1,102 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+// low, so podder's copies of a few pages go through stream_copy (the non-temporal stores, on AVX targets).
+#define PODDER_STREAMING_THRESHOLD ( std::size_t{ 4'096 } )
+
+#include "podder.hpp"
+
+// stream_copy and bulk_copy against memcpy, over sizes around the 32 byte head and the 128 byte body, and over all
+// misalignments of source and destination.
+
+std::vector<unsigned char> random_bytes ( std::size_t const size, std::uint64_t const seed ) {
+    std::mt19937_64 gen ( seed );
+    std::vector<unsigned char> v ( size );
+    for ( unsigned char & c : v )
+        c = static_cast<unsigned char> ( gen ( ) );
+    return v;
+}
+
+template<typename Copy>
+bool copy_test ( Copy copy ) {
+    std::vector<unsigned char> const src = random_bytes ( 20'000u + 64u, 1u );
+    std::vector<unsigned char> dst ( src.size ( ) + 64u ), ref ( dst.size ( ) );
+    for ( std::size_t size : { 0u, 1u, 31u, 32u, 33u, 127u, 128u, 129u, 160u, 255u, 1'000u, 4'095u, 4'096u, 4'097u, 20'000u } ) {
+        for ( std::size_t d = 0; d < 64u; d += 7u ) {
+            for ( std::size_t s = 0; s < 64u; s += 13u ) {
+                std::memset ( dst.data ( ), 0xAB, dst.size ( ) );
+                std::memset ( ref.data ( ), 0xAB, ref.size ( ) );
+                copy ( dst.data ( ) + d, src.data ( ) + s, size );
+                std::memcpy ( ref.data ( ) + d, src.data ( ) + s, size );
+                if ( dst != ref ) // the bytes around the destination are untouched as well.
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool stream_copy_test ( ) { return copy_test ( [] ( void * d, void const * s, std::size_t n ) { pdr::stream_copy ( d, s, n ); } ); }
+bool bulk_copy_test ( ) { return copy_test ( [] ( void * d, void const * s, std::size_t n ) { pdr::bulk_copy ( d, s, n ); } ); }
+
+// the podder paths that bulk copy: construction from a range, copy construction and copy assignment.
+bool podder_bulk_copy_test ( ) {
+    std::mt19937_64 gen ( 2u );
+    bool ok = true;
+    for ( std::size_t size : { 100u, 1'023u, 1'024u, 1'025u, 100'000u } ) {
+        std::vector<std::uint32_t> v ( size );
+        for ( std::uint32_t & x : v )
+            x = static_cast<std::uint32_t> ( gen ( ) );
+        podder<std::uint32_t> const p ( v.data ( ), static_cast<podder<std::uint32_t>::size_type> ( size ) );
+        podder<std::uint32_t> const q ( p );
+        podder<std::uint32_t> r ( 7, 1u );
+        r = q;
+        podder<std::uint32_t> s;
+        s.assign ( v.begin ( ), v.end ( ) );
+        for ( podder<std::uint32_t> const * c : std::initializer_list<podder<std::uint32_t> const *>{ &p, &q, &r, &s } )
+            ok = ok and c->size ( ) == size and std::memcmp ( c->data ( ), v.data ( ), size * sizeof ( std::uint32_t ) ) == 0;
+    }
+    return ok;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = stream_copy_test ( ) and ok;
+    ok      = bulk_copy_test ( ) and ok;
+    ok      = podder_bulk_copy_test ( ) and ok;
+    std::printf ( "copy: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
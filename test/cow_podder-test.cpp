@@ -0,0 +1,201 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/cow_podder.hpp"
+
+// cow_podder against std::vector, snapshots (copies) are taken along the way and should never change.
+
+template<typename Cow>
+bool same ( Cow const & c, std::vector<typename Cow::value_type> const & v ) {
+    return c.size ( ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), c.begin ( ) );
+}
+
+struct quad { // too big for an svo buffer.
+    std::uint64_t v[ 4 ];
+    [[nodiscard]] bool operator== ( quad const & o ) const noexcept { return std::equal ( v, v + 4, o.v ); }
+};
+
+template<typename Type>
+Type make ( std::uint64_t const i ) {
+    if constexpr ( std::is_same<Type, quad>::value )
+        return quad{ { i, i + 1u, i + 2u, i + 3u } };
+    else
+        return static_cast<Type> ( i );
+}
+
+template<typename Type>
+bool cow_podder_random_test ( std::uint64_t const seed ) {
+    using cow_type = pdr::cow_podder<Type>;
+    std::mt19937_64 gen ( seed );
+    cow_type c;
+    std::vector<Type> v;
+    std::vector<std::pair<cow_type, std::vector<Type>>> snapshots;
+    for ( int i = 0; i < 20'000; ++i ) {
+        Type const x = make<Type> ( gen ( ) );
+        switch ( gen ( ) % 8u ) {
+            case 0:
+            case 1: c.push_back ( x ), v.push_back ( x ); break;
+            case 2:
+                if ( v.size ( ) )
+                    c.pop_back ( ), v.pop_back ( );
+                break;
+            case 3: {
+                std::size_t const n = gen ( ) % 48u;
+                c.resize ( static_cast<typename cow_type::size_type> ( n ) ), v.resize ( n );
+            } break;
+            case 4:
+                if ( v.size ( ) ) {
+                    std::size_t const j = gen ( ) % v.size ( );
+                    c[ static_cast<typename cow_type::size_type> ( j ) ] = x, v[ j ] = x;
+                }
+                break;
+            case 5:
+                if ( snapshots.size ( ) < 64u )
+                    snapshots.emplace_back ( c, v );
+                else
+                    snapshots[ gen ( ) % snapshots.size ( ) ] = { c, v };
+                break;
+            case 6: {
+                cow_type t ( c );
+                c = std::move ( t ); // self-sharing, then moved back.
+            } break;
+            default:
+                if ( snapshots.size ( ) ) { // continue from a snapshot, the snapshot is still shared.
+                    auto const & s = snapshots[ gen ( ) % snapshots.size ( ) ];
+                    c              = s.first;
+                    v              = s.second;
+                }
+        }
+        if ( not same ( c, v ) )
+            return false;
+    }
+    for ( auto const & [ s, r ] : snapshots )
+        if ( not same ( s, r ) )
+            return false;
+    return true;
+}
+
+bool cow_podder_sharing_test ( ) {
+    pdr::cow_podder<std::uint32_t> a;
+    for ( std::uint32_t i = 0; i < 100u; ++i )
+        a.push_back ( i );
+    pdr::cow_podder<std::uint32_t> b ( a );
+    auto const & ca = a;
+    auto const & cb = b;
+    bool ok         = a.use_count ( ) == 2u and ca.data ( ) == cb.data ( ) and ca[ 50 ] == 50u and cb.at ( 99 ) == 99u;
+    ok              = ok and a.shared ( ); // const access didn't detach.
+    b[ 0 ]          = 1'000u;              // detaches b.
+    ok = ok and not a.shared ( ) and not b.shared ( ) and ca.data ( ) != cb.data ( ) and ca[ 0 ] == 0u and cb[ 0 ] == 1'000u;
+    pdr::cow_podder<std::uint32_t> c ( a ), d ( a );
+    c.clear ( ); // the block stays alive for a and d.
+    ok = ok and c.empty ( ) and a.use_count ( ) == 2u and d.size ( ) == 100u and std::as_const ( d )[ 99 ] == 99u;
+    try {
+        static_cast<void> ( cb.at ( 100 ) );
+        ok = false;
+    }
+    catch ( std::out_of_range const & ) {
+    }
+    pdr::cow_podder<std::uint8_t> s{ 1, 2, 3 }, t ( s ); // small, plain values.
+    t[ 0 ] = 9u;
+    return ok and s.use_count ( ) == 0u and s[ 0 ] == 1u and t[ 0 ] == 9u;
+}
+
+bool cow_podder_conversion_test ( ) {
+    podder<std::uint16_t> p;
+    for ( std::uint16_t i = 0; i < 1'000u; ++i )
+        p.push_back ( static_cast<std::uint16_t> ( i * 3u ) );
+    pdr::cow_podder<std::uint16_t> const c ( p );
+    podder<std::uint16_t> const q = c.to_podder ( );
+    return c.size ( ) == p.size ( ) and std::equal ( p.begin ( ), p.end ( ), c.begin ( ) ) and q == p;
+}
+
+// by value, as podder.
+bool cow_podder_equality_test ( ) {
+    double const nan = std::numeric_limits<double>::quiet_NaN ( );
+    pdr::cow_podder<double> a ( 100, 0.0 ), b ( 100, -0.0 ), n ( 100, 1.0 ), small_n{ nan };
+    n[ 7 ]                                = nan;
+    pdr::cow_podder<double> m             = n;       // shares n's block.
+    pdr::cow_podder<double> const small_m = small_n; // a copy of the svo buffer.
+    podder<double> const pa ( 100, 0.0 ), pb ( 100, -0.0 ), pn ( 100, nan );
+    bool ok = ( a == b ) == ( pa == pb ) and ( n == m ) == ( pn == pn ) and not( n == m ) and n != m and small_n != small_m;
+    pdr::cow_podder<std::uint64_t> x ( 100, 1u ), y ( x ), z ( 100, 1u ), w ( 99, 1u );
+    return ok and a == b and x == y and x == z and x != w;
+}
+
+// copies made, read and mutated on several threads, the shared block is released by whichever thread drops it last.
+bool cow_podder_threads_test ( ) {
+    pdr::cow_podder<std::uint64_t> original;
+    for ( std::uint64_t i = 0; i < 1'000u; ++i )
+        original.push_back ( i );
+    std::vector<std::thread> threads;
+    std::vector<int> oks ( 4, 1 );
+    for ( std::size_t t = 0; t < oks.size ( ); ++t )
+        threads.emplace_back ( [ &original, &oks, t ] ( ) {
+            for ( std::uint64_t i = 0; i < 1'000u; ++i ) {
+                pdr::cow_podder<std::uint64_t> c ( std::as_const ( original ) );
+                if ( std::as_const ( c )[ i ] != i )
+                    oks[ t ] = 0;
+                c[ i ] = i + 1u; // detaches.
+                if ( std::as_const ( c )[ i ] != i + 1u )
+                    oks[ t ] = 0;
+            }
+        } );
+    for ( std::thread & t : threads )
+        t.join ( );
+    bool ok = original.use_count ( ) == 1u;
+    for ( std::uint64_t i = 0; i < 1'000u; ++i )
+        ok = ok and std::as_const ( original )[ i ] == i;
+    return ok and std::all_of ( oks.begin ( ), oks.end ( ), [] ( int o ) { return o; } );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = cow_podder_random_test<std::uint8_t> ( 1u ) and ok;
+    ok      = cow_podder_random_test<std::uint32_t> ( 2u ) and ok;
+    ok      = cow_podder_random_test<quad> ( 3u ) and ok;
+    ok      = cow_podder_sharing_test ( ) and ok;
+    ok      = cow_podder_conversion_test ( ) and ok;
+    ok      = cow_podder_equality_test ( ) and ok;
+    ok      = cow_podder_threads_test ( ) and ok;
+    std::printf ( "cow_podder: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,191 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/expr.hpp"
+
+// pdr::expr against scalar loops, the operators and functions, assign, append, store and eval, with the destination
+// among the terminals in place, shifted, and read through a narrower terminal, and the reductions.
+
+using namespace pdr::expr;
+
+template<typename Type>
+podder<Type> random_podder ( std::size_t const n, std::uint64_t const seed, int const lo, int const hi ) {
+    std::mt19937_64 gen ( seed );
+    std::uniform_int_distribution<int> dis ( lo, hi );
+    podder<Type> p;
+    for ( std::size_t i = 0; i < n; ++i )
+        p.push_back ( static_cast<Type> ( dis ( gen ) ) );
+    return p;
+}
+
+template<typename Podder, typename Type>
+bool same ( Podder const & p, std::vector<Type> const & v ) {
+    return static_cast<std::size_t> ( p.size ( ) ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+}
+
+bool operators_test ( ) {
+    bool ok = true;
+    for ( std::size_t n : { 0u, 1u, 7u, 8u, 9u, 100u, 1'001u } ) {
+        podder<std::int32_t> const a = random_podder<std::int32_t> ( n, 1u, -1'000, 1'000 );
+        podder<std::int32_t> const b = random_podder<std::int32_t> ( n, 2u, 1, 100 ); // no 0, for / and %.
+        podder<std::uint8_t> const c = random_podder<std::uint8_t> ( n, 3u, 0, 255 );
+        podder<float> const f        = random_podder<float> ( n, 4u, 0, 10'000 );
+        std::vector<std::int32_t> r ( n );
+        podder<std::int32_t> d;
+        for ( std::size_t i = 0; i < n; ++i )
+            r[ i ] = a[ i ] * b[ i ] + c[ i ] - a[ i ] / b[ i ] + a[ i ] % b[ i ];
+        ok = ok and same ( assign ( d, of ( a ) * of ( b ) + of ( c ) - of ( a ) / of ( b ) + of ( a ) % of ( b ) ), r );
+        for ( std::size_t i = 0; i < n; ++i )
+            r[ i ] = ( ( a[ i ] & 0xF0 ) | c[ i ] ) ^ ~b[ i ];
+        ok = ok and same ( assign ( d, ( ( of ( a ) & 0xF0 ) | of ( c ) ) ^ ~of ( b ) ), r );
+        for ( std::size_t i = 0; i < n; ++i )
+            r[ i ] = std::min ( std::max ( -a[ i ], -500 ), std::abs ( a[ i ] ) ) + ( a[ i ] < b[ i ] ? 1 : 0 ) +
+                     ( a[ i ] >= 0 ? c[ i ] : b[ i ] ) + not a[ i ];
+        ok = ok and same ( assign ( d, minimum ( maximum ( -of ( a ), -500 ), abs ( of ( a ) ) ) + ( of ( a ) < of ( b ) ) +
+                                           select ( of ( a ) >= 0, of ( c ), of ( b ) ) + !of ( a ) ),
+                           r );
+        std::vector<float> g ( n );
+        for ( std::size_t i = 0; i < n; ++i )
+            g[ i ] = std::sqrt ( f[ i ] ) * 0.5f + static_cast<float> ( c[ i ] );
+        podder<float> const h = eval ( sqrt ( of ( f ) ) * 0.5f + cast<float> ( of ( c ) ) );
+        ok = ok and same ( h, g );
+        // small integers promote, and convert back to the destination type.
+        std::vector<std::uint8_t> s ( n );
+        for ( std::size_t i = 0; i < n; ++i )
+            s[ i ] = static_cast<std::uint8_t> ( c[ i ] * 3 + 7 );
+        podder<std::uint8_t> t;
+        ok = ok and same ( assign ( t, of ( c ) * 3 + 7 ), s ) and same ( eval<std::uint8_t> ( of ( c ) * 3 + 7 ), s );
+    }
+    return ok;
+}
+
+// the destination among the terminals.
+bool aliasing_test ( ) {
+    bool ok = true;
+    for ( std::size_t n : { 1u, 2u, 7u, 33u, 1'000u } ) {
+        podder<std::int32_t> const b = random_podder<std::int32_t> ( n, 5u, -100, 100 );
+        // in place, value i is read before it's written, the block stays.
+        {
+            podder<std::int32_t> a = random_podder<std::int32_t> ( n, 6u, -100, 100 );
+            std::vector<std::int32_t> r ( a.begin ( ), a.end ( ) );
+            for ( std::size_t i = 0; i < n; ++i )
+                r[ i ] = r[ i ] * 2 + b[ i ] - r[ i ] / 3;
+            std::int32_t const * const p = a.data ( );
+            assign ( a, of ( a ) * 2 + of ( b ) - of ( a ) / 3 );
+            ok = ok and same ( a, r ) and ( n <= 5u or a.data ( ) == p );
+        }
+        // shifted, a[ i ] = a[ i + 1 ] + a[ i ], into fewer values.
+        {
+            podder<std::int32_t> a = random_podder<std::int32_t> ( n, 7u, -100, 100 );
+            std::vector<std::int32_t> r;
+            for ( std::size_t i = 0; i + 1u < n; ++i )
+                r.push_back ( a[ i + 1u ] + a[ i ] );
+            assign ( a, of ( a.data ( ) + 1, n - 1u ) + of ( a.data ( ), n - 1u ) );
+            ok = ok and same ( a, r );
+        }
+        // store into a view shifted against itself, both ways (as memmove).
+        for ( int forward = 0; forward < 2; ++forward ) {
+            podder<std::int32_t> a = random_podder<std::int32_t> ( n, 8u, -100, 100 );
+            std::vector<std::int32_t> r ( a.begin ( ), a.end ( ) );
+            std::size_t const m = n - 1u;
+            if ( forward )
+                std::copy ( r.begin ( ) + 1, r.end ( ), r.begin ( ) );
+            else
+                std::copy_backward ( r.begin ( ), r.begin ( ) + m, r.end ( ) );
+            std::int32_t * const to         = a.data ( ) + ( forward ? 0 : 1 );
+            std::int32_t const * const from = a.data ( ) + ( forward ? 1 : 0 );
+            store ( pdr::span<std::int32_t> ( to, m ), of ( from, m ) + 0 );
+            ok = ok and same ( a, r );
+        }
+        // a narrower terminal at the destination, the bytes of a as values of a.
+        {
+            podder<std::uint32_t> a = random_podder<std::uint32_t> ( n, 9u, 0, 1'000'000 );
+            std::vector<std::uint32_t> r ( n );
+            std::vector<std::uint8_t> bytes ( n ); // the first n bytes.
+            std::memcpy ( bytes.data ( ), a.data ( ), n );
+            std::copy ( bytes.begin ( ), bytes.end ( ), r.begin ( ) );
+            assign ( a, cast<std::uint32_t> ( of ( reinterpret_cast<std::uint8_t const *> ( a.data ( ) ), n ) ) );
+            ok = ok and same ( a, r );
+        }
+        // append, e reads the podder, which relocates.
+        {
+            podder<std::int32_t> a = random_podder<std::int32_t> ( n, 10u, -100, 100 );
+            std::vector<std::int32_t> r ( a.begin ( ), a.end ( ) );
+            for ( std::size_t i = 0; i < n; ++i )
+                r.push_back ( r[ i ] * 3 + b[ i ] );
+            append ( a, of ( a ) * 3 + of ( b ) );
+            ok = ok and same ( a, r );
+            for ( std::size_t i = 0; i < n; ++i )
+                r.push_back ( b[ i ] - 1 );
+            append ( a, of ( b ) - 1 );
+            ok = ok and same ( a, r );
+        }
+    }
+    return ok;
+}
+
+bool reductions_test ( ) {
+    bool ok = true;
+    for ( std::size_t n : { 1u, 7u, 8u, 9u, 100u, 100'001u } ) {
+        podder<std::int16_t> const a = random_podder<std::int16_t> ( n, 11u, -32'768, 32'767 );
+        podder<double> const d       = random_podder<double> ( n, 12u, -1'000, 1'000 ); // integers, the sums are exact.
+        std::int64_t s = 0, sq = 0;
+        std::int16_t lo = a[ 0 ], hi = a[ 0 ];
+        std::size_t negative = 0;
+        double ds            = 0.0;
+        for ( std::size_t i = 0; i < n; ++i ) {
+            s += a[ i ], sq += std::int64_t{ a[ i ] } * a[ i ], ds += d[ i ] * 2.0;
+            lo = std::min ( lo, a[ i ] ), hi = std::max ( hi, a[ i ] );
+            negative += a[ i ] < 0;
+        }
+        ok = ok and sum ( of ( a ) ) == s and sum ( cast<std::int64_t> ( of ( a ) ) * of ( a ) ) == sq and
+             sum ( of ( d ) * 2.0 ) == ds;
+        ok = ok and min ( of ( a ) ) == lo and max ( of ( a ) ) == hi and count ( of ( a ) < 0 ) == negative;
+        ok = ok and any ( of ( a ) == hi ) and not any ( of ( a ) > hi ) and all ( of ( a ) >= lo ) and not all ( of ( a ) > lo );
+    }
+    return ok;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = operators_test ( ) and ok;
+    ok      = aliasing_test ( ) and ok;
+    ok      = reductions_test ( ) and ok;
+    std::printf ( "expr: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
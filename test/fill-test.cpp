@@ -0,0 +1,147 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+// low, so fills of a few pages go through the non-temporal stores (on AVX targets).
+#define PODDER_STREAMING_THRESHOLD ( std::size_t{ 4'096 } )
+
+#include "podder.hpp"
+
+// pdr::fill against copying the value in a loop, for value sizes that divide the vector width and ones that don't,
+// over counts around the vector and chunk sizes and all misalignments of the destination, with guard bytes either
+// side. pdr::iota and the stride constructor against repeated addition (or first + i * stride, for floating point).
+
+bool fill_test ( ) {
+    std::mt19937_64 gen ( 1u );
+    std::vector<unsigned char> dst ( 70'000u + 128u ), ref ( dst.size ( ) );
+    bool ok = true;
+    for ( std::size_t size : { 1u, 2u, 3u, 4u, 5u, 7u, 8u, 12u, 16u, 24u, 32u, 40u, 100u } ) {
+        unsigned char value[ 100 ];
+        for ( int repeatable = 0; repeatable < 2; ++repeatable ) {
+            for ( unsigned char & c : value )
+                c = static_cast<unsigned char> ( repeatable ? 0x5Au : gen ( ) | 1u );
+            for ( std::size_t count : { 0u, 1u, 2u, 3u, 15u, 33u, 64u, 129u, 500u, 1'000u, 4'097u } ) {
+                if ( size * count > 70'000u )
+                    continue;
+                for ( std::size_t offset = 0; offset < 64u; offset += size < 8u ? 1u : 5u ) {
+                    std::memset ( dst.data ( ), 0xEE, dst.size ( ) );
+                    std::memset ( ref.data ( ), 0xEE, ref.size ( ) );
+                    for ( std::size_t i = 0; i < count; ++i )
+                        std::memcpy ( ref.data ( ) + offset + i * size, value, size );
+                    pdr::fill ( dst.data ( ) + offset, value, size, count );
+                    ok = ok and dst == ref;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+// the reference, repeated addition (modulo 2^n for the integers).
+template<typename Type>
+std::vector<Type> stepped ( std::size_t const count, Type const first, Type const stride ) {
+    std::vector<Type> v ( count );
+    if constexpr ( std::is_floating_point<Type>::value ) {
+        for ( std::size_t i = 0; i < count; ++i )
+            v[ i ] = first + static_cast<Type> ( i ) * stride;
+    }
+    else {
+        using word = std::make_unsigned_t<Type>;
+        word w     = static_cast<word> ( first );
+        for ( Type & x : v )
+            x = static_cast<Type> ( w ), w = static_cast<word> ( w + static_cast<word> ( stride ) );
+    }
+    return v;
+}
+
+template<typename Type>
+bool iota_test ( Type const first, Type const stride ) {
+    bool ok = true;
+    for ( std::size_t count : { 0u, 1u, 2u, 3u, 7u, 8u, 31u, 32u, 33u, 100u, 1'000u } ) {
+        std::vector<Type> const v = stepped ( count, first, stride );
+        std::vector<Type> d ( count + 1u, Type{ 42 } );
+        pdr::iota ( d.data ( ), count, first, stride );
+        ok = ok and std::equal ( v.begin ( ), v.end ( ), d.begin ( ) ) and d.back ( ) == Type{ 42 };
+        // the stride constructor, small and medium.
+        podder<Type> const p ( static_cast<std::size_t> ( count ), first, static_cast<std::ptrdiff_t> ( stride ) );
+        ok = ok and p.size ( ) == count and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+    }
+    return ok;
+}
+
+struct triple { // no arithmetic, the stride is ignored.
+    std::uint8_t v[ 3 ];
+    [[nodiscard]] bool operator== ( triple const & o ) const noexcept { return std::equal ( v, v + 3, o.v ); }
+};
+
+// the fill constructor, assign and insert ( pos, count, value ) against std::vector.
+template<typename Type>
+bool podder_fill_test ( Type const x, Type const y ) {
+    bool ok = true;
+    for ( std::size_t count : { 0u, 1u, 2u, 5u, 23u, 24u, 100u, 10'000u } ) {
+        // bool and the other non-arithmetic types ignore a stride.
+        bool const arithmetic = std::is_arithmetic<Type>::value and not std::is_same<Type, bool>::value;
+        podder<Type> p ( count, x, arithmetic ? 0 : 3 );
+        std::vector<Type> v ( count, x );
+        ok = ok and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) ) and p.size ( ) == count;
+        for ( std::size_t n : { 0u, 3u, 30u, 3'000u } ) {
+            p.assign ( n, y ), v.assign ( n, y );
+            ok = ok and p.size ( ) == n and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+            std::size_t const at = n / 3u;
+            p.insert ( p.begin ( ) + at, count, x ), v.insert ( v.begin ( ) + at, count, x );
+            ok = ok and p.size ( ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+        }
+    }
+    return ok;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = fill_test ( ) and ok;
+    ok      = iota_test<std::int8_t> ( -100, 7 ) and ok; // wraps.
+    ok      = iota_test<std::uint16_t> ( 65'000u, 13u ) and ok;
+    ok      = iota_test<std::int32_t> ( 5, -3 ) and ok;
+    ok      = iota_test<std::int64_t> ( -1, 1'000'000'007 ) and ok;
+    ok      = iota_test<float> ( 0.1f, 3.0f ) and ok; // the stride constructor takes an integer stride.
+    ok      = iota_test<double> ( -2.5, -7.0 ) and ok;
+    ok      = podder_fill_test<std::uint8_t> ( 0x11u, 0u ) and ok;
+    ok      = podder_fill_test<std::uint32_t> ( 0x01020304u, 0xFFFFFFFFu ) and ok;
+    ok      = podder_fill_test<double> ( 1.5, -0.0 ) and ok;
+    ok      = podder_fill_test<bool> ( true, false ) and ok;
+    ok      = podder_fill_test<triple> ( triple{ { 1u, 2u, 3u } }, triple{ { 0u, 0u, 0u } } ) and ok;
+    std::printf ( "fill: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
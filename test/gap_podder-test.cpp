@@ -0,0 +1,175 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// with assertions, gap_podder's own preconditions are checked as well.
+#undef NDEBUG
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/gap_podder.hpp"
+
+// gap_podder against std::vector, edits around a cursor that mostly moves a little, and sometimes jumps.
+
+struct quad { // too big for an svo buffer, i.e. a no_svo podder.
+    std::uint64_t v[ 4 ];
+    [[nodiscard]] bool operator== ( quad const & o ) const noexcept { return std::equal ( v, v + 4, o.v ); }
+};
+
+template<typename Type>
+Type make ( std::uint64_t const i ) {
+    if constexpr ( std::is_same<Type, quad>::value )
+        return quad{ { i, i + 1u, i + 2u, i + 3u } };
+    else
+        return static_cast<Type> ( i );
+}
+
+// the two runs either side of the gap, and operator[].
+template<typename Type>
+bool same ( pdr::gap_podder<Type> const & g, std::vector<Type> const & v ) {
+    auto const [ b, bn ] = g.before ( );
+    auto const [ a, an ] = g.after ( );
+    if ( g.size ( ) != v.size ( ) or bn + an != v.size ( ) or bn != g.cursor ( ) or not std::equal ( b, b + bn, v.begin ( ) ) or
+         not std::equal ( a, a + an, v.begin ( ) + bn ) )
+        return false;
+    for ( std::size_t i = 0; i < v.size ( ); ++i )
+        if ( not( g[ i ] == v[ i ] ) )
+            return false;
+    return true;
+}
+
+template<typename Type>
+bool gap_podder_random_test ( std::uint64_t const seed ) {
+    using gap_type  = pdr::gap_podder<Type>;
+    using size_type = typename gap_type::size_type;
+    std::mt19937_64 gen ( seed );
+    gap_type g;
+    std::vector<Type> v;
+    std::size_t cursor = 0;
+    for ( int i = 0; i < 30'000; ++i ) {
+        // mostly near the cursor.
+        std::size_t const at = gen ( ) % 8u ? std::min ( v.size ( ), cursor + gen ( ) % 3u ) : gen ( ) % ( v.size ( ) + 1u );
+        Type const x         = make<Type> ( gen ( ) );
+        switch ( gen ( ) % 10u ) {
+            case 0:
+            case 1:
+                g.insert ( static_cast<size_type> ( at ), x ), v.insert ( v.begin ( ) + at, x );
+                cursor = at + 1u;
+                break;
+            case 2: {
+                std::size_t const n = gen ( ) % 20u;
+                g.insert ( static_cast<size_type> ( at ), static_cast<size_type> ( n ), x ), v.insert ( v.begin ( ) + at, n, x );
+                cursor = at + n;
+            } break;
+            case 3: {
+                std::vector<Type> values ( gen ( ) % 40u );
+                for ( Type & y : values )
+                    y = make<Type> ( gen ( ) );
+                g.insert ( static_cast<size_type> ( at ), values.data ( ), static_cast<size_type> ( values.size ( ) ) );
+                v.insert ( v.begin ( ) + at, values.begin ( ), values.end ( ) );
+                cursor = values.size ( ) ? at + values.size ( ) : g.cursor ( );
+            } break;
+            case 4: // (part of) itself, the run after the gap.
+                if ( auto const [ a, an ] = g.after ( ); an ) {
+                    std::size_t const n = 1u + gen ( ) % std::min<std::size_t> ( an, 30u );
+                    std::vector<Type> const values ( a, a + n );
+                    g.insert ( static_cast<size_type> ( at ), a, static_cast<size_type> ( n ) );
+                    v.insert ( v.begin ( ) + at, values.begin ( ), values.end ( ) );
+                    cursor = at + n;
+                }
+                break;
+            case 5:
+            case 6:
+                if ( at < v.size ( ) ) {
+                    std::size_t const n = 1u + gen ( ) % std::min<std::size_t> ( 40u, v.size ( ) - at );
+                    g.erase ( static_cast<size_type> ( at ), static_cast<size_type> ( n ) );
+                    v.erase ( v.begin ( ) + at, v.begin ( ) + at + n );
+                    cursor = at;
+                }
+                break;
+            case 7:
+                if ( gen ( ) % 2u ) {
+                    g.push_back ( x ), v.push_back ( x );
+                }
+                else if ( v.size ( ) ) {
+                    g.pop_back ( ), v.pop_back ( );
+                }
+                cursor = v.size ( );
+                break;
+            case 8:
+                g.move_to ( static_cast<size_type> ( at ) );
+                cursor = at;
+                break;
+            default:
+                if ( gen ( ) % 4u == 0u ) { // contiguous.
+                    Type const * const p = g.data ( );
+                    if ( not std::equal ( v.begin ( ), v.end ( ), p ) )
+                        return false;
+                    cursor = v.size ( );
+                }
+                else if ( gen ( ) % 64u == 0u or v.size ( ) > 3'000u ) {
+                    g.clear ( ), v.clear ( );
+                    cursor = 0u;
+                }
+        }
+        if ( g.cursor ( ) != cursor or not same ( g, v ) )
+            return false;
+    }
+    gap_type const copy  = g;
+    bool const equal     = copy == g and same ( copy, v );
+    podder<Type> const p = g.release ( );
+    return equal and g.empty ( ) and p.size ( ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+}
+
+bool gap_podder_construction_test ( ) {
+    pdr::gap_podder<int> g{ 1, 2, 3 }, h{ 1, 2, 3 };
+    bool ok = g == h and g.cursor ( ) == 3u and g.front ( ) == 1 and g.back ( ) == 3;
+    g.insert ( 0, 0 );
+    ok = ok and g != h and g.cursor ( ) == 1u and g[ 0 ] == 0 and g[ 3 ] == 3;
+    pdr::gap_podder<int> r = g;
+    r.reserve ( 1'000 );
+    ok = ok and r.capacity ( ) >= 1'000u and r == g;
+    g.erase ( 0 );
+    return ok and g == h;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = gap_podder_random_test<std::uint8_t> ( 1u ) and ok;
+    ok      = gap_podder_random_test<std::uint32_t> ( 2u ) and ok;
+    ok      = gap_podder_random_test<quad> ( 3u ) and ok;
+    ok      = gap_podder_construction_test ( ) and ok;
+    std::printf ( "gap_podder: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
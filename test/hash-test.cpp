@@ -0,0 +1,216 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+
+// hash_bytes against a plain transcription of wyhash (final 4), byte-wise little-endian reads and a 32 x 32 bit
+// multiply, so neither the word reads nor the 128 bit multiply of hash.hpp are shared with the reference.
+
+namespace reference {
+
+constexpr std::uint64_t secret[ 4 ]{ 0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull, 0x4B33A62ED433D4A3ull,
+                                     0x4D5A2DA51DE1AA47ull };
+
+std::uint64_t read ( unsigned char const * p, int const bytes ) {
+    std::uint64_t w = 0;
+    for ( int i = bytes - 1; i >= 0; --i )
+        w = ( w << 8 ) | p[ i ];
+    return w;
+}
+
+void mum ( std::uint64_t & a, std::uint64_t & b ) {
+    std::uint64_t const a0 = a & 0xFFFFFFFFu, a1 = a >> 32, b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    std::uint64_t const p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    std::uint64_t const middle = ( p00 >> 32 ) + ( p01 & 0xFFFFFFFFu ) + ( p10 & 0xFFFFFFFFu );
+    a                          = ( middle << 32 ) | ( p00 & 0xFFFFFFFFu );
+    b                          = p11 + ( p01 >> 32 ) + ( p10 >> 32 ) + ( middle >> 32 );
+}
+
+std::uint64_t mix ( std::uint64_t a, std::uint64_t b ) {
+    mum ( a, b );
+    return a ^ b;
+}
+
+std::uint64_t hash ( unsigned char const * p, std::size_t const size, std::uint64_t seed ) {
+    seed ^= mix ( seed ^ secret[ 0 ], secret[ 1 ] );
+    std::uint64_t a = 0, b = 0;
+    if ( size <= 16u ) {
+        if ( size >= 4u ) {
+            a = ( read ( p, 4 ) << 32 ) | read ( p + ( ( size >> 3 ) << 2 ), 4 );
+            b = ( read ( p + size - 4u, 4 ) << 32 ) | read ( p + size - 4u - ( ( size >> 3 ) << 2 ), 4 );
+        }
+        else if ( size ) {
+            a = ( std::uint64_t{ p[ 0 ] } << 16 ) | ( std::uint64_t{ p[ size >> 1 ] } << 8 ) | p[ size - 1u ];
+        }
+    }
+    else {
+        std::size_t i = size;
+        if ( i > 48u ) {
+            std::uint64_t see1 = seed, see2 = seed;
+            for ( ; i > 48u; i -= 48u, p += 48 ) {
+                seed = mix ( read ( p, 8 ) ^ secret[ 1 ], read ( p + 8, 8 ) ^ seed );
+                see1 = mix ( read ( p + 16, 8 ) ^ secret[ 2 ], read ( p + 24, 8 ) ^ see1 );
+                see2 = mix ( read ( p + 32, 8 ) ^ secret[ 3 ], read ( p + 40, 8 ) ^ see2 );
+            }
+            seed ^= see1 ^ see2;
+        }
+        for ( ; i > 16u; i -= 16u, p += 16 )
+            seed = mix ( read ( p, 8 ) ^ secret[ 1 ], read ( p + 8, 8 ) ^ seed );
+        a = read ( p + i - 16u, 8 );
+        b = read ( p + i - 8u, 8 );
+    }
+    a ^= secret[ 1 ];
+    b ^= seed;
+    mum ( a, b );
+    return mix ( a ^ secret[ 0 ] ^ size, b ^ secret[ 1 ] );
+}
+
+} // namespace reference
+
+bool hash_bytes_test ( ) {
+    std::mt19937_64 gen ( 1u );
+    std::vector<unsigned char> bytes ( 1'000u );
+    for ( unsigned char & c : bytes )
+        c = static_cast<unsigned char> ( gen ( ) );
+    for ( std::size_t size = 0; size <= bytes.size ( ); size += size < 200u ? 1u : 97u ) {
+        for ( std::size_t offset : { 0u, 1u, 7u } ) {
+            if ( offset + size > bytes.size ( ) )
+                continue;
+            std::uint64_t const seed = gen ( );
+            std::uint64_t const h    = pdr::hash_bytes ( bytes.data ( ) + offset, size, seed );
+            if ( h != reference::hash ( bytes.data ( ) + offset, size, seed ) or
+                 h != pdr::hash_short ( bytes.data ( ) + offset, size, seed ) )
+                return false;
+        }
+    }
+    return true;
+}
+
+// the hashes are stable across runs, builds and platforms (they can be stored), these are pinned.
+bool hash_pinned_test ( ) {
+    char const * const inputs[ 7 ]{ "",
+                                    "a",
+                                    "abc",
+                                    "message digest",
+                                    "abcdefghijklmnopqrstuvwxyz",
+                                    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+                                    "12345678901234567890123456789012345678901234567890123456789012345678901234567890" };
+    std::uint64_t const hashes[ 7 ]{ 0x93228A4DE0EEC5A2ull, 0xC5BAC3DB178713C4ull, 0xA97F2F7B1D9B3314ull, 0x786D1F1DF3801DF4ull,
+                                     0xDCA5A8138AD37C87ull, 0xB9E734F117CFAF70ull, 0x6CC5EAB49A92D617ull };
+    bool ok = true;
+    for ( std::uint64_t i = 0; i < 7u; ++i ) // the seed is the index.
+        ok = ok and pdr::hash_bytes ( inputs[ i ], std::strlen ( inputs[ i ] ), i ) == hashes[ i ];
+    return ok;
+}
+
+// podder::hash is the hash of the contents, whether small or medium, and std::hash agrees with it.
+template<typename Type>
+bool podder_hash_test ( ) {
+    std::mt19937_64 gen ( 2u );
+    podder<Type> p;
+    for ( int i = 0; i < 300; ++i ) {
+        std::uint64_t const seed = gen ( );
+        unsigned char const * const bytes = reinterpret_cast<unsigned char const *> ( p.data ( ) );
+        if ( p.hash ( seed ) != reference::hash ( bytes, p.size_in_bytes ( ), seed ) )
+            return false;
+        podder<Type> q;
+        q.reserve ( 1'000 ); // the same contents, medium.
+        for ( Type const x : p )
+            q.push_back ( x );
+        if ( q.hash ( ) != p.hash ( ) or std::hash<podder<Type>>{ }( p ) != static_cast<std::size_t> ( p.hash ( ) ) )
+            return false;
+        p.push_back ( static_cast<Type> ( gen ( ) ) );
+    }
+    return true;
+}
+
+// equal podders hash equal, -0.0 as 0.0.
+bool podder_float_hash_test ( ) {
+    double const nz = -0.0;
+    podder<double> const a{ 1.0, 0.0, 2.0 }, b{ 1.0, nz, 2.0 }, c ( 100, 0.0 ), d ( 100, nz );
+    podder<float> const e{ 0.0f }, f{ -0.0f };
+    return a == b and a.hash ( ) == b.hash ( ) and c == d and c.hash ( 7u ) == d.hash ( 7u ) and e.hash ( ) == f.hash ( ) and
+           a.hash ( ) != podder<double> ( { 1.0, 0.5, 2.0 } ).hash ( );
+}
+
+// unordered containers of podders and of hashed podders, against std::set.
+bool unordered_test ( ) {
+    std::mt19937_64 gen ( 3u );
+    std::unordered_set<podder<std::uint16_t>> u;
+    std::unordered_set<pdr::hashed<podder<std::uint16_t>>> h;
+    std::set<std::vector<std::uint16_t>> s;
+    for ( int i = 0; i < 10'000; ++i ) {
+        std::vector<std::uint16_t> v ( gen ( ) % 6u );
+        for ( std::uint16_t & x : v )
+            x = static_cast<std::uint16_t> ( gen ( ) % 4u );
+        podder<std::uint16_t> p;
+        for ( std::uint16_t const x : v )
+            p.push_back ( x );
+        bool const inserted = s.insert ( v ).second;
+        if ( u.insert ( p ).second != inserted or h.insert ( pdr::hashed<podder<std::uint16_t>> ( p ) ).second != inserted )
+            return false;
+    }
+    return u.size ( ) == s.size ( ) and h.size ( ) == s.size ( );
+}
+
+bool hashed_test ( ) {
+    pdr::hashed<podder<std::uint32_t>> a ( podder<std::uint32_t>{ 1u, 2u, 3u } ), b;
+    bool ok = a.hash ( ) == std::hash<podder<std::uint32_t>>{ }( a.get ( ) ) and a != b;
+    b.modify ( [] ( podder<std::uint32_t> & p ) { p.assign ( { 1u, 2u, 3u } ); } );
+    ok = ok and a == b and b.hash ( ) == a.hash ( );
+    a.modify ( [] ( podder<std::uint32_t> & p ) { p.push_back ( 4u ); } );
+    ok                            = ok and a != b and a.hash ( ) == podder<std::uint32_t> ( { 1u, 2u, 3u, 4u } ).hash ( );
+    podder<std::uint32_t> const r = a.release ( );
+    return ok and r.size ( ) == 4u and a.get ( ).empty ( ) and a.hash ( ) == podder<std::uint32_t> ( ).hash ( );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = hash_bytes_test ( ) and ok;
+    ok      = hash_pinned_test ( ) and ok;
+    ok      = podder_hash_test<std::uint8_t> ( ) and ok;
+    ok      = podder_hash_test<std::uint32_t> ( ) and ok;
+    ok      = podder_hash_test<double> ( ) and ok;
+    ok      = podder_float_hash_test ( ) and ok;
+    ok      = unordered_test ( ) and ok;
+    ok      = hashed_test ( ) and ok;
+    std::printf ( "hash: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,145 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// with assertions, podder's own invariants are checked as well.
+#undef NDEBUG
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+
+// the inserts (through open_gap) against std::vector::insert, at random positions, of random counts, from the svo
+// buffer, medium and offset (after pop_front) podders, with and without a relocation.
+
+struct quad { // too big for an svo buffer, i.e. a no_svo podder.
+    std::uint64_t v[ 4 ];
+    [[nodiscard]] bool operator== ( quad const & o ) const noexcept { return std::equal ( v, v + 4, o.v ); }
+};
+
+template<typename Type>
+Type make ( std::uint64_t const i ) {
+    if constexpr ( std::is_same<Type, quad>::value )
+        return quad{ { i, i + 1u, i + 2u, i + 3u } };
+    else
+        return static_cast<Type> ( i );
+}
+
+template<typename Podder>
+bool same ( Podder const & p, std::vector<typename Podder::value_type> const & v ) {
+    return p.size ( ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+}
+
+template<typename Type>
+bool insert_random_test ( std::uint64_t const seed ) {
+    using podder_type = podder<Type>;
+    using size_type   = typename podder_type::size_type;
+    std::mt19937_64 gen ( seed );
+    podder_type p;
+    std::vector<Type> v;
+    for ( int i = 0; i < 20'000; ++i ) {
+        std::size_t const at    = v.size ( ) ? gen ( ) % ( v.size ( ) + 1u ) : 0u;
+        std::size_t const count = gen ( ) % 4u ? gen ( ) % 6u : gen ( ) % 70u;
+        std::vector<Type> values ( count );
+        for ( Type & x : values )
+            x = make<Type> ( gen ( ) );
+        std::size_t index = at;
+        switch ( gen ( ) % 8u ) {
+            case 0: { // count copies of a value.
+                Type const x = make<Type> ( gen ( ) );
+                index        = static_cast<std::size_t> (
+                    p.insert ( p.begin ( ) + at, static_cast<size_type> ( count ), x ) - p.begin ( ) );
+                v.insert ( v.begin ( ) + at, count, x );
+            } break;
+            case 1: // count copies of a value in the podder.
+                if ( v.size ( ) ) {
+                    std::size_t const j = gen ( ) % v.size ( );
+                    Type const x        = v[ j ];
+                    index               = static_cast<std::size_t> (
+                        p.insert ( p.begin ( ) + at, static_cast<size_type> ( count ), p[ j ] ) - p.begin ( ) );
+                    v.insert ( v.begin ( ) + at, count, x );
+                }
+                break;
+            case 2: // a range.
+                index = static_cast<std::size_t> (
+                    p.insert ( p.begin ( ) + at, values.data ( ), static_cast<size_type> ( count ) ) - p.begin ( ) );
+                v.insert ( v.begin ( ) + at, values.begin ( ), values.end ( ) );
+                break;
+            case 3: // a range of the podder itself.
+                if ( v.size ( ) ) {
+                    std::size_t const j = gen ( ) % v.size ( ), n = std::min ( count, v.size ( ) - j );
+                    std::vector<Type> const x ( v.begin ( ) + j, v.begin ( ) + j + n );
+                    index = static_cast<std::size_t> (
+                        p.insert ( p.begin ( ) + at, p.data ( ) + j, static_cast<size_type> ( n ) ) - p.begin ( ) );
+                    v.insert ( v.begin ( ) + at, x.begin ( ), x.end ( ) );
+                }
+                break;
+            case 4: { // a discontiguous range.
+                std::list<Type> const l ( values.begin ( ), values.end ( ) );
+                index = static_cast<std::size_t> ( p.insert ( p.begin ( ) + at, l.begin ( ), l.end ( ) ) - p.begin ( ) );
+                v.insert ( v.begin ( ) + at, values.begin ( ), values.end ( ) );
+            } break;
+            case 5: { // a single value.
+                Type const x = make<Type> ( gen ( ) );
+                index        = static_cast<std::size_t> ( p.emplace ( p.begin ( ) + at, x ) - p.begin ( ) );
+                v.insert ( v.begin ( ) + at, x );
+            } break;
+            case 6: // into the offset mode.
+                for ( std::size_t k = gen ( ) % 8u; k and v.size ( ); --k )
+                    p.pop_front ( ), v.erase ( v.begin ( ) );
+                break;
+            default:
+                if ( v.size ( ) > 300u or gen ( ) % 32u == 0u ) {
+                    std::size_t const n = gen ( ) % 30u;
+                    p.resize ( static_cast<size_type> ( n ) ), v.resize ( n );
+                    if ( gen ( ) % 2u )
+                        p.skrink_to_fit ( ); // back into the svo buffer, or to a full block.
+                }
+        }
+        if ( index != at or not same ( p, v ) )
+            return false;
+    }
+    return true;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = insert_random_test<std::uint8_t> ( 1u ) and ok;
+    ok      = insert_random_test<std::uint16_t> ( 2u ) and ok;
+    ok      = insert_random_test<std::uint64_t> ( 3u ) and ok;
+    ok      = insert_random_test<quad> ( 4u ) and ok;
+    std::printf ( "insert: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,100 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/interner.hpp"
+
+// the interner against a std::map from contents to handle, handles are dense, in order of first interning.
+
+template<typename Type>
+bool interner_random_test ( std::uint64_t const seed ) {
+    std::mt19937_64 gen ( seed );
+    pdr::interner<Type> pool;
+    std::map<std::vector<Type>, std::uint32_t> reference;
+    std::vector<std::vector<Type> const *> by_handle;
+    for ( int i = 0; i < 50'000; ++i ) {
+        std::vector<Type> v ( gen ( ) % 12u );
+        for ( Type & x : v )
+            x = static_cast<Type> ( gen ( ) % 3u );
+        auto const it = reference.find ( v );
+        auto const f  = pool.find ( v );
+        if ( ( it == reference.end ( ) ) != not f.has_value ( ) or ( f and *f != it->second ) )
+            return false;
+        if ( gen ( ) % 2u ) {
+            std::uint32_t const h = pool.intern ( v.data ( ), v.size ( ) );
+            if ( it == reference.end ( ) ) {
+                if ( h != by_handle.size ( ) )
+                    return false;
+                by_handle.push_back ( &reference.emplace ( v, h ).first->first );
+            }
+            else if ( h != it->second ) {
+                return false;
+            }
+        }
+    }
+    if ( pool.size ( ) != reference.size ( ) )
+        return false;
+    for ( std::uint32_t h = 0; h < by_handle.size ( ); ++h ) {
+        typename pdr::interner<Type>::view const w = pool[ h ];
+        if ( w.size ( ) != by_handle[ h ]->size ( ) or not std::equal ( w.begin ( ), w.end ( ), by_handle[ h ]->begin ( ) ) )
+            return false;
+    }
+    return true;
+}
+
+bool interner_containers_test ( ) {
+    pdr::interner<char> pool;
+    std::string const a ( "interned" ), b ( "interned" ), c ( "another" ), e;
+    std::uint32_t const ha = pool.intern ( a ), hb = pool.intern ( b ), hc = pool.intern ( c ), he = pool.intern ( e );
+    std::vector<char> const v ( c.begin ( ), c.end ( ) );
+    bool ok = ha == hb and ha != hc and he != ha and pool.size ( ) == 3u and pool.find ( v ) == hc and pool[ he ].empty ( ) and
+              not pool.find ( std::string ( "interne" ) ) and pool[ hc ].to_podder ( ) == podder<char> ( c.data ( ), 7u );
+    pool.clear ( );
+    ok = ok and pool.empty ( ) and not pool.find ( a );
+    return ok and pool.intern ( c ) == 0u and pool.intern ( a ) == 1u and
+           std::string ( pool[ 1 ].begin ( ), pool[ 1 ].end ( ) ) == a;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = interner_random_test<std::uint8_t> ( 1u ) and ok;
+    ok      = interner_random_test<std::uint32_t> ( 2u ) and ok;
+    ok      = interner_random_test<std::uint64_t> ( 3u ) and ok;
+    ok      = interner_containers_test ( ) and ok;
+    std::printf ( "interner: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
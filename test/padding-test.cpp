@@ -0,0 +1,166 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#if defined( __GLIBC__ )
+#    include <malloc.h>
+#endif
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+
+// padded podders against std::vector, and the TailPadding bytes past capacity ( ) readable (which asan checks,
+// and malloc_usable_size, where there is one) over growth, realloc, reserve, shrink, copies, moves and the zeroing
+// paths. A sum that reads in whole 64 byte chunks, i.e. past size ( ) into the padding, against std::accumulate.
+
+template<typename Podder>
+bool padded ( Podder const & p ) {
+    using value_type = typename Podder::value_type;
+    if ( not p.holds_block ( ) )
+        return p.size ( ) == 0u;
+    unsigned char const * const b = reinterpret_cast<unsigned char const *> ( p.data ( ) );
+    std::size_t const readable    = p.capacity ( ) * sizeof ( value_type ) + Podder::tail_padding ( );
+    unsigned char volatile sink   = 0;
+    for ( std::size_t i = p.size ( ) * sizeof ( value_type ); i < readable; ++i )
+        sink = sink ^ b[ i ];
+#if defined( __GLIBC__ )
+    if ( not p.is_offset ( ) ) // data ( ) is the block.
+        return malloc_usable_size ( const_cast<unsigned char *> ( b ) ) >= readable;
+#endif
+    return true;
+}
+
+// a kernel without a scalar epilogue, full chunks of 64 bytes, the values past size ( ) are masked off.
+template<typename Podder>
+std::uint64_t chunked_sum ( Podder const & p ) {
+    using value_type                = typename Podder::value_type;
+    constexpr std::size_t per_chunk = 64u / sizeof ( value_type );
+    std::uint64_t sum               = 0;
+    for ( std::size_t i = 0; i < p.size ( ); i += per_chunk ) {
+        value_type chunk[ per_chunk ];
+        std::memcpy ( chunk, p.data ( ) + i, sizeof ( chunk ) ); // reads past size ( ) in the last chunk.
+        for ( std::size_t j = 0; j < per_chunk; ++j )
+            sum += i + j < p.size ( ) ? chunk[ j ] : value_type{ 0 };
+    }
+    return sum;
+}
+
+template<typename Type, std::size_t Alignment>
+bool padding_random_test ( std::uint64_t const seed ) {
+    using podder_type = podder<Type, std::size_t, visual_studio_growth_policy<std::size_t>, Alignment, 64u>;
+    static_assert ( not podder_type::svo ( ) and podder_type::tail_padding ( ) == 64u );
+    std::mt19937_64 gen ( seed );
+    podder_type p;
+    std::vector<Type> v;
+    for ( int i = 0; i < 20'000; ++i ) {
+        std::size_t const n = gen ( ) % ( gen ( ) % 4u ? 100u : 20'000u );
+        Type const x        = static_cast<Type> ( gen ( ) );
+        switch ( gen ( ) % 14u ) {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+                p.push_back ( x ), v.push_back ( x );
+                break;
+            case 4: {
+                std::vector<Type> values ( 1u + gen ( ) % 50u );
+                for ( Type & y : values )
+                    y = static_cast<Type> ( gen ( ) );
+                std::size_t const at = gen ( ) % ( v.size ( ) + 1u );
+                p.insert ( p.begin ( ) + at, values.begin ( ), values.end ( ) );
+                v.insert ( v.begin ( ) + at, values.begin ( ), values.end ( ) );
+            } break;
+            case 5:
+                p.resize ( n ), v.resize ( n );
+                break;
+            case 6:
+                p.reserve ( n );
+                break;
+            case 7:
+                p.skrink_to_fit ( );
+                break;
+            case 8: { // copies, a new block.
+                podder_type const q = p;
+                if ( not padded ( q ) )
+                    return false;
+                podder_type r;
+                r = q;
+                p = std::move ( r );
+            } break;
+            case 9: // fresh zeroed blocks.
+                if ( gen ( ) % 2u )
+                    p = podder_type ( n ), v.assign ( n, Type{ } );
+                else
+                    p.assign ( n, Type{ } ), v.assign ( n, Type{ } );
+                break;
+            case 10:
+                p.assign ( n, x ), v.assign ( n, x );
+                break;
+            case 11: // the offset mode, capacity ( ) counts from begin ( ).
+                if ( v.size ( ) )
+                    p.pop_front ( ), v.erase ( v.begin ( ) );
+                break;
+            case 12: // from an unpadded podder, the values are copied.
+                if ( v.size ( ) ) {
+                    podder<Type> u ( p.data ( ), p.size ( ) );
+                    p = podder_type ( std::move ( u ) );
+                }
+                break;
+            default:
+                if ( gen ( ) % 32u == 0u )
+                    p.clear ( ), v.clear ( );
+                else if ( v.size ( ) )
+                    p.pop_back ( ), v.pop_back ( );
+        }
+        if ( p.size ( ) != v.size ( ) or not std::equal ( v.begin ( ), v.end ( ), p.begin ( ) ) or not padded ( p ) )
+            return false;
+        if ( i % 16 == 0 and chunked_sum ( p ) != std::accumulate ( v.begin ( ), v.end ( ), std::uint64_t{ 0 } ) )
+            return false;
+    }
+    return true;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = padding_random_test<std::uint8_t, 0u> ( 1u ) and ok;
+    ok      = padding_random_test<std::uint32_t, 0u> ( 2u ) and ok;
+    ok      = padding_random_test<std::uint64_t, 0u> ( 3u ) and ok;
+    ok      = padding_random_test<std::uint16_t, 64u> ( 4u ) and ok;
+    ok      = padding_random_test<std::uint32_t, 32u> ( 5u ) and ok;
+    std::printf ( "padding: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
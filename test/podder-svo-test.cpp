@@ -0,0 +1,271 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// with assertions, podder's own invariants (a medium block holds more than the svo buffer) are checked as well.
+#undef NDEBUG
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder.hpp"
+
+// the svo model (small, medium and the no_svo types), against std::vector.
+
+template<typename Podder>
+bool same ( Podder const & p, std::vector<typename Podder::value_type> const & v ) {
+    return p.size ( ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), p.begin ( ) );
+}
+
+bool podder_skrink_to_fit_test ( ) {
+    podder<std::uint8_t> p;
+    for ( int i = 0; i < 60; ++i )
+        p.push_back ( static_cast<std::uint8_t> ( i ) );
+    p.resize ( 12 );
+    p.skrink_to_fit ( );
+    bool ok = p.svo_model ( ) == podder<std::uint8_t>::svo_type::small;
+    p.push_back ( 12 ); // asserted on a medium block of 12.
+    for ( int i = 0; i < 13; ++i )
+        ok = ok and p[ i ] == i;
+    return ok;
+}
+
+bool podder_copy_offset_test ( ) {
+    podder<std::uint32_t> p;
+    for ( std::uint32_t i = 0; i < 100; ++i )
+        p.push_back ( i );
+    for ( int i = 0; i < 95; ++i ) // the offset mode, capacity ( ) is what's left past the head.
+        p.pop_front ( );
+    podder<std::uint32_t> q ( p );
+    bool ok = q.svo_model ( ) == podder<std::uint32_t>::svo_type::small and q.size ( ) == 5u and q[ 0 ] == 95u;
+    for ( int i = 0; i < 40; ++i )
+        p.pop_front ( ); // not small, size 0, in the offset mode.
+    podder<std::uint32_t> r ( p );
+    ok = ok and r.empty ( );
+    r.push_back ( 1u );
+    return ok and r.size ( ) == 1u;
+}
+
+// random edits, copies and shrinks against a std::vector.
+template<typename Type>
+bool podder_random_copy_shrink_test ( std::uint64_t const seed ) {
+    std::mt19937_64 gen ( seed );
+    podder<Type> p;
+    std::vector<Type> v;
+    for ( int i = 0; i < 100'000; ++i ) {
+        Type const x = static_cast<Type> ( gen ( ) );
+        switch ( gen ( ) % 8u ) {
+            case 0:
+            case 1: p.push_back ( x ), v.push_back ( x ); break;
+            case 2:
+                if ( v.size ( ) )
+                    p.pop_front ( ), v.erase ( v.begin ( ) );
+                break;
+            case 3:
+                if ( v.size ( ) )
+                    p.pop_back ( ), v.pop_back ( );
+                break;
+            case 4: {
+                std::size_t const n = gen ( ) % 64u;
+                p.resize ( static_cast<typename podder<Type>::size_type> ( n ) ), v.resize ( n );
+            } break;
+            case 5: p.skrink_to_fit ( ); break;
+            case 6: {
+                podder<Type> q ( p );
+                p.swap ( q );
+            } break;
+            default: p.push_front ( x ), v.insert ( v.begin ( ), x );
+        }
+        if ( not same ( p, v ) )
+            return false;
+    }
+    return true;
+}
+
+// regressions, the bugs the benchmark suite ran into.
+
+struct quad { // too big for an svo buffer, i.e. a no_svo podder.
+    std::uint64_t v[ 4 ];
+    [[nodiscard]] bool operator== ( quad const & o ) const noexcept { return std::equal ( v, v + 4, o.v ); }
+};
+
+bool podder_no_svo_clear_test ( ) {
+    podder<quad> p; // small_clear ( ), the unallocated medium state.
+    bool ok = p.empty ( ) and p.capacity ( ) == 0u;
+    podder<quad> q ( p );
+    ok = ok and q.empty ( );
+    q.push_back ( quad{ { 1, 2, 3, 4 } } );
+    p.push_back ( quad{ { 5, 6, 7, 8 } } );
+    p.clear ( );
+    p.push_back ( quad{ { 9, 10, 11, 12 } } );
+    return ok and q.size ( ) == 1u and q[ 0 ].v[ 3 ] == 4u and p.size ( ) == 1u and p[ 0 ].v[ 0 ] == 9u;
+}
+
+bool podder_copy_assign_test ( ) {
+    podder<std::uint8_t> p, q;
+    for ( int i = 0; i < 40; ++i )
+        p.push_back ( static_cast<std::uint8_t> ( i ) );
+    p.resize ( 5 ); // medium, of small size.
+    q = p;          // copied the block pointer.
+    p.clear ( );
+    p.skrink_to_fit ( );
+    p.push_back ( 100 );
+    bool ok = q.svo_model ( ) == podder<std::uint8_t>::svo_type::small and q.size ( ) == 5u;
+    for ( int i = 0; i < 5; ++i )
+        ok = ok and q[ i ] == i;
+    podder<std::uint8_t> const & r = q;
+    q                               = r; // self-assignment.
+    return ok and q.size ( ) == 5u and q[ 4 ] == 4u;
+}
+
+bool podder_no_svo_reserve_test ( ) {
+    podder<quad> p;
+    p.reserve ( 10 ); // set the size.
+    bool ok = p.empty ( ) and p.capacity ( ) >= 10u;
+    p.push_back ( quad{ { 1, 2, 3, 4 } } );
+    return ok and p.size ( ) == 1u and p[ 0 ].v[ 1 ] == 2u;
+}
+
+template<typename Type>
+[[nodiscard]] Type make ( std::size_t const i ) noexcept {
+    if constexpr ( std::is_arithmetic<Type>::value )
+        return static_cast<Type> ( i );
+    else
+        return Type{ { i, i + 1u, i + 2u, i + 3u } };
+}
+
+template<typename Type>
+bool podder_emplace_erase_test ( ) {
+    bool ok = true;
+    for ( std::size_t n = 0; n < 80; ++n ) { // through full small and full (size == capacity) medium podders.
+        for ( std::size_t i = 0; i <= n; ++i ) {
+            podder<Type> p;
+            std::vector<Type> v;
+            for ( std::size_t j = 0; j < n; ++j )
+                p.push_back ( make<Type> ( j ) ), v.push_back ( make<Type> ( j ) );
+            p.emplace ( p.begin ( ) + i, make<Type> ( 200u ) ); // put the value at the end, relocated one too many.
+            v.insert ( v.begin ( ) + static_cast<std::ptrdiff_t> ( i ), make<Type> ( 200u ) );
+            ok = ok and same ( p, v );
+            p.erase ( p.begin ( ) + i ); // moved one value from past the end.
+            v.erase ( v.begin ( ) + static_cast<std::ptrdiff_t> ( i ) );
+            ok = ok and same ( p, v );
+            if ( n ) {
+                p.unchecked_unordered_erase ( p.begin ( ) ); // small podders decremented the medium size.
+                v.front ( ) = v.back ( ), v.pop_back ( );
+                ok = ok and same ( p, v );
+            }
+        }
+    }
+    return ok;
+}
+
+bool podder_resize_test ( ) {
+    podder<std::uint32_t> p; // small, grow (constructed against the new size, i.e. not at all).
+    p.push_back ( 7u );
+    p.resize ( 3 );
+    bool ok = p.size ( ) == 3u and p[ 0 ] == 7u and p[ 1 ] == 0u and p[ 2 ] == 0u;
+    p.resize ( 30 ); // to medium.
+    ok = ok and p.size ( ) == 30u and p[ 0 ] == 7u and std::all_of ( p.begin ( ) + 1, p.end ( ), [] ( auto x ) { return x == 0u; } );
+    podder<quad> q; // no_svo, unallocated and relocated.
+    q.resize ( 3 );
+    q[ 2 ].v[ 0 ] = 5u;
+    q.resize ( 50 );
+    ok = ok and q.size ( ) == 50u and q[ 2 ].v[ 0 ] == 5u and q[ 49 ] == quad{ };
+    return ok;
+}
+
+// multi-value inserts of more values than a medium podder has room for (it wrote past the block).
+
+template<typename Type>
+bool podder_insert_past_capacity_test ( ) {
+    bool ok = true;
+    for ( std::size_t n = 30; n < 70; ++n ) {
+        for ( int how = 0; how < 4; ++how ) {
+            podder<Type> p;
+            std::vector<Type> v;
+            for ( std::size_t j = 0; j < n; ++j )
+                p.push_back ( make<Type> ( j ) ), v.push_back ( make<Type> ( j ) );
+            std::size_t const count = static_cast<std::size_t> ( p.capacity ( ) - p.size ( ) ) + 3u, i = n / 3u;
+            std::vector<Type> const values ( count, make<Type> ( 500u ) );
+            auto const pos = p.begin ( ) + i;
+            switch ( how ) {
+                case 0: p.insert ( pos, static_cast<typename podder<Type>::size_type> ( count ), values[ 0 ] ); break;
+                case 1: p.insert ( pos, values.data ( ), static_cast<typename podder<Type>::size_type> ( count ) ); break;
+                case 2: p.insert ( pos, values.begin ( ), values.end ( ) ); break;
+                default: p.insert ( pos, values.data ( ), values.data ( ) + count );
+            }
+            v.insert ( v.begin ( ) + static_cast<std::ptrdiff_t> ( i ), values.begin ( ), values.end ( ) );
+            ok = ok and same ( p, v );
+        }
+    }
+    return ok;
+}
+
+bool podder_const_access_test ( ) {
+    podder<std::uint32_t> p;
+    for ( std::uint32_t i = 0; i < 40; ++i )
+        p.push_back ( i );
+    podder<std::uint32_t> const & c = p;
+    bool ok                         = c[ 3 ] == 3u and c.at ( 39 ) == 39u;
+    try {
+        (void) c.at ( 40 );
+        ok = false;
+    }
+    catch ( std::out_of_range const & ) {
+    }
+    podder<std::uint8_t> const s ( 3, 7 ); // small.
+    return ok and s[ 2 ] == 7u and s.at ( 0 ) == 7u;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = podder_skrink_to_fit_test ( ) and ok;
+    ok      = podder_copy_offset_test ( ) and ok;
+    ok      = podder_random_copy_shrink_test<std::uint8_t> ( 1u ) and ok;
+    ok      = podder_random_copy_shrink_test<std::uint32_t> ( 2u ) and ok;
+    ok      = podder_random_copy_shrink_test<double> ( 3u ) and ok;
+    ok      = podder_no_svo_clear_test ( ) and ok;
+    ok      = podder_copy_assign_test ( ) and ok;
+    ok      = podder_no_svo_reserve_test ( ) and ok;
+    ok      = podder_emplace_erase_test<std::uint8_t> ( ) and ok;
+    ok      = podder_emplace_erase_test<std::uint64_t> ( ) and ok;
+    ok      = podder_emplace_erase_test<quad> ( ) and ok;
+    ok      = podder_resize_test ( ) and ok;
+    ok      = podder_insert_past_capacity_test<std::uint8_t> ( ) and ok;
+    ok      = podder_insert_past_capacity_test<std::uint32_t> ( ) and ok;
+    ok      = podder_insert_past_capacity_test<quad> ( ) and ok;
+    ok      = podder_const_access_test ( ) and ok;
+    std::printf ( "podder svo: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
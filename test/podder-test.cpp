@@ -51,15 +51,7 @@
 #include <sax/uniform_int_distribution.hpp>
 
 #include "podder.hpp"
-
-template<typename T, typename = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
-std::uint64_t sum ( podder<T> & p ) noexcept {
-    std::uint64_t sum = 0;
-    for ( auto v : p ) {
-        sum += static_cast<std::uint64_t> ( v );
-    }
-    return sum;
-}
+#include "podder/reduce.hpp"
 
 template<typename T, typename = std::enable_if_t<std::conjunction_v<std::is_integral<T>, std::is_unsigned<T>>>>
 constexpr T sum2n ( const T n_ ) noexcept {
@@ -88,7 +80,7 @@ bool podder_emplace_back_type_test ( std::size_t x ) { // test emplace_back.
     std::uint64_t b = 0;
 
     for ( auto v : vv ) {
-        b += sum ( v );
+        b += pdr::sum ( v );
     }
 
     return a == b;
@@ -0,0 +1,197 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+#define PODDER_PROFILE true
+
+#include "podder.hpp"
+#include "podder/profile_report.hpp"
+
+// the recorded histograms against the sizes and relocations the test counted itself.
+
+using histogram_type = std::map<std::uint64_t, std::uint64_t>;
+
+// the representative of the bucket of v, exact up to 63, the midpoint of [ 2^k, 2^(k+1) ) from 64 up.
+std::uint64_t representative ( std::uint64_t const v ) {
+    if ( v < 64u )
+        return v;
+    std::uint64_t lo = 64u;
+    while ( lo * 2u <= v )
+        lo *= 2u;
+    return lo + lo / 2u;
+}
+
+template<typename Type>
+struct reference {
+    histogram_type sizes, relocations;
+
+    // pushes size values, counts the relocations (capacity changes) as emplace_back makes them.
+    void record ( podder<Type> & p, std::uint64_t const size ) {
+        std::uint64_t relocated = 0u;
+        for ( std::uint64_t i = 0; i < size; ++i ) {
+            auto const capacity = p.capacity ( );
+            p.push_back ( static_cast<Type> ( i ) );
+            relocated += p.capacity ( ) != capacity;
+        }
+        ++sizes[ representative ( size ) ];
+        ++relocations[ representative ( relocated ) ];
+    }
+};
+
+histogram_type to_map ( std::vector<std::pair<std::uint64_t, std::uint64_t>> const & pairs ) {
+    return histogram_type ( pairs.begin ( ), pairs.end ( ) );
+}
+
+pdr::profile::entry const * find ( std::vector<pdr::profile::entry> const & es, std::string const & tag,
+                                  std::size_t const value_size ) {
+    for ( pdr::profile::entry const & e : es )
+        if ( e.tag == tag and e.value_size == value_size )
+            return &e;
+    return nullptr;
+}
+
+bool profile_sizes_test ( ) {
+    pdr::profile::reset ( );
+    reference<std::uint32_t> r32;
+    reference<std::uint8_t> r8;
+    {
+        pdr::profile::scope const scope ( "sizes" );
+        for ( std::uint64_t size : { 0u, 1u, 3u, 5u, 5u, 17u, 63u, 64u, 100u, 1'000u, 5'000u } ) {
+            podder<std::uint32_t> p;
+            r32.record ( p, size );
+        }
+        for ( std::uint64_t size : { 2u, 2u, 20u, 200u } ) {
+            podder<std::uint8_t> p;
+            r8.record ( p, size );
+        }
+        podder<std::uint8_t> p;
+        r8.record ( p, 9u );
+        p.clear ( ); // records 9, and starts over.
+        ++r8.sizes[ 0u ], ++r8.relocations[ 0u ]; // the empty podder, at destruction.
+    }
+    std::vector<pdr::profile::entry> const es = pdr::profile::entries ( );
+    pdr::profile::entry const * const e32     = find ( es, "sizes", sizeof ( std::uint32_t ) );
+    pdr::profile::entry const * const e8      = find ( es, "sizes", sizeof ( std::uint8_t ) );
+    return es.size ( ) == 2u and e32 and e8 and e32->svo_capacity == podder<std::uint32_t>::svo_capacity ( ) and
+           e8->svo_capacity == podder<std::uint8_t>::svo_capacity ( ) and to_map ( e32->sizes ) == r32.sizes and
+           to_map ( e32->relocations ) == r32.relocations and to_map ( e8->sizes ) == r8.sizes and
+           to_map ( e8->relocations ) == r8.relocations and e32->samples ( ) == 11u and e8->samples ( ) == 6u;
+}
+
+bool profile_move_test ( ) {
+    pdr::profile::reset ( );
+    {
+        pdr::profile::scope const scope ( "move" );
+        podder<std::uint64_t> p;
+        for ( std::uint64_t i = 0; i < 10u; ++i )
+            p.push_back ( i );
+        podder<std::uint64_t> q ( std::move ( p ) ); // p, empty and moved-from, isn't recorded.
+    }
+    std::vector<pdr::profile::entry> const es = pdr::profile::entries ( );
+    pdr::profile::entry const * const e       = find ( es, "move", sizeof ( std::uint64_t ) );
+    return es.size ( ) == 1u and e and to_map ( e->sizes ) == histogram_type{ { 10u, 1u } };
+}
+
+// the same tag (by value) on different threads, and a nested scope.
+bool profile_threads_test ( ) {
+    pdr::profile::reset ( );
+    std::string const tag ( "threads" ); // different pointers, merged by value.
+    std::vector<std::string> tags ( 4, tag );
+    std::vector<std::thread> threads;
+    for ( std::size_t t = 0; t < tags.size ( ); ++t )
+        threads.emplace_back ( [ &tags, t ] ( ) {
+            pdr::profile::scope const scope ( tags[ t ].c_str ( ) );
+            for ( std::uint64_t i = 0; i < 100u; ++i ) {
+                podder<std::uint16_t> p ( static_cast<podder<std::uint16_t>::size_type> ( i % 8u ), std::uint16_t{ 1 } );
+                pdr::profile::scope const inner ( "inner" );
+                podder<std::uint16_t> q ( 1, std::uint16_t{ 1 } );
+            }
+        } );
+    for ( std::thread & t : threads )
+        t.join ( );
+    {
+        pdr::profile::scope const scope ( tag.c_str ( ) ); // and a live shard, of this thread.
+        podder<std::uint16_t> p ( 3, std::uint16_t{ 1 } );
+    }
+    histogram_type sizes;
+    for ( std::uint64_t i = 0; i < 100u; ++i )
+        sizes[ i % 8u ] += 4u;
+    ++sizes[ 3u ];
+    std::vector<pdr::profile::entry> const es = pdr::profile::entries ( );
+    pdr::profile::entry const * const e       = find ( es, tag, sizeof ( std::uint16_t ) );
+    pdr::profile::entry const * const inner   = find ( es, "inner", sizeof ( std::uint16_t ) );
+    return es.size ( ) == 2u and e and inner and to_map ( e->sizes ) == sizes and
+           to_map ( inner->sizes ) == histogram_type{ { 1u, 400u } };
+}
+
+bool profile_dump_read_test ( ) {
+    pdr::profile::entry e;
+    e.tag          = "a tag:with separators";
+    e.value_size   = 4u;
+    e.svo_capacity = 5u;
+    e.sizes        = { { 1u, 10u }, { 3u, 2u }, { 96u, 7u } };
+    e.relocations  = { { 0u, 12u }, { 4u, 7u } };
+    std::stringstream s;
+    pdr::profile::dump ( s, { e } );
+    std::vector<pdr::profile::entry> const es = pdr::profile::read ( s );
+    return es.size ( ) == 1u and es[ 0 ].tag == "a_tag_with_separators" and es[ 0 ].value_size == e.value_size and
+           es[ 0 ].svo_capacity == e.svo_capacity and es[ 0 ].sizes == e.sizes and es[ 0 ].relocations == e.relocations;
+}
+
+bool profile_recommend_test ( ) {
+    pdr::profile::entry e;
+    e.tag          = "recommend";
+    e.value_size   = 4u;
+    e.svo_capacity = 5u;
+    e.sizes        = { { 2u, 50u }, { 5u, 30u }, { 8u, 15u }, { 96u, 5u } }; // 100 samples.
+    e.relocations  = { { 0u, 80u }, { 1u, 15u }, { 6u, 5u } };
+    pdr::profile::recommendation const r = pdr::profile::recommend ( e, 0.9 );
+    // 80 of 100 fit in 5, 90% is covered at 8, ( 15 + 30 ) / 100 relocations per podder.
+    return r.samples == 100u and r.svo_hit_rate == 0.8 and r.inline_capacity == 8u and r.inline_bytes == 32u and
+           r.mean_relocations == 0.45;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = profile_sizes_test ( ) and ok;
+    ok      = profile_move_test ( ) and ok;
+    ok      = profile_threads_test ( ) and ok;
+    ok      = profile_dump_read_test ( ) and ok;
+    ok      = profile_recommend_test ( ) and ok;
+    std::printf ( "profile: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,183 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/pstring.hpp"
+
+// pstring against std::string, the searches at every position, over strings from a small alphabet (lots of partial
+// matches) and of lengths across the 16 and 32 byte vectors.
+
+std::string random_string ( std::mt19937_64 & gen, std::size_t const size, char const * alphabet = "abc" ) {
+    std::size_t const n = std::char_traits<char>::length ( alphabet );
+    std::string s ( size, ' ' );
+    for ( char & c : s )
+        c = alphabet[ gen ( ) % n ];
+    return s;
+}
+
+bool pstring_search_test ( ) {
+    std::mt19937_64 gen ( 1u );
+    for ( int i = 0; i < 400; ++i ) {
+        std::string const s = random_string ( gen, gen ( ) % 100u );
+        pdr::pstring const p ( s );
+        for ( int j = 0; j < 8; ++j ) {
+            std::string const n = random_string ( gen, gen ( ) % 5u );
+            char const c        = "abcd"[ gen ( ) % 4u ];
+            for ( std::size_t pos = 0; pos <= s.size ( ) + 1u; ++pos ) {
+                if ( p.find ( n, pos ) != s.find ( n, pos ) or p.rfind ( n, pos ) != s.rfind ( n, pos ) or
+                     p.find ( c, pos ) != s.find ( c, pos ) or p.rfind ( c, pos ) != s.rfind ( c, pos ) )
+                    return false;
+            }
+            if ( p.find ( n ) != s.find ( n ) or p.rfind ( n ) != s.rfind ( n ) or p.rfind ( c ) != s.rfind ( c ) or
+                 p.contains ( n ) != ( s.find ( n ) != std::string::npos ) or
+                 p.starts_with ( n ) != ( s.compare ( 0, n.size ( ), n ) == 0 and n.size ( ) <= s.size ( ) ) or
+                 p.ends_with ( n ) != ( n.size ( ) <= s.size ( ) and s.compare ( s.size ( ) - n.size ( ), n.size ( ), n ) == 0 ) )
+                return false;
+        }
+    }
+    return true;
+}
+
+// a needle at every offset of a long haystack, found by the vector loops and the scalar tails.
+bool find_bytes_test ( ) {
+    std::mt19937_64 gen ( 2u );
+    std::string h = random_string ( gen, 300u, "ab" );
+    for ( std::size_t n_size : { 1u, 2u, 3u, 17u, 33u } ) {
+        for ( std::size_t at = 0; at + n_size <= h.size ( ); at += 3u ) {
+            std::string const n = random_string ( gen, n_size, "xyz" );
+            std::string s       = h;
+            s.replace ( at, n_size, n );
+            if ( pdr::find_bytes ( s.data ( ), s.size ( ), n.data ( ), n.size ( ) ) != s.find ( n ) or
+                 pdr::rfind_bytes ( s.data ( ), s.size ( ), n.data ( ), n.size ( ) ) != s.rfind ( n ) or
+                 pdr::find_byte ( s.data ( ), s.size ( ), static_cast<unsigned char> ( n[ 0 ] ) ) != s.find ( n[ 0 ] ) or
+                 pdr::rfind_byte ( s.data ( ), s.size ( ), static_cast<unsigned char> ( n.back ( ) ) ) != s.rfind ( n.back ( ) ) )
+                return false;
+        }
+    }
+    return pdr::find_byte ( h.data ( ), h.size ( ), 'z' ) == h.size ( ) and
+           pdr::rfind_byte ( h.data ( ), h.size ( ), 'z' ) == h.size ( );
+}
+
+// edits against std::string.
+bool pstring_modifiers_test ( ) {
+    std::mt19937_64 gen ( 3u );
+    pdr::pstring p;
+    std::string s;
+    for ( int i = 0; i < 20'000; ++i ) {
+        switch ( gen ( ) % 6u ) {
+            case 0: {
+                std::string const a = random_string ( gen, gen ( ) % 40u );
+                p.append ( a ), s.append ( a );
+            } break;
+            case 1: {
+                char const c = "xyz"[ gen ( ) % 3u ];
+                p += c, s += c;
+            } break;
+            case 2:
+                if ( s.size ( ) )
+                    p.pop_back ( ), s.pop_back ( );
+                break;
+            case 3: {
+                std::size_t const n = gen ( ) % 80u;
+                p.resize ( n, '-' ), s.resize ( n, '-' );
+            } break;
+            case 4: {
+                std::size_t const n = gen ( ) % 5u;
+                p.append ( n, '+' ), s.append ( n, '+' );
+            } break;
+            default:
+                if ( gen ( ) % 8u == 0u )
+                    p.clear ( ), s.clear ( );
+        }
+        std::size_t const pos = gen ( ) % ( s.size ( ) + 2u );
+        if ( p.view ( ) != s or p.str ( ) != s or p.size ( ) != s.size ( ) or
+             p.substr ( pos, 7u ) != std::string_view ( s ).substr ( std::min ( pos, s.size ( ) ), 7u ) )
+            return false;
+    }
+    return true;
+}
+
+bool pstring_split_test ( ) {
+    std::mt19937_64 gen ( 4u );
+    for ( int i = 0; i < 1'000; ++i ) {
+        std::string const s = random_string ( gen, gen ( ) % 60u, "ab," );
+        std::vector<std::string> fields;
+        std::size_t b = 0;
+        for ( std::size_t e; ( e = s.find ( ',', b ) ) != std::string::npos; b = e + 1u )
+            fields.push_back ( s.substr ( b, e - b ) );
+        fields.push_back ( s.substr ( b ) );
+        pdr::pstring const p ( s );
+        podder<std::string_view> const views = p.split ( ',' );
+        std::size_t f                        = 0;
+        p.split ( ',', [ &f, &fields ] ( std::string_view const sv ) { f += f < fields.size ( ) and sv == fields[ f ]; } );
+        if ( views.size ( ) != fields.size ( ) or f != fields.size ( ) )
+            return false;
+        for ( f = 0; f < fields.size ( ); ++f )
+            if ( views[ f ] != fields[ f ] )
+                return false;
+    }
+    return true;
+}
+
+bool pstring_compare_test ( ) {
+    std::mt19937_64 gen ( 5u );
+    for ( int i = 0; i < 20'000; ++i ) {
+        std::string const a = random_string ( gen, gen ( ) % 6u ), b = random_string ( gen, gen ( ) % 6u );
+        pdr::pstring const p ( a ), q ( b );
+        int const c = a.compare ( b );
+        if ( ( p == q ) != ( a == b ) or ( p != q ) != ( a != b ) or ( p < q ) != ( a < b ) or ( p > q ) != ( a > b ) or
+             ( p <= q ) != ( a <= b ) or ( p >= q ) != ( a >= b ) or ( p.compare ( b ) < 0 ) != ( c < 0 ) or
+             ( p.compare ( b ) > 0 ) != ( c > 0 ) or ( p == std::string_view ( b ) ) != ( a == b ) )
+            return false;
+        if ( a == b and std::hash<pdr::pstring>{ }( p ) != std::hash<pdr::pstring>{ }( q ) )
+            return false;
+    }
+    std::ostringstream out;
+    out << pdr::pstring ( "a pstring, longer than the 23 inline chars" ) + "!";
+    return out.str ( ) == "a pstring, longer than the 23 inline chars!" and pdr::pstring::sso_capacity ( ) == 23u;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = pstring_search_test ( ) and ok;
+    ok      = find_bytes_test ( ) and ok;
+    ok      = pstring_modifiers_test ( ) and ok;
+    ok      = pstring_split_test ( ) and ok;
+    ok      = pstring_compare_test ( ) and ok;
+    std::printf ( "pstring: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,149 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/reduce.hpp"
+
+// the reductions against naive loops and std::min_element and friends, the integer sums and dot products past the
+// range of the narrow (32 bit) blocks they're summed in, and floating point values with NaNs (which are picked as
+// std::min_element and std::max_element pick them, i.e. only a NaN at the front sticks).
+
+// whole numbers, for the integers, and for floating point values if whole.
+template<typename Type>
+std::vector<Type> random_values ( std::size_t const n, std::uint64_t const seed, double const lo, double const hi,
+                                  bool const whole = false ) {
+    std::mt19937_64 gen ( seed );
+    std::uniform_real_distribution<double> dis ( lo, hi );
+    std::vector<Type> v ( n );
+    for ( Type & x : v )
+        x = static_cast<Type> ( whole or std::is_integral<Type>::value ? std::floor ( dis ( gen ) ) : dis ( gen ) );
+    return v;
+}
+
+// a and b are both NaN, or equal.
+template<typename Type>
+bool same ( Type const a, Type const b ) {
+    if constexpr ( std::is_floating_point<Type>::value ) {
+        if ( std::isnan ( a ) or std::isnan ( b ) )
+            return std::isnan ( a ) and std::isnan ( b );
+    }
+    return a == b;
+}
+
+template<typename Type>
+bool select_test ( double const lo, double const hi, std::uint64_t const seed ) {
+    bool ok = true;
+    for ( std::size_t n : { 1u, 2u, 7u, 8u, 31u, 32u, 33u, 64u, 65u, 255u, 256u, 257u, 1'000u, 100'003u } ) {
+        for ( double range : { 3.0, hi - lo } ) { // few values (many ties) and many.
+            std::vector<Type> v = random_values<Type> ( n, seed + n, lo, lo + range );
+            for ( int nans = 0; nans < ( std::is_floating_point<Type>::value ? 3 : 1 ); ++nans ) {
+                if ( nans ) { // somewhere, and then at the front as well.
+                    v[ n / 2u ] = std::numeric_limits<Type>::quiet_NaN ( );
+                    if ( nans == 2 )
+                        v[ 0 ] = std::numeric_limits<Type>::quiet_NaN ( );
+                }
+                auto const min_it = std::min_element ( v.begin ( ), v.end ( ) );
+                auto const max_it = std::max_element ( v.begin ( ), v.end ( ) );
+                Type const * const p = v.data ( );
+                auto const [ a, b ]  = pdr::minmax ( p, n );
+                ok = ok and same ( pdr::min ( p, n ), *min_it ) and same ( pdr::max ( p, n ), *max_it ) and same ( a, *min_it ) and
+                     same ( b, *max_it ) and same ( pdr::min ( v ), *min_it ) and same ( pdr::max ( v ), *max_it );
+                // the first smallest (largest), n for a NaN.
+                std::size_t const arg_min = *min_it == *min_it ? std::size_t ( min_it - v.begin ( ) ) : n;
+                std::size_t const arg_max = *max_it == *max_it ? std::size_t ( max_it - v.begin ( ) ) : n;
+                ok = ok and pdr::argmin ( p, n ) == arg_min and pdr::argmax ( p, n ) == arg_max and pdr::argmin ( v ) == arg_min and
+                     pdr::argmax ( v ) == arg_max;
+            }
+        }
+    }
+    Type const * const none = nullptr;
+    return ok and pdr::argmin ( none, 0u ) == 0u and pdr::argmax ( none, 0u ) == 0u;
+}
+
+// the sum and dot product, against a left to right loop in the (wide) result type.
+template<typename Type>
+bool sum_test ( double const lo, double const hi, std::uint64_t const seed ) {
+    using sum_type = pdr::detail::sum_type<Type>;
+    bool ok        = true;
+    for ( std::size_t n : { 0u, 1u, 7u, 8u, 33u, 1'000u, 100'003u } ) {
+        std::vector<Type> const a = random_values<Type> ( n, seed, lo, hi, true ),
+                                b = random_values<Type> ( n, seed + 1u, lo, hi, true );
+        sum_type s = 0, d = 0;
+        for ( std::size_t i = 0; i < n; ++i )
+            s += static_cast<sum_type> ( a[ i ] ), d += static_cast<sum_type> ( a[ i ] ) * static_cast<sum_type> ( b[ i ] );
+        ok = ok and pdr::sum ( a.data ( ), n ) == s and pdr::sum ( a ) == s and pdr::dot ( a.data ( ), b.data ( ), n ) == d and
+             pdr::dot ( a, b ) == d;
+    }
+    return ok;
+}
+
+// all the values at the extreme, the sums leave the range of the 32 bit blocks (and of Type).
+template<typename Type>
+bool overflow_test ( std::size_t const n, Type const x ) {
+    using sum_type = pdr::detail::sum_type<Type>;
+    std::vector<Type> const v ( n, x );
+    return pdr::sum ( v ) == static_cast<sum_type> ( n ) * static_cast<sum_type> ( x ) and
+           pdr::dot ( v, v ) == static_cast<sum_type> ( n ) * static_cast<sum_type> ( x ) * static_cast<sum_type> ( x );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = select_test<std::int8_t> ( -128.0, 128.0, 1u ) and ok;
+    ok      = select_test<std::uint16_t> ( 0.0, 65'536.0, 2u ) and ok;
+    ok      = select_test<std::int32_t> ( -1e9, 1e9, 3u ) and ok;
+    ok      = select_test<std::uint64_t> ( 0.0, 1e18, 4u ) and ok;
+    ok      = select_test<float> ( -1e3, 1e3, 5u ) and ok;
+    ok      = select_test<double> ( -1e6, 1e6, 6u ) and ok;
+    // integer valued floating point values, the sums are exact in any order.
+    ok = sum_test<std::uint8_t> ( 0.0, 256.0, 7u ) and ok;
+    ok = sum_test<std::int8_t> ( -128.0, 128.0, 8u ) and ok;
+    ok = sum_test<std::uint16_t> ( 0.0, 65'536.0, 9u ) and ok;
+    ok = sum_test<std::int16_t> ( -32'768.0, 32'768.0, 10u ) and ok;
+    ok = sum_test<std::int32_t> ( -1e5, 1e5, 11u ) and ok;
+    ok = sum_test<std::uint32_t> ( 0.0, 4e9, 12u ) and ok; // the dot products wrap, as the loop's.
+    ok = sum_test<float> ( -8.0, 8.0, 13u ) and ok; // partial sums below 2^24.
+    ok = sum_test<double> ( -1e4, 1e4, 14u ) and ok;
+    // more than a block of the narrow types, 2^22 bytes, 2^15 shorts and 2^16 byte products.
+    ok = overflow_test<std::uint8_t> ( 20'000'000u, 255u ) and ok;
+    ok = overflow_test<std::int8_t> ( 5'000'000u, -128 ) and ok;
+    ok = overflow_test<std::uint16_t> ( 100'000u, 65'535u ) and ok;
+    ok = overflow_test<std::int16_t> ( 100'000u, -32'768 ) and ok;
+    ok = overflow_test<std::int32_t> ( 10'000u, -2'000'000 ) and ok; // products past 32 bits.
+    std::printf ( "reduce: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
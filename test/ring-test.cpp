@@ -0,0 +1,113 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/ring.hpp"
+
+// producers push ( producer << 32 ) | i, for i in [ 0, n ), the consumer checks that every value arrives exactly
+// once, and in order per producer. The ring is small, so the indices wrap around many times.
+
+template<typename Ring>
+void produce ( Ring & r, std::uint64_t const producer, std::uint64_t const n, std::uint64_t const seed ) {
+    std::mt19937_64 gen ( seed );
+    std::uint64_t values[ 7 ];
+    for ( std::uint64_t i = 0; i < n; ) {
+        std::uint64_t pushed;
+        if ( gen ( ) % 2u ) {
+            pushed = r.try_push ( ( producer << 32 ) | i ) ? 1u : 0u;
+        }
+        else {
+            std::uint64_t const count = std::min<std::uint64_t> ( 1u + gen ( ) % 7u, n - i );
+            for ( std::uint64_t j = 0; j < count; ++j )
+                values[ j ] = ( producer << 32 ) | ( i + j );
+            pushed = r.push_n ( values, static_cast<typename Ring::size_type> ( count ) );
+        }
+        i += pushed;
+        if ( not pushed ) // the ring is full.
+            std::this_thread::yield ( );
+    }
+}
+
+template<typename Ring>
+bool consume ( Ring & r, std::size_t const producers, std::uint64_t const n ) {
+    std::vector<std::uint64_t> next ( producers, 0u );
+    std::uint64_t received = 0, values[ 5 ];
+    bool ok                = true;
+    std::mt19937_64 gen ( 7u );
+    while ( received < producers * n ) {
+        std::size_t popped = 0;
+        if ( gen ( ) % 2u ) {
+            if ( auto const v = r.try_pop ( ) ) {
+                values[ 0 ] = *v;
+                popped      = 1u;
+            }
+        }
+        else {
+            popped = r.pop_n ( values, 5u );
+        }
+        for ( std::size_t i = 0; i < popped; ++i ) {
+            std::uint64_t const p = values[ i ] >> 32, v = values[ i ] & 0xFFFF'FFFFu;
+            ok = ok and p < producers and v == next[ p ]++; // in order, i.e. none lost or duplicated.
+        }
+        received += popped;
+        if ( not popped ) // the ring is empty.
+            std::this_thread::yield ( );
+    }
+    return ok and r.empty ( ) and not r.try_pop ( );
+}
+
+template<typename Ring>
+bool ring_test ( std::size_t const producers, std::uint64_t const n, typename Ring::size_type const capacity ) {
+    Ring r ( capacity );
+    std::vector<std::thread> threads;
+    for ( std::size_t p = 0; p < producers; ++p )
+        threads.emplace_back ( [ &r, p, n ] { produce ( r, p, n, p + 1u ); } );
+    bool const ok = consume ( r, producers, n );
+    for ( std::thread & t : threads )
+        t.join ( );
+    return ok;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = ring_test<pdr::spsc_ring<std::uint64_t>> ( 1u, 200'000u, 8u ) and ok;
+    ok      = ring_test<pdr::spsc_ring<std::uint64_t, std::uint32_t>> ( 1u, 200'000u, 64u ) and ok;
+    ok      = ring_test<pdr::mpsc_ring<std::uint64_t>> ( 1u, 200'000u, 8u ) and ok;
+    ok      = ring_test<pdr::mpsc_ring<std::uint64_t>> ( 4u, 100'000u, 8u ) and ok;
+    ok      = ring_test<pdr::mpsc_ring<std::uint64_t, std::uint32_t>> ( 4u, 100'000u, 64u ) and ok;
+    std::printf ( "ring: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
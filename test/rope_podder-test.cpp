@@ -0,0 +1,116 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <random>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/rope_podder.hpp"
+
+// random split/append (both ways) and erase ( i, n ) against a std::vector, the depth has to stay logarithmic.
+
+template<typename Rope>
+bool same ( Rope const & r, std::vector<int> const & v ) {
+    if ( r.size ( ) != v.size ( ) )
+        return false;
+    std::size_t i = 0;
+    bool ok       = true;
+    r.for_each ( [ & ] ( int const x ) { ok = ok and x == v[ i++ ]; } );
+    return ok;
+}
+
+// all nodes but the root at least a quarter full, a root of at least 2 children.
+template<typename Rope>
+bool shallow ( Rope const & r ) {
+    if ( r.size ( ) < 2u )
+        return true;
+    double const leaves = std::max ( 1.0, static_cast<double> ( r.size ( ) ) / ( Rope::leaf_capacity / 4u ) );
+    double const bound  = 2.0 + std::log ( leaves / 2.0 ) / std::log ( static_cast<double> ( Rope::fanout / 4u ) );
+    return static_cast<double> ( r.depth ( ) ) <= std::ceil ( bound );
+}
+
+template<std::size_t LeafBytes>
+bool rope_split_append_test ( std::size_t const n, std::size_t const rounds ) {
+    using rope = pdr::rope_podder<int, std::size_t, LeafBytes>;
+    std::mt19937_64 gen ( n + LeafBytes );
+    std::vector<int> v ( n );
+    for ( std::size_t i = 0; i < n; ++i )
+        v[ i ] = static_cast<int> ( i );
+    rope r ( v.data ( ), v.size ( ) );
+    for ( std::size_t round = 0; round < rounds; ++round ) {
+        std::size_t const i = gen ( ) % ( v.size ( ) + 1u );
+        switch ( gen ( ) % 4u ) {
+            case 0: { // split and append.
+                rope t = r.split ( i );
+                r.append ( std::move ( t ) );
+            } break;
+            case 1: { // split and prepend, i.e. rotate.
+                rope t = r.split ( i );
+                t.append ( std::move ( r ) );
+                r = std::move ( t );
+                std::rotate ( v.begin ( ), v.begin ( ) + static_cast<std::ptrdiff_t> ( i ), v.end ( ) );
+            } break;
+            case 2: { // erase a range and insert a value.
+                std::size_t const m = std::min<std::size_t> ( gen ( ) % 64u, v.size ( ) - i );
+                r.erase ( i, m );
+                v.erase ( v.begin ( ) + static_cast<std::ptrdiff_t> ( i ), v.begin ( ) + static_cast<std::ptrdiff_t> ( i + m ) );
+                std::size_t const j = gen ( ) % ( v.size ( ) + 1u );
+                r.insert ( j, static_cast<int> ( round ) );
+                v.insert ( v.begin ( ) + static_cast<std::ptrdiff_t> ( j ), static_cast<int> ( round ) );
+            } break;
+            default: { // split off a piece, append it again.
+                rope t = r.split ( i ), u = t.split ( t.size ( ) / 2u );
+                r.append ( std::move ( t ) );
+                r.append ( std::move ( u ) );
+            }
+        }
+        if ( not shallow ( r ) ) {
+            std::printf ( "rope<%zu>: depth %zu at size %zu, round %zu\n", LeafBytes, static_cast<std::size_t> ( r.depth ( ) ),
+                          static_cast<std::size_t> ( r.size ( ) ), round );
+            return false;
+        }
+        if ( round % 1024u == 0u and not same ( r, v ) ) {
+            std::printf ( "rope<%zu>: contents differ, round %zu\n", LeafBytes, round );
+            return false;
+        }
+    }
+    return same ( r, v );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = rope_split_append_test<64u> ( 200'000u, 20'000u ) and ok;
+    ok      = rope_split_append_test<4'096u> ( 1'000'000u, 20'000u ) and ok;
+    ok      = rope_split_append_test<64u> ( 100u, 20'000u ) and ok; // small, mostly leaves and roots.
+    std::printf ( "rope_podder: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,142 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/segmented_podder.hpp"
+
+// segmented_podder against std::vector, and the address every value got when it was pushed, which mustn't change.
+
+template<typename Segmented, typename Type>
+bool same ( Segmented const & s, std::vector<Type> const & v ) {
+    if ( s.size ( ) != v.size ( ) or s.empty ( ) != v.empty ( ) or s.capacity ( ) < s.size ( ) )
+        return false;
+    for ( std::size_t i = 0; i < v.size ( ); ++i )
+        if ( s[ i ] != v[ i ] )
+            return false;
+    return v.empty ( ) or ( s.front ( ) == v.front ( ) and s.back ( ) == v.back ( ) );
+}
+
+// segment k holds FirstSize * 2^k values, all but the last one full.
+template<typename Segmented, typename Type>
+bool segments ( Segmented const & s, std::vector<Type> const & v, std::size_t const first_size ) {
+    std::size_t i = 0, k = 0;
+    bool ok       = true;
+    s.for_each_segment ( [ & ] ( Type const * const p, auto const m ) {
+        std::size_t const full = first_size << k++;
+        ok = ok and m and ( m == full or i + m == v.size ( ) ) and m <= full and std::equal ( p, p + m, v.begin ( ) + i ) and
+             p == &s[ i ];
+        i += m;
+    } );
+    podder<::iovec> const io = s.iovecs ( );
+    std::size_t bytes        = 0;
+    for ( ::iovec const & e : io )
+        bytes += e.iov_len;
+    auto const flat = s.flatten ( );
+    return ok and i == v.size ( ) and k == s.segment_count ( ) and io.size ( ) == k and bytes == v.size ( ) * sizeof ( Type ) and
+           flat.size ( ) == v.size ( ) and std::equal ( v.begin ( ), v.end ( ), flat.begin ( ) );
+}
+
+template<typename Type, std::size_t FirstSize>
+bool segmented_podder_random_test ( std::uint64_t const seed ) {
+    using segmented_type = pdr::segmented_podder<Type, std::size_t, FirstSize>;
+    std::mt19937_64 gen ( seed );
+    segmented_type s;
+    std::vector<Type> v;
+    std::vector<Type const *> at; // the address of every value pushed.
+    for ( int i = 0; i < 200'000; ++i ) {
+        switch ( gen ( ) % 16u ) {
+            case 0:
+            case 1:
+            case 2:
+                if ( v.size ( ) ) {
+                    s.pop_back ( ), v.pop_back ( );
+                    at.pop_back ( );
+                }
+                break;
+            case 3:
+                if ( gen ( ) % 2'048u == 0u ) {
+                    s.clear ( ), v.clear ( );
+                    at.clear ( );
+                }
+                else if ( gen ( ) % 256u == 0u ) {
+                    s.shrink_to_fit ( );
+                    if ( s.capacity ( ) > 2u * v.size ( ) + FirstSize )
+                        return false;
+                }
+                else if ( gen ( ) % 256u == 0u ) {
+                    std::size_t const count = v.size ( ) + gen ( ) % 1'000u;
+                    s.reserve ( count );
+                    if ( s.capacity ( ) < count )
+                        return false;
+                }
+                break;
+            default: {
+                Type const x = static_cast<Type> ( gen ( ) );
+                if ( gen ( ) % 2u )
+                    s.push_back ( x );
+                else
+                    s.emplace_back ( x );
+                v.push_back ( x );
+                at.push_back ( &s.back ( ) );
+            }
+        }
+        if ( i % 1'000 == 0 ) {
+            for ( std::size_t j = 0; j < at.size ( ); ++j )
+                if ( &s[ j ] != at[ j ] )
+                    return false;
+            if ( not same ( s, v ) or not segments ( s, v, FirstSize ) )
+                return false;
+        }
+    }
+    if ( not same ( s, v ) or not segments ( s, v, FirstSize ) )
+        return false;
+    segmented_type c = s; // a copy is a new allocation, the same values.
+    bool ok          = same ( c, v ) and segments ( c, v, FirstSize ) and ( v.empty ( ) or &c[ 0 ] != &s[ 0 ] );
+    segmented_type m = std::move ( c ); // moves the segments.
+    ok               = ok and c.empty ( ) and same ( m, v ) and ( v.empty ( ) or &m[ 0 ] != &s[ 0 ] );
+    c                = m;
+    m                = segmented_type ( );
+    return ok and m.empty ( ) and m.capacity ( ) == 0u and same ( c, v ) and segments ( c, v, FirstSize );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = segmented_podder_random_test<std::uint8_t, 16u> ( 1u ) and ok;
+    ok      = segmented_podder_random_test<std::uint32_t, 1u> ( 2u ) and ok;
+    ok      = segmented_podder_random_test<std::uint64_t, 64u> ( 3u ) and ok;
+    std::printf ( "segmented_podder: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
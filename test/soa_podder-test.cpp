@@ -0,0 +1,157 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/soa_podder.hpp"
+
+// soa_podder against a std::vector of tuples, every column is checked through its span and every record through
+// operator[].
+
+struct triple {
+    std::uint64_t v[ 3 ];
+    [[nodiscard]] bool operator== ( triple const & o ) const noexcept { return std::equal ( v, v + 3, o.v ); }
+};
+
+using soa_type    = pdr::soa_podder<std::uint8_t, double, triple, std::uint32_t>;
+using record_type = std::tuple<std::uint8_t, double, triple, std::uint32_t>;
+
+record_type make ( std::uint64_t const x ) {
+    return { static_cast<std::uint8_t> ( x ), static_cast<double> ( x % 1'000u ) * 0.5, triple{ { x, ~x, x * 3u } },
+             static_cast<std::uint32_t> ( x >> 7 ) };
+}
+
+template<std::size_t I>
+bool same_column ( soa_type const & s, std::vector<record_type> const & v ) {
+    pdr::span<typename soa_type::column_type<I> const> const c = s.template column<I> ( );
+    if ( c.size ( ) != v.size ( ) or c.size_bytes ( ) != v.size ( ) * sizeof ( typename soa_type::column_type<I> ) )
+        return false;
+    for ( std::size_t i = 0; i < v.size ( ); ++i )
+        if ( not( c[ i ] == std::get<I> ( v[ i ] ) ) )
+            return false;
+    // each column starts on a 64 byte boundary, relative to the block (the first column).
+    auto const o = reinterpret_cast<char const *> ( c.data ( ) ) - reinterpret_cast<char const *> ( s.column<0> ( ).data ( ) );
+    return not v.size ( ) or o % 64 == 0;
+}
+
+bool same ( soa_type const & s, std::vector<record_type> const & v ) {
+    if ( s.size ( ) != v.size ( ) or s.empty ( ) != v.empty ( ) or s.capacity ( ) < s.size ( ) )
+        return false;
+    for ( std::size_t i = 0; i < v.size ( ); ++i )
+        if ( not( s[ i ] == v[ i ] ) )
+            return false;
+    return same_column<0> ( s, v ) and same_column<1> ( s, v ) and same_column<2> ( s, v ) and same_column<3> ( s, v );
+}
+
+bool soa_podder_random_test ( std::uint64_t const seed ) {
+    std::mt19937_64 gen ( seed );
+    soa_type s;
+    std::vector<record_type> v;
+    for ( int i = 0; i < 20'000; ++i ) {
+        record_type const r = make ( gen ( ) );
+        switch ( gen ( ) % 10u ) {
+            case 0:
+            case 1: std::apply ( [ &s ] ( auto const &... x ) { s.emplace_back ( x... ); }, r ), v.push_back ( r ); break;
+            case 2: s.push_back ( r ), v.push_back ( r ); break;
+            case 3:
+                if ( v.size ( ) )
+                    s.pop_back ( ), v.pop_back ( );
+                break;
+            case 4: {
+                std::size_t const n = gen ( ) % 200u; // new records are zeros.
+                s.resize ( n ), v.resize ( n, record_type{ 0u, 0.0, triple{ }, 0u } );
+            } break;
+            case 5:
+                if ( v.size ( ) ) {
+                    std::size_t const j = gen ( ) % v.size ( );
+                    s.unordered_erase ( j );
+                    v[ j ] = v.back ( );
+                    v.pop_back ( );
+                }
+                break;
+            case 6:
+                if ( v.size ( ) ) { // through the tuple of references, and through a column.
+                    std::size_t const j = gen ( ) % v.size ( );
+                    std::get<2> ( s[ j ] ) = std::get<2> ( r ), std::get<2> ( v[ j ] ) = std::get<2> ( r );
+                    s.column<1> ( )[ j ] = std::get<1> ( r ), std::get<1> ( v[ j ] ) = std::get<1> ( r );
+                }
+                break;
+            case 7:
+                switch ( gen ( ) % 4u ) {
+                    case 0: s.reserve ( s.capacity ( ) + gen ( ) % 100u ); break;
+                    case 1: s.shrink_to_fit ( ); break;
+                    case 2: {
+                        soa_type t ( s ); // a copy, at capacity size ( ).
+                        s = std::move ( t );
+                    } break;
+                    default:
+                        if ( gen ( ) % 16u == 0u )
+                            s.clear ( ), v.clear ( );
+                }
+                break;
+            default: {
+                soa_type const t = s;
+                if ( not same ( t, v ) )
+                    return false;
+            }
+        }
+        if ( not same ( s, v ) )
+            return false;
+    }
+    return true;
+}
+
+// the span, on its own.
+bool span_test ( ) {
+    std::vector<int> v{ 1, 2, 3, 4, 5 };
+    pdr::span<int> const s ( v.data ( ), v.size ( ) );
+    pdr::span<int const> const c = s; // span<T> -> span<T const>.
+    pdr::span<int> const sub     = s.subspan ( 1, 3 );
+    sub[ 0 ]                     = 20;
+    int sum                      = 0;
+    for ( int const x : c )
+        sum += x;
+    return c.size ( ) == 5u and c.size_bytes ( ) == 5u * sizeof ( int ) and sub.front ( ) == 20 and sub.back ( ) == 4 and
+           v[ 1 ] == 20 and sum == 1 + 20 + 3 + 4 + 5 and pdr::span<int> ( ).empty ( ) and s.subspan ( 5, 0 ).empty ( );
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = soa_podder_random_test ( 1u ) and ok;
+    ok      = span_test ( ) and ok;
+    std::printf ( "soa_podder: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
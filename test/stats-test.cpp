@@ -0,0 +1,127 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <thread>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+#define PODDER_STATS true
+
+#include "podder.hpp"
+
+// the counters against what the podders did, as seen through their public interface.
+
+bool stats_small_test ( ) {
+    pdr::stats::reset ( );
+    {
+        podder<std::uint8_t> p;
+        for ( int i = 0; i < 10; ++i )
+            p.push_back ( static_cast<std::uint8_t> ( i ) );
+        podder<std::uint8_t> q; // empty, doesn't count.
+    }
+    pdr::stats::counters const c = pdr::stats::get ( );
+    return c.small_exits == 1u and c.medium_exits == 0u and c.mallocs == 0u and c.frees == 0u and c.spills == 0u and
+           pdr::stats::snapshot ( ).svo_hit_rate == 1.0;
+}
+
+bool stats_growth_test ( ) {
+    using podder_type = podder<std::uint32_t>;
+    pdr::stats::reset ( );
+    bool ok = true;
+    std::uint64_t allocations = 0u, relocations = 0u, spill_bytes = 0u, peak = 0u;
+    std::size_t size_in_bytes = 0u, capacity_in_bytes = 0u;
+    {
+        podder_type p;
+        for ( std::uint32_t i = 0; i < 10'000u; ++i ) {
+            podder_type::size_type const capacity = p.capacity ( );
+            bool const small                      = p.svo_model ( ) == podder_type::svo_type::small;
+            void const * const data               = p.data ( );
+            p.push_back ( i );
+            if ( small and p.svo_model ( ) == podder_type::svo_type::medium ) {
+                ++allocations;
+                spill_bytes = std::uint64_t{ i } * sizeof ( std::uint32_t );
+            }
+            else if ( p.capacity ( ) != capacity ) {
+                ++allocations;
+                relocations += data != p.data ( );
+            }
+            peak = std::max ( peak, std::uint64_t{ p.capacity_in_bytes ( ) } );
+        }
+        pdr::stats::counters const c = pdr::stats::get ( );
+        ok = c.spills == 1u and c.mallocs + c.reallocs == allocations and c.relocations == relocations and
+             c.peak_capacity == peak and c.frees == 0u;
+        // bytes_moved holds the spill and what the relocations copied (at most the old capacity each).
+        ok                = ok and c.bytes_moved >= spill_bytes and ( c.bytes_moved > spill_bytes ) == ( relocations > 0u );
+        size_in_bytes     = p.size_in_bytes ( );
+        capacity_in_bytes = p.capacity_in_bytes ( );
+    }
+    pdr::stats::counters const c = pdr::stats::get ( );
+    pdr::stats::report const r   = pdr::stats::snapshot ( );
+    return ok and c.medium_exits == 1u and c.small_exits == 0u and c.frees == c.mallocs and c.exit_size == size_in_bytes and
+           c.exit_capacity == capacity_in_bytes and
+           r.slack == static_cast<double> ( capacity_in_bytes - size_in_bytes ) / static_cast<double> ( capacity_in_bytes ) and
+           r.svo_hit_rate == 0.0;
+}
+
+bool stats_svo_hit_rate_test ( ) {
+    pdr::stats::reset ( );
+    {
+        podder<std::uint8_t> a{ 1, 2, 3 }, b{ 4 }, c ( 5, 6 ), d ( 1'000, 7 ), e;
+        podder<std::uint8_t> f ( d ); // a medium copy.
+        f.resize ( 2 );
+        f.skrink_to_fit ( ); // back into the svo buffer, counts as small.
+    }
+    pdr::stats::counters const c = pdr::stats::get ( );
+    return c.small_exits == 4u and c.medium_exits == 1u and pdr::stats::snapshot ( ).svo_hit_rate == 0.8;
+}
+
+bool stats_thread_local_test ( ) {
+    pdr::stats::reset ( );
+    pdr::stats::counters other;
+    std::thread t ( [ &other ] ( ) {
+        pdr::stats::reset ( );
+        {
+            podder<std::uint64_t> p ( 1'000, 1u );
+        }
+        other = pdr::stats::get ( );
+    } );
+    t.join ( );
+    pdr::stats::counters const c = pdr::stats::get ( );
+    return c.mallocs == 0u and c.medium_exits == 0u and other.mallocs == 1u and other.frees == 1u and other.medium_exits == 1u;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = stats_small_test ( ) and ok;
+    ok      = stats_growth_test ( ) and ok;
+    ok      = stats_svo_hit_rate_test ( ) and ok;
+    ok      = stats_thread_local_test ( ) and ok;
+    std::printf ( "stats: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,159 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/podder.hpp"
+
+// value-initialization (calloc'ed blocks, memset or the constructor) against std::vector, on a heap that's been
+// dirtied first, so a block that isn't zeroed shows.
+
+struct holder {
+    int v;
+};
+struct member_pointer { // null is -1, not all zero bits.
+    int holder::*p;
+    [[nodiscard]] bool operator== ( member_pointer const & o ) const noexcept { return p == o.p; }
+    [[nodiscard]] bool operator!= ( member_pointer const & o ) const noexcept { return p != o.p; }
+};
+template<>
+struct pdr::is_zero_initialized<member_pointer> : std::false_type {};
+
+struct seven { // a constructor, so not is_zero_initialized.
+    int v = 7;
+    [[nodiscard]] bool operator== ( seven const & o ) const noexcept { return v == o.v; }
+    [[nodiscard]] bool operator!= ( seven const & o ) const noexcept { return v != o.v; }
+};
+static_assert ( std::is_trivially_copyable<seven>::value and not pdr::is_zero_initialized<seven>::value );
+static_assert ( pdr::is_zero_initialized<double>::value and pdr::is_zero_initialized<holder>::value );
+static_assert ( not pdr::is_zero_initialized<int holder::*>::value and not pdr::is_zero_initialized<member_pointer>::value );
+
+template<typename Type>
+Type make ( std::uint64_t const i ) {
+    if constexpr ( std::is_same<Type, member_pointer>::value )
+        return { i % 2u ? &holder::v : nullptr };
+    else if constexpr ( std::is_same<Type, int holder::*>::value )
+        return i % 2u ? &holder::v : nullptr;
+    else if constexpr ( std::is_same<Type, seven>::value )
+        return { static_cast<int> ( i ) };
+    else
+        return static_cast<Type> ( i );
+}
+
+// frees a few blocks of about that size full of junk, for the next allocation to pick up.
+void dirty ( std::size_t const bytes ) {
+    for ( std::size_t b : { bytes + bytes / 2u, bytes, bytes / 2u } ) {
+        if ( void * const p = std::malloc ( b + 1u ) ) {
+            std::memset ( p, 0xAB, b + 1u );
+            std::free ( p );
+        }
+    }
+}
+
+template<typename Podder, typename Type>
+bool same ( Podder const & p, std::vector<Type> const & v ) {
+    if ( p.size ( ) != static_cast<typename Podder::size_type> ( v.size ( ) ) )
+        return false;
+    for ( std::size_t i = 0; i < v.size ( ); ++i )
+        if ( p[ i ] != v[ i ] )
+            return false;
+    return true;
+}
+
+template<typename Type, std::size_t Alignment = 0u>
+bool value_init_random_test ( std::uint64_t const seed ) {
+    using podder_type = podder<Type, std::size_t, visual_studio_growth_policy<std::size_t>, Alignment>;
+    std::mt19937_64 gen ( seed );
+    podder_type p;
+    std::vector<Type> v;
+    for ( int i = 0; i < 5'000; ++i ) {
+        // mostly small and medium sizes, now and then a large block (straight from the os).
+        std::size_t const n = gen ( ) % 64u ? gen ( ) % ( gen ( ) % 2u ? 40u : 5'000u ) : 100'000u + gen ( ) % 300'000u;
+        dirty ( n * sizeof ( Type ) );
+        switch ( gen ( ) % 8u ) {
+            case 0:
+            case 1:
+            case 2: // grows in the svo buffer, spills, reallocs or callocs a mostly new block, or shrinks.
+                p.resize ( n ), v.resize ( n );
+                break;
+            case 3:
+                p = podder_type ( n ), v.assign ( n, Type{ } );
+                break;
+            case 4: {
+                Type const x = gen ( ) % 2u ? Type{ } : make<Type> ( gen ( ) );
+                p.assign ( n, x ), v.assign ( n, x );
+            } break;
+            case 5: // a value that refers into the podder, across a relocation.
+                if ( p.size ( ) ) {
+                    std::size_t const j = gen ( ) % p.size ( );
+                    Type const x        = v[ j ];
+                    p.assign ( n, p[ j ] ), v.assign ( n, x );
+                }
+                break;
+            case 6: // values past the size that aren't zero, for resize to overwrite.
+                for ( std::size_t j = gen ( ) % 50u; j; --j ) {
+                    Type const x = make<Type> ( gen ( ) | 1u );
+                    p.push_back ( x ), v.push_back ( x );
+                }
+                for ( std::size_t j = gen ( ) % ( v.size ( ) + 1u ); j; --j )
+                    p.pop_back ( ), v.pop_back ( );
+                break;
+            default:
+                if ( gen ( ) % 2u )
+                    p.skrink_to_fit ( );
+                else
+                    p.clear ( ), v.clear ( );
+        }
+        if ( not same ( p, v ) )
+            return false;
+        if ( Alignment and p.size ( ) > 64u and reinterpret_cast<std::uintptr_t> ( p.data ( ) ) % Alignment )
+            return false;
+    }
+    return true;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = value_init_random_test<std::uint8_t> ( 1u ) and ok;
+    ok      = value_init_random_test<std::uint32_t> ( 2u ) and ok;
+    ok      = value_init_random_test<double> ( 3u ) and ok;
+    ok      = value_init_random_test<std::uint64_t, 64u> ( 4u ) and ok;
+    ok      = value_init_random_test<seven> ( 5u ) and ok;
+    ok      = value_init_random_test<int holder::*> ( 6u ) and ok;
+    ok      = value_init_random_test<member_pointer> ( 7u ) and ok;
+    std::printf ( "value_init: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,123 @@
+
+// MIT License
+//
+// Copyright (c) 2018, 2019 degski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <random>
+#include <thread>
+#include <vector>
+
+// the tests allocate through the system allocator (as the benchmarks do).
+#define USE_MIMALLOC false
+
+#include "podder/ws_deque.hpp"
+
+// the owner alone, pop is lifo and steal is fifo (against a std::deque), through a few grows.
+bool ws_deque_sequential_test ( ) {
+    pdr::ws_deque<std::uint64_t> d ( 2u );
+    std::deque<std::uint64_t> r;
+    std::mt19937_64 gen ( 1u );
+    bool ok = true;
+    for ( std::uint64_t i = 0; i < 100'000u; ++i ) {
+        switch ( gen ( ) % 4u ) {
+            case 0: {
+                auto const v = d.pop ( );
+                ok = ok and v.has_value ( ) == not r.empty ( ) and ( not v or *v == r.back ( ) );
+                if ( v )
+                    r.pop_back ( );
+            } break;
+            case 1: {
+                auto const v = d.steal ( );
+                ok = ok and v.has_value ( ) == not r.empty ( ) and ( not v or *v == r.front ( ) );
+                if ( v )
+                    r.pop_front ( );
+            } break;
+            default: d.push ( i ), r.push_back ( i );
+        }
+        ok = ok and d.size ( ) == r.size ( );
+    }
+    return ok;
+}
+
+// the owner pushes 0, 1, ... and pops some, thieves steal. Every value is taken exactly once, and the values a
+// thief steals are increasing (steals take from the top).
+bool ws_deque_concurrent_test ( std::size_t const thieves, std::uint64_t const n ) {
+    pdr::ws_deque<std::uint64_t> d ( 16u );
+    std::atomic<bool> done{ false };
+    std::vector<std::vector<std::uint64_t>> stolen ( thieves );
+    std::vector<std::thread> threads;
+    for ( std::size_t t = 0; t < thieves; ++t )
+        threads.emplace_back ( [ &d, &done, &s = stolen[ t ] ] {
+            for ( ;; ) {
+                if ( auto const v = d.steal ( ) )
+                    s.push_back ( *v );
+                else if ( done.load ( std::memory_order_acquire ) )
+                    return;
+                else
+                    std::this_thread::yield ( );
+            }
+        } );
+    std::vector<std::uint64_t> popped;
+    std::mt19937_64 gen ( 2u );
+    for ( std::uint64_t i = 0; i < n; ++i ) {
+        d.push ( i );
+        if ( not( gen ( ) % 3u ) ) {
+            if ( auto const v = d.pop ( ) )
+                popped.push_back ( *v );
+        }
+        if ( not( i % 1'024u ) ) // let the thieves in (on few cores).
+            std::this_thread::yield ( );
+    }
+    while ( auto const v = d.pop ( ) )
+        popped.push_back ( *v );
+    done.store ( true, std::memory_order_release );
+    for ( std::thread & t : threads )
+        t.join ( );
+    bool ok = d.empty ( );
+    std::vector<std::uint64_t> all ( popped );
+    for ( auto const & s : stolen ) {
+        ok = ok and std::is_sorted ( s.begin ( ), s.end ( ) ) and std::adjacent_find ( s.begin ( ), s.end ( ) ) == s.end ( );
+        all.insert ( all.end ( ), s.begin ( ), s.end ( ) );
+    }
+    std::sort ( all.begin ( ), all.end ( ) );
+    ok = ok and all.size ( ) == n;
+    for ( std::uint64_t i = 0; ok and i < n; ++i )
+        ok = all[ i ] == i;
+    return ok;
+}
+
+int main ( ) {
+    bool ok = true;
+    ok      = ws_deque_sequential_test ( ) and ok;
+    ok      = ws_deque_concurrent_test ( 1u, 200'000u ) and ok;
+    ok      = ws_deque_concurrent_test ( 3u, 200'000u ) and ok;
+    std::printf ( "ws_deque: %s\n", ok ? "ok" : "failed" );
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}